@@ -1,43 +1,50 @@
 /*
- * ¤allocator
- * Ǥatorά뤳Ȥ
+ * 構造体allocator
+ * ソースコード中ではatorと略することがある
  */
 #ifndef _alloc_h_included_
 #define _alloc_h_included_
 
-/** Υϥɥ */
+/** アロケータのハンドル */
 typedef struct allocator_priv * allocator;
 
 /*
- * allocator
- * s: ¤Τsize(Хȿ)
- * dtor: =destructor ݤ֥ȤȤ˸ƤФؿ
- *  dtorΰϲ륪֥
- * ֤: allocator 
+ * allocatorを作る
+ * s: 構造体のsize(バイト数)
+ * dtor: =destructor 確保したオブジェクトが解放されるときに呼ばれる関数
+ *  dtorの引数は解放されるオブジェクト
+ * 返り値: 作成したallocator 
  */
 allocator anthy_create_allocator(int s, void (*dtor)(void *));
 
 /*
- * allocator
- *  κݤˡallocatorݤ줿֥ȤƲ
- * a: allocator
+ * allocatorを解放する
+ *  この際に、このallocatorから確保されたオブジェクトは全て解放される
+ * a: 解放するallocator
  */
 void anthy_free_allocator(allocator a);
 
 /*
- * ֥Ȥݤ
+ * allocatorから確保されたオブジェクトを全て解放する
+ *  ページは解放せずに次に確保する際に使い回す
  * a: allocator
- * ֤: ݤ֥ȤΥɥ쥹
+ */
+void anthy_reset_allocator(allocator a);
+
+/*
+ * オブジェクトを確保する
+ * a: allocator
+ * 返り値: 確保したオブジェクトのアドレス
  */
 void *anthy_smalloc(allocator a);
 /*
- * ֥Ȥ
+ * オブジェクトを解放する
  * a: allocator
- * p: 륪֥ȤΥɥ쥹
+ * p: 解放するオブジェクトのアドレス
  */
 void anthy_sfree(allocator a, void *p);
 
-/* Ƥallocator˴ */
+/* 全てのallocatorを破棄する */
 void anthy_quit_allocator(void);
 
 #endif
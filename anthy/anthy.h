@@ -56,6 +56,8 @@ extern int anthy_init_utf8(void);
 extern void anthy_quit(void);
 extern void anthy_conf_override(const char *, const char *);
 extern int anthy_set_personality(const char *);
+extern int anthy_reload_dic(const char *);
+extern void anthy_idle(void);
 
 
 
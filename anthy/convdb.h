@@ -1,10 +1,10 @@
-/* Ѵ̤Υǡ١ */
+/* 変換結果のデータベース */
 #ifndef _convdb_h_included_
 #define _convdb_h_included_
 
 #include <anthy/anthy.h>
 
-/* , OK, Ѵ, don't care4ĤΥƥ꡼ʬह */
+/* 不明, OK, 誤変換, don't careの4つのカテゴリーに分類する */
 #define CHK_UNKNOWN 0
 #define CHK_OK 1
 #define CHK_MISS 2
@@ -16,12 +16,12 @@
 #define CONV_CAND_MISS 2
 #define CONV_INVALID 4
 
-/* ѴѴʸ󡢷̤ФȽǼ */
+/* 変換前と変換後の文字列、結果に対する判定を格納する */
 struct conv_res {
-  /* Υ */
+  /* 検索のキー */
   char *src_str;
   char *res_str;
-  /* Ƥ */
+  /* 候補を割り当てたもの */
   char *cand_str;
   /**/
   int *cand_check;
@@ -32,7 +32,7 @@ struct conv_res {
   struct conv_res *next;
 };
 
-/* Ѵ̤Υ */
+/* 変換結果のカウント */
 struct res_stat {
   int unknown;
   int ok;
@@ -40,7 +40,7 @@ struct res_stat {
   int dontcare;
 };
 
-/* Ѵ̤Υǡ١ */
+/* 変換結果のデータベース */
 struct res_db {
   /**/
   struct conv_res res_list;
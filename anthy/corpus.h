@@ -1,4 +1,4 @@
-/* ѥι۵ڤӥԤ */
+/* コーパスの構築及びアクセスを行う */
 #ifndef _corpus_h_included_
 #define _corpus_h_included_
 
@@ -11,10 +11,10 @@ struct corpus;
 #define ELM_WORD_BORDER 0x20000000
 #define ELM_INVALID 0x40000000
 
-/* hashͤβ28bitȤ */
+/* hash値の下位28bitを使う */
 #define CORPUS_KEY_MASK 0x0fffffff
 
-/* ѥѤδؿ */
+/* コーパス構築用の関数 */
 struct corpus *corpus_new(void);
 void corpus_push_back(struct corpus *c, int *val, int nr, int flags);
 void corpus_build(struct corpus *c);
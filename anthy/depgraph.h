@@ -1,4 +1,4 @@
-/* °쥰դΥǡ¤ */
+/* 付属語グラフのデータ構造 */
 #ifndef _depgraph_h_included_
 #define _depgraph_h_included_
 
@@ -6,13 +6,13 @@
 #include <anthy/wtype.h>
 
 struct dep_transition {
-  /** ΥΡɤֹ 0ξϽü */
+  /** 遷移先のノードの番号 0の場合は終端 */
   int next_node;
-  /** ʻ */
+  /** 品詞 */
   int pos;
-  /** ѷ */
+  /** 活用形 */
   int ct;
-  /* °쥯饹 */
+  /* 付属語クラス */
   enum dep_class dc;
 
   int head_pos;
@@ -22,50 +22,86 @@ struct dep_transition {
 typedef int ondisk_xstr;
 
 struct dep_branch {
-  /* ܾ° */
-  /** ܾ */
+  /* 遷移条件の付属語の配列 */
+  /** 遷移条件の配列 */
   int nr_cond_strs;
   xstr **cond_strs;
   ondisk_xstr *xstrs;
 
-  /** ΥΡ */
+  /** 遷移先のノード */
   int nr_transitions;
   struct dep_transition *transitions;
 };
 
 struct dep_node {
   int nr_branch;
-  /* ΥΡɤΤ٤Ƥܾκǽΰʸʸɤ31&
-   * Τ¡̵ܤΤΤ¤ˤ롣
+  /* 遷移条件のトライの根の状態 */
+  int root_state;
+  /* このノードからのすべての遷移条件の最初の一文字の文字コードを31で&した
+   * ものの和。条件無しの遷移は遷移先のものを和にする。
    */
   int follow_mask;
   struct dep_branch *branch;
 };
 
-/** ΩʻȤθ³°ΥΥΡɤб */
+/*
+ * 各ノードの遷移条件の文字列をまとめたトライ(決定性オートマトン)
+ * ノードのbranchを順に並べた時の遷移条件の通し番号をrankとし、
+ * 受理した遷移条件をrankの順に試すことで元の探索順を保つ
+ */
+#define DEP_AUTOMATON_MAGIC 0x44460001
+/* 一回の照合で受理しうる遷移条件の数の上限 */
+#define DEP_MAX_MATCHES 64
+
+struct dep_state {
+  /* 文字コード順に並んだ出力辺 */
+  int first_edge;
+  int nr_edges;
+  /* この状態で受理する遷移条件 */
+  int first_accept;
+  int nr_accepts;
+};
+
+struct dep_edge {
+  xchar c;
+  int next_state;
+};
+
+struct dep_accept {
+  int rank;
+  int branch;
+};
+
+/** 自立語の品詞とその後に続く付属語のグラフ中のノードの対応 */
 struct wordseq_rule {
-  wtype_t wt; /* Ωʻ */
-  int node_id; /* μΩθ³°쥰ΥΡɤid */
+  wtype_t wt; /* 自立語の品詞 */
+  int node_id; /* この自立語の後ろに続く付属語グラフ中のノードのid */
 };
 
-/** °쥰դΥեǤη */
+/** 付属語グラフのファイル上での形式 */
 struct ondisk_wordseq_rule {
   char wt[8];
-  /* ͥåȥХȥ */
+  /* ネットワークバイトオーダー */
   int node_id;
 };
 
-/* °쥰 */
+/* 付属語グラフ */
 struct dep_dic {
   char* file_ptr;
 
   int nrRules;
   int nrNodes;
 
-  /* Ω줫³롼 */
+  /* 自立語からの接続ルール */
   struct ondisk_wordseq_rule *rules;
-  /* °֤³롼 */
+  /* 付属語間の接続ルール */
   struct dep_node* nodes;
+
+  /* 遷移条件のオートマトン */
+  int nrStates;
+  struct dep_state *states;
+  struct dep_edge *edges;
+  struct dep_accept *accepts;
 };
 
 #endif
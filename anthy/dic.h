@@ -1,5 +1,5 @@
 /*
- * ⥸塼Υ󥿡ե
+ * 辞書モジュールのインターフェース
  */
 #ifndef _dic_h_included_
 #define _dic_h_included_
@@ -7,40 +7,41 @@
 #include "xstr.h"
 #include "wtype.h"
 
-/** ɤߤФϥɥ(sequence entry) */
+/** 辞書の読みに対するハンドル(sequence entry) */
 typedef struct seq_ent *seq_ent_t;
 /***/
 typedef struct dic_ent *compound_ent_t;
 
-/* Τν */
+/* 全体の初期化、解放 */
 int anthy_init_dic(void);
 void anthy_quit_dic(void);
 
-/* ¾ץФ¾ */
+/* 他プロセスに対する排他制御 */
 void anthy_lock_dic(void);
+void anthy_lock_dic_shared(void);
 void anthy_unlock_dic(void);
 
 /**/
 void anthy_gang_load_dic(xstr *xs, int is_reverse);
 
-/* ʸμ */
+/* 文字列の取得 */
 seq_ent_t anthy_get_seq_ent_from_xstr(xstr *xs, int is_reverse);
-/* ʸξ */
+/* 文字列の情報 */
 int anthy_get_nr_dic_ents(seq_ent_t se, xstr *xs);
 int anthy_has_compound_ents(seq_ent_t se);
 int anthy_has_non_compound_ents(seq_ent_t se);
 int anthy_get_nth_dic_ent_is_compound(seq_ent_t se, int nth);
-/* ʣ */
+/* 非複合語 */
 /* caller should free @res */
 int anthy_get_nth_dic_ent_str(seq_ent_t, xstr *orig, int, xstr *res);
 int anthy_get_nth_dic_ent_freq(seq_ent_t, int nth);
 int anthy_get_nth_dic_ent_wtype(seq_ent_t, xstr *, int nth, wtype_t *w);
-/*  ʻ */
+/*  品詞 */
 int anthy_get_seq_ent_pos(seq_ent_t, int pos);
 int anthy_get_seq_ent_ct(seq_ent_t, int pos, int ct);
 int anthy_get_seq_ent_wtype_freq(seq_ent_t, wtype_t);
 int anthy_get_seq_ent_indep(seq_ent_t se);
-/* ʣ */
+/* 複合語 */
 compound_ent_t anthy_get_nth_compound_ent(seq_ent_t se, int nth);
 int anthy_get_seq_ent_wtype_compound_freq(seq_ent_t se, wtype_t wt);
 /**/
@@ -52,7 +53,7 @@ int anthy_compound_get_nth_segment_xstr(compound_ent_t ce, int nth, xstr *xs);
 
 
 
-/** 񥻥å
+/** 辞書セッション
  *
  */
 typedef struct mem_dic *dic_session_t;
@@ -61,6 +62,8 @@ typedef struct mem_dic *dic_session_t;
 dic_session_t anthy_dic_create_session(void);
 void anthy_dic_activate_session(dic_session_t );
 void anthy_dic_release_session(dic_session_t);
+void anthy_dic_reset_session(dic_session_t);
+int anthy_dic_reload(const char *fn);
 
 /* personality */
 void anthy_dic_set_personality(const char *);
@@ -68,11 +71,11 @@ void anthy_dic_set_personality(const char *);
 #define ANON_ID ""
 
 
-/** 㼭
+/** 用例辞書
  */
 int anthy_dic_check_word_relation(int from, int to);
 
-/** ̤θγؽ
+/** 未知語の学習
  */
 void anthy_add_unknown_word(xstr *yomi, xstr *word);
 void anthy_forget_unused_unknown_word(xstr *xs);
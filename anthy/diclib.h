@@ -2,11 +2,21 @@
 #define __diclib_h_included__
 
 
-/* Τν */
+/* 全体の初期化、解放 */
 int anthy_init_diclib(void);
 void anthy_quit_diclib(void);
 
+struct filemapping;
 void* anthy_file_dic_get_section(const char* section_name);
+void* anthy_file_dic_image_get_section(struct filemapping *m,
+				       const char* section_name);
+void anthy_file_dic_prefetch(void *addr, int len);
+/* anthy.dic以外の辞書ファイル */
+struct filemapping *anthy_file_dic_mmap(const char *fn);
+int anthy_file_dic_image_check_sections(struct filemapping *m,
+					const char *except);
+void anthy_file_dic_image_prefetch(struct filemapping *m,
+				   void *addr, int len);
 
 /*
   utility
@@ -8,14 +8,14 @@
 extern "C" {
 #endif
 
-/* ֤ / anthy_priv_dic_add_entry*/
-/* OK / ñ줬ϿǤ */
+/* 返り値 / anthy_priv_dic_add_entry*/
+/* OK / 単語が登録できた */
 #define ANTHY_DIC_UTIL_OK 0
-/*  / Ͽ˼Ԥ */
+/* 失敗 / 登録に失敗した */
 #define ANTHY_DIC_UTIL_ERROR -1
-/* Ʊñ줬ϿƤä٤ */
+/* 同じ単語が登録してあった、頻度だけを上書き */
 #define ANTHY_DIC_UTIL_DUPLICATE -2
-/* ¸ߤʤ */
+/* 辞書が存在しない */
 #define ANTHY_DIC_UTIL_INVALID -3
 
 void anthy_dic_util_init(void);
@@ -38,7 +38,7 @@ char *anthy_priv_dic_get_word(char *buf, int len);
 int anthy_priv_dic_add_entry(const char *yomi, const char *word,
 			     const char *wt, int freq);
 
-/* experimental and unstable /usr/share/dict/wordsñõ */
+/* experimental and unstable /usr/share/dict/wordsから単語を探す */
 #define HAS_ANTHY_DIC_SEARCH_WORDS_FILE
 char *anthy_dic_search_words_file(const char *word);
 
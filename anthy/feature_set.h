@@ -1,4 +1,4 @@
-/* 򰷤 */
+/* 素性を扱う */
 #ifndef _feature_set_h_included_
 #define _feature_set_h_included_
 
@@ -14,16 +14,16 @@
 #define FL_SEG_STRUCT_FEATURES 5
 #define FL_CORE_STRUCT 6
 
-/* hash collisionФŬ䤹 */
+/* hash collisionが出たら適宜増やす */
 #define WORD_HASH_MAX 2048
 /**/
 #define HASH_DEP_LEN 3
 
-/* 14++ = 16ˤʤ褦 */
+/* 14+正例+負例 = 16になるように */
 #define NR_EM_FEATURES 14
 
 struct feature_list {
-  /* ޤΤȤ14Ĥޤ */
+  /* いまのところ、素性は14個まで */
   int nr;
   int type;
   int size;
@@ -33,19 +33,25 @@ struct feature_list {
   } u;
 };
 
-struct feature_freq {
-  int f[NR_EM_FEATURES + 2];
-};
+/* 確率のテーブルのセクションの形式
+ *  ヘッダ: 識別子, 行数, ブロック数, 重みの合計 (int)
+ *  ブロックの位置: データの先頭からのオフセット (int * ブロック数)
+ *  データ: 各行は、前の行と共通な先頭の素性の数(1byte)、残りの素性の数
+ *   (1byte)、残りの素性(可変長整数)、正例の割合pの -log(p) * SCALE (2bytes)
+ *   ブロックの先頭の行は前の行と素性を共有しない
+ * 形式を変えたら識別子も変える、mkfiledicは識別子が変わると作り直す
+ */
+#define FEATURE_SECTION_MAGIC 0x46510001
+#define FEATURE_SECTION_HEADER 4
+#define FEATURE_BLOCK_ROWS 16
+#define FEATURE_PROB_SCALE 4096
+/* p = 0 */
+#define FEATURE_PROB_ZERO 0xffff
 
 void anthy_init_features(void);
-struct feature_freq *
-anthy_find_feature_freq(const void *array,
-			const struct feature_list *fl,
-			struct feature_freq *arg);
-struct feature_freq *
-anthy_find_array_freq(const void *array,
-		      int *f, int nr,
-		      struct feature_freq *arg);
+int anthy_find_feature_prob(const void *image,
+			    const struct feature_list *fl,
+			    double *prob);
 
 
 /**/
@@ -1,14 +1,27 @@
-/* mmapݲ */
+/* mmapを抽象化する */
 #ifndef _filemap_h_included_
 #define _filemap_h_included_
 
-/* map줿եΥϥɥ */
+/* メモリ上にmapされたファイルのハンドル */
 struct filemapping;
 
+/* anthy_mmap_with_policyに指定するmapの方針 */
+/* mapする時に全体を読み込む */
+#define ANTHY_MMAP_POPULATE 1
+/* 可能ならばhugepageを使う */
+#define ANTHY_MMAP_HUGEPAGE 2
+/* mlockしてスワップアウトさせない */
+#define ANTHY_MMAP_LOCK 4
+
 struct filemapping *anthy_mmap(const char *fn, int wr);
+struct filemapping *anthy_mmap_with_policy(const char *fn, int wr,
+					   int policy);
 void *anthy_mmap_address(struct filemapping *m);
 int anthy_mmap_size(struct filemapping *m);
 int anthy_mmap_is_writable(struct filemapping *m);
 void anthy_munmap(struct filemapping *m);
+/* mapした領域のうちaddrからlenバイトを先読みする */
+void anthy_mmap_prefetch(struct filemapping *m, void *addr, int len,
+			 int touch);
 
 #endif
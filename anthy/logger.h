@@ -1,4 +1,4 @@
-/* ǥХå䥨顼Υåν */
+/* デバッグやエラーのメッセージの出力 */
 #ifndef _logger_h_included_
 #define _logger_h_included_
 
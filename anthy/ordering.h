@@ -1,4 +1,4 @@
-/* νꤹ뤿Υ⥸塼 */
+/* 候補の順序を決定するためのモジュール */
 #ifndef _ordering_h_included_
 #define _ordering_h_included_
 
@@ -7,7 +7,7 @@
 struct segment_list;
 struct splitter_context;
 
-/** ordering_contextwrapper¤
+/** ordering_contextのwrapper構造体
  */
 struct ordering_context_wrapper{
   struct ordering_context *oc;
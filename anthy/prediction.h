@@ -5,13 +5,13 @@
 
 struct prediction_t {
   int timestamp;
-  /* ɤ */
+  /* 読み */
   xstr *src_str;
-  /* ̤ʸ */
+  /* 結果の文字列 */
   xstr *str;
 };
 
-/* ͽ¬줿ʸǼ */
+/* 予測された文字列を格納する */
 int anthy_traverse_record_for_prediction(xstr*, struct prediction_t*);
 
 
@@ -1,14 +1,14 @@
 /*
- * Ѥեѡ
+ * 汎用の設定ファイルパーザ
  */
 #ifndef _ruleparser_h_included_
 #define _ruleparser_h_included_
 
 /*
- * ե̾'/'ǻϤޤäƤХѥ
- * ե̾'./'ǻϤޤäƤХȥǥ쥯ȥ
- * ե̾NULLʤɸ
- * ǤʤСANTHYDIRΥե򳫤
+ * ファイル名が'/'で始まっていれば絶対パス
+ * ファイル名が'./'で始まっていればカレントディレクトリ
+ * ファイル名がNULLならば標準入力
+ * そうでなければ、ANTHYDIR中のファイルを開ける
  */
 int anthy_open_file(const char *fn);/* returns 0 on success */
 void anthy_close_file(void);
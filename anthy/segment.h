@@ -1,4 +1,4 @@
-/* segment(ʸ)  */
+/* segment(文節) の定義 */
 #ifndef _segment_h_included_
 #define _segment_h_included_
 
@@ -7,37 +7,41 @@
 #include <anthy/xstr.h>
 #include <anthy/dic.h>
 
-/** ι */
+/** 候補の構成要素 */
 struct cand_elm {
-  int nth; /* -1ΤȤϼ񤫤γƤäƤʤ */
+  int nth; /* -1のときは辞書からの割り当てをやっていない */
   wtype_t wt;
   seq_ent_t se;
-  xstr str;/* Ѵоݤʸ */
-  int id;/* Ѵ̤ʸФhash */
+  xstr str;/* 変換対象の文字列 */
+  int id;/* 変換結果の文字列に対するhash値 */
 };
 
-/** Ĥθ롣
- * anthy_release_cand_ent()ǲ
+/** 一つの候補に相当する。
+ * anthy_release_cand_ent()で解放する
  */
 struct cand_ent {
-  /** Υ */
+  /** 候補のスコア */
   int score;
-  /** Ѵʸ */
+  /** 変換後の文字列 */
   xstr str;
-  /** Ǥο */
+  /** 要素の数 */
   int nr_words;
-  /** Ǥ */
+  /** 候補を構成する要素の配列 */
   struct cand_elm *elm;
-  /** ΩΥǥå */
+  /** 自立語部のインデックス */
   int core_elm_index;
-  /** °hash */
+  /** 付属語のhash値 */
   int dep_word_hash;
-  /** Υե饰 CEF_? */
+  /** 候補のフラグ CEF_? */
   unsigned int flag;
+  /** 重複した候補から引き継いだフラグ */
+  unsigned int dupl_flag;
+  /** 文節中で生成された順番 */
+  int gen_order;
   struct meta_word *mw;
 };
 
-/* (cand_ent)Υե饰 */
+/* 候補(cand_ent)のフラグ */
 #define CEF_NONE           0
 #define CEF_OCHAIRE        0x00000001
 #define CEF_SINGLEWORD     0x00000002
@@ -50,41 +54,41 @@ struct cand_ent {
 #define CEF_BEST           0x00000100
 #define CEF_CONTEXT        0x00000200
 
-/** Context¸ߤʸ
- * release_seg_entǲ
+/** Context内に存在する文節の列
+ * release_seg_entで解放する
  */
 struct seg_ent {
-  /* strμΤcontextˤ */
+  /* strの実体はcontext中にある */
   xstr str;
-  /* commit줿ֹ桢οξϤޤߥåȤƤʤ */
+  /* commitされた候補の番号、負の数の場合はまだコミットされていない */
   int committed;
   
-  /*  */
-  int nr_cands;/* ο */
-  struct cand_ent **cands;/*  */
+  /* 候補の配列 */
+  int nr_cands;/* 候補の数 */
+  struct cand_ent **cands;/* 配列 */
 
   int from, len;/* len == str.len */
 
-  /* ʸι */
+  /* 文節の構成 */
   int nr_metaword;
   struct meta_word **mw_array;
 
-  /* Ӥɤä饹 */
+  /* 一番成績の良かったクラス */
   enum seg_class best_seg_class;
-  /* Ӥɤämeta_word
-   * mw_arrayˤ⡢ޤޤ뤳ȤԤǤ뤬ݾڤϤʤ */
+  /* 一番成績の良かったmeta_word
+   * mw_array中にも、含まれることが期待できるが、保証はしない */
   struct meta_word *best_mw;
 
   struct seg_ent *prev, *next;
 };
 
-/** ʸΥꥹ */
+/** 文節のリスト */
 struct segment_list {
   int nr_segments;
   struct seg_ent list_head;
 };
 
-/* (̵̤Ƥޤä) */
+/* 候補を解放する(無駄に生成してしまったもの等) */
 void anthy_release_cand_ent(struct cand_ent *s);
 
 /**/
@@ -92,7 +96,7 @@ struct seg_ent *anthy_get_nth_segment(struct segment_list *c, int );
 void anthy_print_candidate(struct cand_ent *ce);
 
 /* compose.c */
-/* Ф */
+/* 候補を作り出す */
 struct splitter_context;
 void anthy_do_make_candidates(struct splitter_context *sc,
 			      struct seg_ent *e, int is_reverse);
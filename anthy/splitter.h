@@ -1,4 +1,4 @@
-/* splitter⥸塼Υ󥿡ե */
+/* splitterモジュールのインターフェイス */
 #ifndef _splitter_h_included_
 #define _splitter_h_included_
 
@@ -7,56 +7,60 @@
 #include <anthy/wtype.h>
 #include <anthy/segclass.h>
 
-/* ѥ᡼ */
+/* パラメータ */
 #define RATIO_BASE 256
 #define OCHAIRE_SCORE 5000000
 
-/** splitterΥƥȡ
- * ǽζ꤫anthy_contextβޤͭ
+/** splitterのコンテキスト．
+ * 最初の境界設定からanthy_contextの解放まで有効
  */
 struct splitter_context {
-  /** splitterǻѤ빽¤ */
+  /** splitter内部で使用する構造体 */
   struct word_split_info_cache *word_split_info;
+  /** ceなどの作業領域を確保してある文字数(末尾の分を含む) */
+  int nr_reserved;
   int char_count;
   int is_reverse;
   struct char_ent {
     xchar *c;
     int seg_border;
-    int initial_seg_len;/* ǽʸʬκݤˤϤޤäʸ᤬
-			   ФĹ */
+    int initial_seg_len;/* 最初の文節分割の際にここから始まった文節が
+			   あればその長さ */
+    int fixed_border;/* 再変換の元の文節の境界で、
+			最初の文節分割の際にはまたがない */
     enum seg_class best_seg_class;
-    struct meta_word* best_mw; /* ͥ褷ƻȤmetaword */
+    struct meta_word* best_mw; /* 一番優先して使いたいmetaword */
   }*ce;
 };
 
-/* Υåξ */
+/* 制約のチェックの状態 */
 enum constraint_stat {
   unchecked, ok, ng
 };
 
-/* ȤꤢŬ䤷Ƥߤ꤬Фʬह */
+/* とりあえず、適当に増やしてみて問題が出たら分類する */
 enum metaword_type {
-  /* ߡ : seginfoʤ */
+  /* ダミー : seginfoを持たない */
   MW_DUMMY,
-  /* wordlist0 or Ĵޤ */
+  /* wordlistを0個 or 一個含むもの */
   MW_SINGLE,
-  /* ̤metawordĤޤ: metaword +  ʤ :seginfomw1 */
+  /* 別のmetaword一個を含む: metaword + 句読点 など :seginfoはmw1から取る */
   MW_WRAP,
-  /* ʣƬ */
+  /* 複合語先頭 */
   MW_COMPOUND_HEAD,
-  /* ʣ */
+  /* 複合語用 */
   MW_COMPOUND,
-  /* ʣΰʸ */
+  /* 複合語の一文節 */
   MW_COMPOUND_LEAF,
-  /* ʣθġʸ礷ưĤʸȤƤߤ */
+  /* 複合語の中の個々の文節を結合して一つの文節としてみたもの */
   MW_COMPOUND_PART,
-  /* ưϢѷ + ƻ */
+  /* 動詞の連用形 + 形容詞 */
   MW_V_RENYOU_A,
-  /* ưϢѷ + ư */
+  /* 動詞の連用形 + 動詞 */
   MW_V_RENYOU_V,
-  /* ưϢѷ + ̾ */
+  /* 動詞の連用形 + 名詞 */
   MW_V_RENYOU_NOUN,
-  /*  */
+  /* 数字 */
   MW_NUMBER,
   /**/
   MW_OCHAIRE,
@@ -78,15 +82,15 @@ enum metaword_type {
 
 #define MW_FEATURE_OCHAIRE 0x80000000
 /*
- * meta_word: θоݤȤʤ
- * ñword_listޤΤ¾ˤĤμब롥
+ * meta_word: 境界の検索の対象となるもの
+ * 単一のword_listを含むものの他にいくつかの種類がある．
  * 
  */
 struct meta_word {
   int from, len;
-  /* λ˻Ѥ륹 */
+  /* 候補の生成の時に使用するスコア */
   int struct_score;
-  /* ξ */
+  /* 形式の情報 */
   int dep_word_hash;
   int yomi_hash;
   int mw_features;
@@ -94,7 +98,7 @@ struct meta_word {
   enum dep_class dep_class;
   /**/
   enum seg_class seg_class;
-  enum constraint_stat can_use; /* ȶ˸٤äƤʤ */
+  enum constraint_stat can_use; /* セグメント境界に跨がっていない */
   enum metaword_type type;
   struct word_list *wl;
   struct meta_word *mw1, *mw2;
@@ -102,7 +106,7 @@ struct meta_word {
 
   int nr_parts;
 
-  /* listΥ */
+  /* listのリンク */
   struct meta_word *next;
 };
 
@@ -112,14 +116,16 @@ void anthy_quit_splitter(void);
 void anthy_init_split_context(xstr *xs, struct splitter_context *, int is_reverse);
 /*
  * mark_border(context, l1, l2, r1);
- * l1r1δ֤ʸ򸡽Ф롢l1l2δ֤϶ˤʤ
+ * l1とr1の間の文節を検出する、ただしl1とl2の間は境界にしない。
  */
 void anthy_mark_border(struct splitter_context *, int from, int from2, int to);
 void anthy_commit_border(struct splitter_context *, int nr,
 		   struct meta_word **mw, int *len);
 void anthy_release_split_context(struct splitter_context *c);
+void anthy_reserve_split_context(struct splitter_context *c, int len);
+void anthy_free_split_context(struct splitter_context *c);
 
-/* Фʸξ */
+/* 作り出した文節の情報を取得する */
 int anthy_get_nr_metaword(struct splitter_context *, int from, int len);
 struct meta_word *anthy_get_nth_metaword(struct splitter_context *,
 					 int from, int len, int nth);
@@ -1,41 +1,91 @@
-/* 饤֥(libanthydic)
- * ξȤ
- * ե뼭ι¤
+/* 辞書ライブラリ(libanthydic)と
+ * 辞書生成の両方から使う
+ * ファイル辞書の構造
  */
 #ifndef _word_dic_h_included_
 #define _word_dic_h_included_
 
-/* ɤhashbit map礭 */
+/* 読みhashのbit mapの大きさ */
 #define YOMI_HASH_ARRAY_SIZE (65536*4)
 #define YOMI_HASH_ARRAY_SHIFT 3
 #define YOMI_HASH_ARRAY_BITS (1<<YOMI_HASH_ARRAY_SHIFT)
 
-/* Ѥhash */
+/* 汎用のhash */
 #define VERSATILE_HASH_SIZE (128*1024)
 
-/* 1ڡˤĤñ뤫 */
+/* 1ページ内にいくつの単語を入れるか */
 #define WORDS_PER_PAGE 64
 
-/** ե 
- * 饤֥
+/* 辞書ファイルのヘッダ中で、先頭にまとめた頻度の高い単語の
+ * エントリの大きさを格納する位置 */
+#define WORD_DIC_HOT_SIZE_INDEX 8
+
+/* 読みのBloom filter
+ * ヘッダ中のハッシュ関数の数とブロック数の位置、0ならば旧形式のbitmap
+ * 各読みのビットは一つのブロック(キャッシュラインの大きさ)に収める
+ */
+#define WORD_DIC_BLOOM_HASHES_INDEX 9
+#define WORD_DIC_BLOOM_BLOCKS_INDEX 10
+#define WORD_DIC_BLOOM_BLOCK_BITS 512
+#define WORD_DIC_BLOOM_MAX_HASHES 16
+/* anthy_xstr_hash_pair()の二つ目の値からi番目のビットの位置を得る */
+#define WORD_DIC_BLOOM_BIT(h2, i) \
+  (((h2) + (i) * (((h2) >> 16) | 1)) & (WORD_DIC_BLOOM_BLOCK_BITS - 1))
+
+/* 逆変換用の辞書の位置(この辞書の先頭からのオフセット、0ならば無し)
+ * 逆変換用の辞書も同じ形式で、逆変換でしか使わない単語はそちらにだけ入る */
+#define WORD_DIC_REVERSE_INDEX 11
+
+/* 単語エントリの形式(辞書ファイルのヘッダの2番目の値) */
+#define WORD_ENTRY_TEXT 0
+#define WORD_ENTRY_BINARY 1
+
+/* バイナリ形式の単語エントリのタグ */
+#define WORD_ENTRY_TAG 0x80
+/* 品詞のidと頻度が続く */
+#define WORD_ENTRY_HEADER 0x01
+/* 素性を持つ */
+#define WORD_ENTRY_FEATURE 0x02
+/* 複合語 */
+#define WORD_ENTRY_COMPOUND 0x04
+
+/** 辞書ファイル 
+ * 辞書ライブラリ用
  */
 struct word_dic {
-  /** ե뼫ΤΥݥ */
+  /** 辞書ファイル自体のポインタ */
   char *dic_file;
-  /** 񥨥ȥΥǥå(ͥåȥХȥ) */
+  /** 単独でmapした辞書ファイル(初期化時のanthy.dic中の辞書ならNULL) */
+  struct filemapping *mapping;
+  /** この辞書を使っているセッションの数 */
+  int nr_users;
+  /** 辞書エントリのインデックスの配列(ネットワークバイトオーダー) */
   int *entry_index;
-  /** 񥨥ȥ */
+  /** 辞書エントリ */
   char *entry;
-  /** ǥåؤΥǥå */
+  /** インデックスへのインデックス */
   int *page_index;
-  /** Υǥå */
+  /** 辞書のインデックス */
   char *page;
-  /** 㼭 */
+  /** 用例辞書 */
   char *uc_section;
 
-  /* ñ켭 */
+  /* 単語辞書 */
   int nr_pages;
+  /* Bloom filterのハッシュ関数の数とブロック数 */
+  int bloom_hashes;
+  int bloom_blocks;
+  /* 統計: 検索した読み、filterで除いた数、filterを通って辞書に無かった数 */
+  long nr_probes;
+  long nr_rejected;
+  long nr_false_positives;
+  /* 最後に統計を記録した時の検索した読みの数 */
+  long nr_logged_probes;
+  /* 単語エントリの形式 */
+  int entry_format;
   unsigned char *hash_ent;
+  /* 逆変換用の辞書 */
+  struct word_dic *reverse;
 };
 
 #endif
@@ -1,22 +1,22 @@
 /*
- * ʻη wtype_t 򰷤
+ * 品詞の型 wtype_t を扱う
  *
- * ñʻ򰷤
- * ñϼǤġ
- * *ʻ
- * *ʻ쥵֥
- * *ʻ쥵֥֥
- * *ѥ饹(CC)
- * *ѷ
- * *Ω줫ɤΥե饰
- * wtype_tϾ嵭ξ򤹤٤ƴޤࡣ
+ * 単語の品詞を扱う
+ * 単語は次の要素を持つ。
+ * *品詞
+ * *品詞サブタイプ
+ * *品詞サブサブタイプ
+ * *活用クラス(CC)
+ * *活用形
+ * *自立語かどうかのフラグ
+ * wtype_tは上記の情報をすべて含む。
  *
- * Ǥξܺ٤ˤĤƤ doc/POS򻲾Ȥ٤
+ * 各要素の詳細については doc/POSを参照すべし
  */
 #ifndef _wtype_h_included_
 #define _wtype_h_included_
 
-/*ʻ Part Of Speech */
+/*品詞 Part Of Speech */
 #define POS_NONE 0
 #define POS_NOUN 1
 #define POS_PRT 2
@@ -38,7 +38,7 @@
 #define POS_OPEN 18
 #define POS_CLOSE 19
 
-/* ѷ Conjugate Type */
+/* 活用形 Conjugate Type */
 #define CT_NONE 0
 #define CT_SYUSI 1
 #define CT_MIZEN 2
@@ -49,7 +49,7 @@
 #define CT_HEAD 7
 #define CT_MEISIKA 8
 
-/* ѥ饹 Conjugate Class */
+/* 活用クラス Conjugate Class */
 #define CC_NONE 0
 #define CC_K5 1
 #define CC_C5 2
@@ -73,26 +73,26 @@
 #define CC_AJV 20
 #define CC_SRV 21
 
-/* ʻ Class Of Speech */
+/* 副品詞 Class Of Speech */
 #define COS_NONE 0
-/* ̾ */
+/* 地名 */
 #define COS_CN 1
-/*  */
+/* 数詞 */
 #define COS_NN 2
-/* ̾ */
+/* 人名 */
 #define COS_JN 3
-/* ̾ */
+/* 団体名 */
 #define COS_KK 4
-/* Ƭ */
+/* 一般接頭辞・接尾辞 */
 #define COS_POSTFIX 5
-/* Ѥ */
+/* サ変の接尾辞 */
 #define COS_SVSUFFIX 6
 #define COS_CNSUFFIX 7
 #define COS_PREFIX 8
 #define COS_NR 9
 /**/
 
-/* ʻ Sub Class Of Speech*/
+/* 副々品詞 Sub Class Of Speech*/
 #define SCOS_NONE 0
 #define SCOS_FAMNAME 1
 #define SCOS_FSTNAME 2
@@ -154,16 +154,16 @@
 
 /* FLAGS */
 #define WF_NONE 0
-/* ưϢλ줬̾첽 */
+/* この動詞は連体詞が名詞化する */
 #define WF_MEISI 1
-/* ̾ */
+/* サ変名詞 */
 #define WF_SV 2
-/* Ω졢ʸΥȤʤ */
+/* 自立語、文節のコアとなる */
 #define WF_INDEP 4
-/* ư첽 ֡ľפʤ */
+/* 動詞化接尾辞 「〜直す」など */
 #define WF_VSUFFIX 8
 
-/* wtype_tΥեå */
+/* wtype_t中のオフセット */
 #define WT_POS 0
 #define WT_COS 1
 #define WT_SCOS 2
@@ -171,7 +171,7 @@
 #define WT_CT 4
 #define WT_FLAGS 5
 
-/* bit field */
+/* 各bit fieldの幅 */
 #define POS_BITS 5
 #define COS_BITS 4
 #define SCOS_BITS 7
@@ -180,7 +180,7 @@
 #define WF_BITS 4
 /* 29bits */
 
-/** ʻ */
+/** 品詞 */
 struct wtype{
   unsigned int pos  : POS_BITS;
   unsigned int cos  : COS_BITS;
@@ -192,16 +192,16 @@ struct wtype{
 
 typedef struct wtype wtype_t;
 
-/** anthy_wtype_include(̾졢̾)Ͽդϵ */
+/** anthy_wtype_include(名詞、人名)は真、逆は偽 */
 int anthy_wtype_include(wtype_t haystack, wtype_t needle);
 
-/* Ĥʻ줬˰פ뤫ɤ򸫤 */
+/* 二つの品詞が完全に一致するかどうかを見る */
 int anthy_wtype_equal(wtype_t lhs, wtype_t rhs);
 
 void anthy_print_wtype(wtype_t w);
-/* ե̾ʻ(ؿ̾) */
+/* 辞書ファイル中の名前から品詞を得る(関数名が悪い) */
 const char *anthy_type_to_wtype(const char *name, wtype_t *w);
-/* ʻ̾ʻ */
+/* 品詞の名前から品詞を得る */
 wtype_t anthy_init_wtype_by_name(const char *str);
 
 #define WT_COMPOUND 255
@@ -215,7 +215,7 @@ int anthy_wtype_get_cos(wtype_t w);
 int anthy_wtype_get_scos(wtype_t w);
 int anthy_wtype_get_wf(wtype_t w);
 
-/* ե饰μ */
+/* フラグの取得 */
 int anthy_wtype_get_indep(wtype_t w);
 int anthy_wtype_get_sv(wtype_t w);
 int anthy_wtype_get_meisi(wtype_t w);
@@ -233,8 +233,8 @@ void anthy_wtype_set_dep(wtype_t *w, int isDep);
 
 void anthy_init_wtypes(void);
 
-extern wtype_t anthy_wt_all;/* ٤Ƥ˥ޥå뼫Ω */
-extern wtype_t anthy_wt_none;/* ʻ̵POS_INVAL */
-extern wtype_t anthy_wt_t35;/* ̾ */
+extern wtype_t anthy_wt_all;/* すべてにマッチする自立語 */
+extern wtype_t anthy_wt_none;/* 品詞無しPOS_INVAL */
+extern wtype_t anthy_wt_t35;/* 名詞 */
 
 #endif
@@ -1,70 +1,70 @@
 /*
- * AnthyǻȤʸ
- * ä˼ä褦ȤƤ櫓Ǥ̵Τǡ
- * ˤؿλѤ϶ʤ
+ * Anthy内部で使う文字列
+ * 特に実装を隠蔽しようとしているわけでは無いので、
+ * ここにある関数の使用は強制しない。
  */
 #ifndef _xstr_h_included_
 #define _xstr_h_included_
 
-/** ʸ
- * UCS4äƤ */
+/** 文字型
+ * UCS4が入っている */
 typedef int xchar;
 
-/** ʸ
- * xstrtypedefƤ
+/** 文字列
+ * xstrにtypedefされている
  */
 typedef struct xstr_ {
-  /** ʸؤΥݥ */
+  /** 文字列へのポインタ */
   xchar *str;
-  /** xcharο */
+  /** xcharの数 */
   int len;
 } xstr;
 
-/* ǥХåѤνϴؿ */
+/* デバッグ用の出力関数 */
 void anthy_putxchar(xchar );
 void anthy_putxstr(xstr *);
 void anthy_putxstrln(xstr *);
 
-/* Cʸؤν񤭽Ф */
+/* Cの文字列への書き出し */
 int anthy_sputxchar(char *, xchar , int encoding);
 int anthy_sputxstr(char *, xstr *, int encoding);
 int anthy_snputxstr(char *, int , xstr *, int encoding);
 
-/* xstrstrmalloc롢freeξ뤫anthy_free_xstrǲ */
+/* xstrとstr共にmallocされる、freeで両方解放するかanthy_free_xstrで解放する */
 xstr *anthy_cstr_to_xstr(const char *, int );
-/* ̤mallocǳݤ */
+/* 結果はmallocで確保される */
 char *anthy_xstr_to_cstr(xstr *, int);
 
-/* xstrstrmalloc */
+/* xstrとstr共にmallocされる */
 xstr *anthy_xstr_dup(xstr *);
 void anthy_free_xstr(xstr *);
 
-/* ̤mallocǳݤ */
+/* 結果はmallocで確保される */
 xchar *anthy_xstr_dup_str(xstr *);
 void anthy_free_xstr_str(xstr *);
 
-/* ʸ򥳥ԡ */
+/* 文字列をコピーする */
 xstr* anthy_xstrcpy(xstr *, xstr *);
-/* ʸӤ롣strcmpƱư(֤ͤ˰̣) */
+/* 文字列を比較する。strcmpと同等の動作(返り値の符号に意味がある) */
 int anthy_xstrcmp(xstr *, xstr *);
-/* nʸܤޤʸӤ롣strncmpƱư(֤ͤ˰̣) */
+/* n文字目まで文字列を比較する。strncmpと同等の動作(返り値の符号に意味がある) */
 int anthy_xstrncmp(xstr *, xstr *, int);
-/* s->strrealloc */
+/* s->strをreallocする */
 xstr *anthy_xstrcat(xstr *s, xstr *d);
-/* xs->strrealloc */
+/* xs->strをreallocする */
 xstr *anthy_xstrappend(xstr *xs, xchar c);
 
-/* strtollxstr */
+/* strtollのxstr版 */
 long long anthy_xstrtoll(xstr *);
-/* ѿȾѿؤѴ */
+/* 全角数字から半角数字への変換 */
 xstr *anthy_xstr_wide_num_to_num(xstr *);
-/* Ҥ餬ʤ饫ʤؤѴ */
+/* ひらがなからカタカナへの変換 */
 xstr *anthy_xstr_hira_to_kata(xstr *);
 /**/
 xstr *anthy_xstr_hira_to_half_kata(xstr *);
 xstr *anthy_conv_half_wide(xstr *xs);
 
-/*  xcharη */
+/*  xcharの型 */
 #define XCT_ALL 0xffffffff
 #define XCT_NONE 0
 #define XCT_HIRA 1
@@ -74,24 +74,25 @@ xstr *anthy_conv_half_wide(xstr *xs);
 #define XCT_WIDENUM 16
 #define XCT_OPEN 32
 #define XCT_CLOSE 64
-/* ľʸΰ */
+/* 直前の文字の一部 */
 #define XCT_PART 128
-/*  */
+/* 助詞 */
 #define XCT_DEP 256
-/*  */
+/* 記号 */
 #define XCT_SYMBOL 1024
-/*  */
+/* 漢字 */
 #define XCT_KANJI 2048
-/*  */
+/* 句読点 */
 #define XCT_PUNCTUATION 4096
 
-/** XCT_*֤äƤ */
+/** XCT_*が返ってくる */
 int anthy_get_xchar_type(const xchar );
-/** ƤʸФXCT_*ѤȤä */
+/** 全ての文字に対してXCT_*の論理積をとったもの */
 int anthy_get_xstr_type(const xstr *);
 
 /* hash */
 int anthy_xstr_hash(xstr *);
+unsigned int anthy_xstr_hash_pair(xstr *, unsigned int *);
 
 /* xstr.c */
 int anthy_init_xstr(void);
@@ -8,6 +8,12 @@
  *
  * generate transition matrix
  *
+ * -j で並列数を指定すると、入力ファイルを文の切れ目(eos)で区切った断片を
+ * 子プロセスで読み込み、各断片の素性の数え上げを一時ファイル経由で
+ * 親プロセスが順にマージする。結果は逐次に読み込んだ場合と同じになる。
+ * 素性の数え上げと全文のコーパスは親プロセスのメモリ上に全て持つので、
+ * メモリに収まらない大きさのコーパスは扱えない。
+ *
  * Copyright (C) 2006 HANAOKA Toshiyuki
  * Copyright (C) 2006-2007 TABATA Yusuke
  *
@@ -27,6 +33,10 @@
   License along with this library; if not, write to the Free Software
   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
  */
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -37,6 +47,7 @@
 #include <anthy/feature_set.h>
 #include <anthy/diclib.h>
 #include "input_set.h"
+#include "tmpfile.h"
 #include <anthy/corpus.h>
 
 #define FEATURE_SET_SIZE NR_EM_FEATURES
@@ -81,6 +92,21 @@ struct input_info {
   /* 入力された例文の量に関する情報 */
   int nr_sentences;
   int nr_connections;
+
+  /* 子プロセスで読み込み中は全文検索用の例文をここへ書き出す */
+  FILE *corpus_out;
+};
+
+/* 子プロセスで読み込むファイルの断片 */
+struct shard {
+  const char *fn;
+  long start;
+  long len;
+  /* 読み込んだ結果を書き出すファイル */
+  FILE *out;
+  /* 子プロセスのpidと終了コード */
+  pid_t pid;
+  int status;
 };
 
 static struct input_info *
@@ -103,6 +129,7 @@ init_input_info(void)
   m->missed_cand_features.len = 0;
   m->nr_sentences = 0;
   m->nr_connections = 0;
+  m->corpus_out = NULL;
   return m;
 }
 
@@ -238,21 +265,31 @@ complete_sentence_info(struct input_info *m, struct sentence_info *sinfo)
       nr ++;
       */
     }
-    corpus_push_back(m->indep_corpus, buf, nr, flags);
+    if (m->corpus_out) {
+      /* 親プロセスで同じ順序でcorpus_push_backする */
+      fwrite(&nr, sizeof(int), 1, m->corpus_out);
+      fwrite(&flags, sizeof(int), 1, m->corpus_out);
+      fwrite(buf, sizeof(int), nr, m->corpus_out);
+    } else {
+      corpus_push_back(m->indep_corpus, buf, nr, flags);
+    }
   }
 }
 
+/* fpからlenバイト(負ならファイルの終わりまで)読む */
 static void
-do_read_file(struct input_info *m, FILE *fp)
+do_read_file(struct input_info *m, FILE *fp, long len)
 {
   char line[1024];
   struct sentence_info sinfo;
+  long pos = 0;
 
   init_sentence_info(&sinfo);
 
-  while (fgets(line, 1024, fp)) {
+  while ((len < 0 || pos < len) && fgets(line, 1024, fp)) {
     char *buf = line;
     int error_class = 0;
+    pos += strlen(line);
     if (!strncmp(buf, "eos", 3)) {
       m->nr_sentences ++;
       complete_sentence_info(m, &sinfo);
@@ -278,10 +315,212 @@ read_file(struct input_info *m, char *fn)
   if (!ifp) {
     return ;
   }
-  do_read_file(m, ifp);
+  do_read_file(m, ifp, -1);
   fclose(ifp);
 }
 
+/* offの後で最初のeosの行の次の位置を返す */
+static long
+find_sentence_boundary(FILE *fp, long off, long size)
+{
+  char line[1024];
+  int line_head;
+  if (off <= 0) {
+    return 0;
+  }
+  if (off >= size || fseek(fp, off - 1, SEEK_SET)) {
+    return size;
+  }
+  /* off-1が改行ならoffは行頭 */
+  line_head = (fgetc(fp) == '\n');
+  while (fgets(line, 1024, fp)) {
+    int eos = line_head && !strncmp(line, "eos", 3);
+    line_head = (line[strlen(line) - 1] == '\n');
+    if (eos) {
+      /* 行の残りを読み飛ばす */
+      while (!line_head && fgets(line, 1024, fp)) {
+	line_head = (line[strlen(line) - 1] == '\n');
+      }
+      return ftell(fp);
+    }
+  }
+  return size;
+}
+
+/* 各ファイルをnr_parts個ずつの断片に分ける */
+static struct shard *
+make_shards(int nr_fn, char **fns, int nr_parts, int *nr_shards)
+{
+  struct shard *shards = NULL;
+  int i, j, nr = 0;
+  for (i = 0; i < nr_fn; i++) {
+    struct stat st;
+    FILE *fp;
+    long prev = 0;
+    if (stat(fns[i], &st) || !(fp = fopen(fns[i], "r"))) {
+      continue;
+    }
+    for (j = 1; j <= nr_parts; j++) {
+      long next = (j == nr_parts) ? (long)st.st_size :
+	find_sentence_boundary(fp, (long)st.st_size / nr_parts * j,
+			       (long)st.st_size);
+      if (next <= prev) {
+	continue;
+      }
+      shards = realloc(shards, sizeof(struct shard) * (nr + 1));
+      shards[nr].fn = fns[i];
+      shards[nr].start = prev;
+      shards[nr].len = next - prev;
+      nr ++;
+      prev = next;
+    }
+    fclose(fp);
+  }
+  *nr_shards = nr;
+  return shards;
+}
+
+/* 断片を読み込んで結果をsh->outに書き出す、子プロセスで実行される */
+static int
+read_shard(struct shard *sh)
+{
+  struct input_info *m = init_input_info();
+  FILE *ifp = fopen(sh->fn, "r");
+  int end = -1;
+  if (!ifp || fseek(ifp, sh->start, SEEK_SET)) {
+    return 1;
+  }
+  m->corpus_out = sh->out;
+  do_read_file(m, ifp, sh->len);
+  fclose(ifp);
+  /* 例文の終わり */
+  fwrite(&end, sizeof(int), 1, sh->out);
+  fwrite(&m->nr_sentences, sizeof(int), 1, sh->out);
+  fwrite(&m->nr_connections, sizeof(int), 1, sh->out);
+  input_set_write(m->raw_cand_is, sh->out);
+  input_set_write(m->raw_seg_is, sh->out);
+  if (fflush(sh->out) || ferror(sh->out)) {
+    return 1;
+  }
+  return 0;
+}
+
+/* 子プロセスの書き出した結果をmに加える */
+static int
+merge_shard(struct input_info *m, struct shard *sh)
+{
+  int nr, flags, n[2];
+  int buf[16];
+  rewind(sh->out);
+  while (fread(&nr, sizeof(int), 1, sh->out) == 1 && nr >= 0) {
+    if (nr > 16 ||
+	fread(&flags, sizeof(int), 1, sh->out) != 1 ||
+	fread(buf, sizeof(int), nr, sh->out) != (size_t)nr) {
+      return -1;
+    }
+    corpus_push_back(m->indep_corpus, buf, nr, flags);
+  }
+  if (fread(n, sizeof(int), 2, sh->out) != 2) {
+    return -1;
+  }
+  m->nr_sentences += n[0];
+  m->nr_connections += n[1];
+  if (input_set_merge(m->raw_cand_is, sh->out) ||
+      input_set_merge(m->raw_seg_is, sh->out)) {
+    return -1;
+  }
+  return 0;
+}
+
+static void
+start_worker(struct shard *sh)
+{
+  sh->pid = fork();
+  if (sh->pid == 0) {
+    _exit(read_shard(sh));
+  }
+  if (sh->pid < 0) {
+    /* forkできなければ自分で読み込む */
+    sh->status = read_shard(sh);
+  }
+}
+
+/* 子プロセスの終了を待つ */
+static void
+wait_worker(struct shard *shards, int nr)
+{
+  int status, i;
+  pid_t pid = wait(&status);
+  if (pid < 0) {
+    return ;
+  }
+  for (i = 0; i < nr; i++) {
+    if (shards[i].pid == pid) {
+      if (WIFEXITED(status)) {
+	shards[i].status = WEXITSTATUS(status);
+      } else {
+	shards[i].status = 1;
+      }
+      shards[i].pid = -1;
+      return ;
+    }
+  }
+}
+
+static int
+count_running_workers(struct shard *shards, int nr)
+{
+  int i, n = 0;
+  for (i = 0; i < nr; i++) {
+    if (shards[i].pid > 0) {
+      n ++;
+    }
+  }
+  return n;
+}
+
+/* 入力ファイルを断片に分けてnr_jobs個の子プロセスで読み込む */
+static void
+read_files_in_parallel(struct input_info *m, int nr_fn, char **fns,
+		       int nr_jobs)
+{
+  struct shard *shards;
+  int i, nr;
+
+  shards = make_shards(nr_fn, fns, nr_jobs, &nr);
+  /* 子プロセスで二重に出力されないようにする */
+  fflush(stdout);
+  fflush(stderr);
+  for (i = 0; i < nr; i++) {
+    shards[i].out = open_tmpfile();
+    if (!shards[i].out) {
+      fprintf(stderr, "failed to open temporary file\n");
+      exit(1);
+    }
+    shards[i].pid = -1;
+    shards[i].status = 0;
+  }
+  for (i = 0; i < nr; i++) {
+    while (count_running_workers(shards, nr) >= nr_jobs) {
+      wait_worker(shards, nr);
+    }
+    start_worker(&shards[i]);
+  }
+  while (count_running_workers(shards, nr) > 0) {
+    wait_worker(shards, nr);
+  }
+
+  /* 元のファイルの順にマージする */
+  for (i = 0; i < nr; i++) {
+    if (shards[i].status || merge_shard(m, &shards[i])) {
+      fprintf(stderr, "failed to read (%s)\n", shards[i].fn);
+      exit(1);
+    }
+    fclose(shards[i].out);
+  }
+  free(shards);
+}
+
 static void
 dump_line(FILE *ofp, struct input_line *il)
 {
@@ -405,15 +644,19 @@ extract_is(struct input_set *src_is, struct input_set *dst_is, int type,
 
 /* 変換結果から確率のテーブルを作る */
 static void
-proc_corpus(int nr_fn, char **fns, FILE *ofp)
+proc_corpus(int nr_fn, char **fns, FILE *ofp, int nr_jobs)
 {
   int i;
   struct input_info *iinfo;
   /**/
   iinfo = init_input_info();
   /**/
-  for (i = 0; i < nr_fn; i++) {
-    read_file(iinfo, fns[i]);
+  if (nr_jobs > 1) {
+    read_files_in_parallel(iinfo, nr_fn, fns, nr_jobs);
+  } else {
+    for (i = 0; i < nr_fn; i++) {
+      read_file(iinfo, fns[i]);
+    }
   }
 
   /* 全文検索のデータベースを作る */
@@ -439,6 +682,7 @@ main(int argc, char **argv)
   FILE *ofp;
   int i;
   int nr_input = 0;
+  int nr_jobs = 1;
   char **input_files;
 
   ofp = NULL;
@@ -453,6 +697,9 @@ main(int argc, char **argv)
 	fprintf(stderr, "failed to open (%s)\n", argv[i+1]);
       }
       i ++;
+    } else if (!strcmp(arg, "-j") && i + 1 < argc) {
+      nr_jobs = atoi(argv[i+1]);
+      i ++;
     } else {
       input_files[nr_input] = arg;
       nr_input ++;
@@ -461,7 +708,7 @@ main(int argc, char **argv)
   if (ofp) {
     /* コーパスからテキスト形式の辞書を作る */
     printf(" -- generating dictionary in text form\n");
-    proc_corpus(nr_input, input_files, ofp);
+    proc_corpus(nr_input, input_files, ofp, nr_jobs);
     fclose(ofp);
   }
 
@@ -1,6 +1,6 @@
 /*
- * ʸ򸡺Ǥǡ¤
- * Ǥʸ򤹤٤Ƥ뤬Τե륿뤳Ȥͤ
+ * 例文の中を検索できるデータ構造を作る
+ * 現時点では例文をすべて入れているが、そのうちフィルターすることも考えられる
  *
  * Copyright (C) 2007 TABATA Yusuke
  *
@@ -40,11 +40,11 @@ struct node {
 
 /* word feature in corpus file */
 struct element {
-  /* hash */
+  /* hash値 */
   int val;
-  /* ͭ(ELM_INVALID̵)ȥȤƤindex */
+  /* 有効な(ELM_INVALIDの無い)エントリとしてのindex */
   int idx;
-  /* hashͤμνи */
+  /* このhash値の次の出現場所 */
   int next_idx;
   /**/
   int flags;
@@ -52,23 +52,23 @@ struct element {
 
 /* index */
 struct bucket {
-  /* Υ */
+  /* 検索のキー */
   int key;
-  /* ǽνи */
+  /* 最初の出現場所 */
   int first_idx;
   /**/
   int last_idx;
 };
 
 struct corpus {
-  /* ʸΤ */
+  /* 例文全体の配列 */
   struct node *array;
   int nr_node;
   int array_size;
-  /* Ʊʸʤ */
+  /* 同じ例文を入れないための配列 */
   int *node_hash_mask_array;
 
-  /* ХåȤι¤ */
+  /* バケットと配列の構造 */
   int nr_values;
   struct element *elms;
   /**/
@@ -214,7 +214,7 @@ corpus_build_link(struct corpus *c)
       continue;
     }
     if (bkt->first_idx < 0) {
-      /* ǽνи */
+      /* 最初の出現 */
       bkt->first_idx = c->elms[i].idx;
     } else {
       c->elms[bkt->last_idx].next_idx = c->elms[i].idx;
@@ -257,7 +257,7 @@ check_dup(struct corpus *c, struct node *nd)
   idx = h / 32;
   s = h % 32;
   if (c->node_hash_mask_array[idx] & (1 << s)) {
-    /* ʣ */
+    /* 重複 */
     return 1;
   }
   c->node_hash_mask_array[idx] |= (1 << s);
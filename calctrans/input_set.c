@@ -1,4 +1,4 @@
-/* ϤΥåȤ륳
+/* 入力のセットを管理するコード
  *
  * Copyright (C) 2006 HANAOKA Toshiyuki
  * Copyright (C) 2006-2007 TABATA Yusuke
@@ -12,31 +12,34 @@
 #include <math.h>
 #include "input_set.h"
 
-#define HASH_SIZE 1024
+/* ハッシュの大きさの初期値(2の冪) */
+#define INITIAL_HASH_SIZE 1024
 
 struct input_set {
   /**/
   struct input_line *lines;
-  struct input_line *buckets[HASH_SIZE];
+  struct input_line **buckets;
+  int nr_buckets;
+  int nr_lines;
   /**/
 };
 
-static int
+static unsigned int
 line_hash(const int *ar, int nr)
 {
   int i;
-  unsigned h = 0;
+  unsigned int h = 0;
   for (i = 0; i < nr; i++) {
-    h += ar[i];
+    h = (h ^ (unsigned int)ar[i]) * 16777619U;
   }
-  return (h % HASH_SIZE);
+  return h ^ (h >> 15);
 }
 
 static struct input_line *
 find_same_line(struct input_set *is, int *features, int nr)
 {
   struct input_line *il;
-  int h = line_hash(features, nr);
+  int h = line_hash(features, nr) & (is->nr_buckets - 1);
   for (il = is->buckets[h]; il; il = il->next_in_hash) {
     int i;
     if (il->nr_features != nr) {
@@ -54,6 +57,22 @@ find_same_line(struct input_set *is, int *features, int nr)
   return NULL;
 }
 
+/* 行の数に合わせてハッシュを大きくする */
+static void
+grow_buckets(struct input_set *is)
+{
+  struct input_line *il;
+  int h;
+  free(is->buckets);
+  is->nr_buckets *= 2;
+  is->buckets = calloc(is->nr_buckets, sizeof(struct input_line *));
+  for (il = is->lines; il; il = il->next_line) {
+    h = line_hash(il->features, il->nr_features) & (is->nr_buckets - 1);
+    il->next_in_hash = is->buckets[h];
+    is->buckets[h] = il;
+  }
+}
+
 static struct input_line *
 add_line(struct input_set *is, int *features, int nr)
 {
@@ -70,14 +89,19 @@ add_line(struct input_set *is, int *features, int nr)
   /* link */
   il->next_line = is->lines;
   is->lines = il;
+  is->nr_lines ++;
+  if (is->nr_lines > is->nr_buckets) {
+    grow_buckets(is);
+    return il;
+  }
   /**/
-  h = line_hash(features, nr);
+  h = line_hash(features, nr) & (is->nr_buckets - 1);
   il->next_in_hash = is->buckets[h];
   is->buckets[h] = il;
   return il;
 }
 
-/* input_setϤĲä */
+/* input_setに入力を一つ加える */
 void
 input_set_set_features(struct input_set *is, int *features,
 		       int nr, int weight)
@@ -109,8 +133,11 @@ input_set_create(void)
   struct input_set *is;
   is = malloc(sizeof(struct input_set));
   is->lines = NULL;
+  is->nr_lines = 0;
   /**/
-  for (i = 0; i < HASH_SIZE; i++) {
+  is->nr_buckets = INITIAL_HASH_SIZE;
+  is->buckets = malloc(sizeof(struct input_line *) * is->nr_buckets);
+  for (i = 0; i < is->nr_buckets; i++) {
     is->buckets[i] = NULL;
   }
   /**/
@@ -140,3 +167,43 @@ input_set_filter(struct input_set *is,
   }
   return new_is;
 }
+
+/* input_setの内容を別のプロセスで読み込めるように書き出す */
+void
+input_set_write(struct input_set *is, FILE *fp)
+{
+  struct input_line *il;
+  fwrite(&is->nr_lines, sizeof(int), 1, fp);
+  for (il = is->lines; il; il = il->next_line) {
+    fwrite(&il->weight, sizeof(int), 1, fp);
+    fwrite(&il->negative_weight, sizeof(int), 1, fp);
+    fwrite(&il->nr_features, sizeof(int), 1, fp);
+    fwrite(il->features, sizeof(int), il->nr_features, fp);
+  }
+}
+
+/* input_set_writeで書き出した内容をisに加える */
+int
+input_set_merge(struct input_set *is, FILE *fp)
+{
+  int i, nr, h[3];
+  int *features = NULL;
+  if (fread(&nr, sizeof(int), 1, fp) != 1) {
+    return -1;
+  }
+  for (i = 0; i < nr; i++) {
+    if (fread(h, sizeof(int), 3, fp) != 3 || h[2] < 0) {
+      free(features);
+      return -1;
+    }
+    features = realloc(features, sizeof(int) * (h[2] + 1));
+    if (fread(features, sizeof(int), h[2], fp) != (size_t)h[2]) {
+      free(features);
+      return -1;
+    }
+    input_set_set_features(is, features, h[2], h[0]);
+    input_set_set_features(is, features, h[2], -h[1]);
+  }
+  free(features);
+  return 0;
+}
@@ -26,6 +26,8 @@ struct input_set *input_set_filter(struct input_set *is,
 				   double pos, double neg);
 /**/
 struct input_line *input_set_get_input_line(struct input_set *is);
+void input_set_write(struct input_set *is, FILE *fp);
+int input_set_merge(struct input_set *is, FILE *fp);
 
 
 struct int_map *int_map_new(void);
@@ -6,14 +6,21 @@
  *  まず伸縮を行った文節が最初の長さで出力される
  *  次に各文節毎に(あれば)誤った候補、正しい候補の順で情報を出力する
  *
+ * -j で並列数を指定すると、例文を連続した区間に分けて子プロセスで処理し、
+ * 出力を元の順に連結する。各子プロセスは同じ学習状態から始めるので、
+ * 確定による学習の影響は区間をまたがない。
  *
  * Copyright (C) 2006-2007 TABATA Yusuke
  *
  */
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <anthy/convdb.h>
+#include "tmpfile.h"
 
 static int verbose;
 
@@ -223,14 +230,125 @@ proc_sentence(anthy_context_t ac, struct conv_res *cr, FILE *ofp)
   print_context_info(ac, cr);
 }
 
+/* 出力を連結する */
+static void
+append_output(FILE *in, FILE *out)
+{
+  char buf[BUFSIZ];
+  size_t nread;
+  rewind(in);
+  while ((nread = fread(buf, 1, sizeof(buf), in)) > 0) {
+    fwrite(buf, 1, nread, out);
+  }
+}
+
+/* first番目からnr個(負なら最後まで)の例文を処理する */
+static void
+proc_sentences(struct res_db *db, int first, int nr, FILE *err_fp)
+{
+  anthy_context_t ac;
+  struct conv_res *cr;
+  int i;
+
+  ac = anthy_create_context();
+  for (cr = db->res_list.next, i = 0; cr && i < first; cr = cr->next, i++);
+  for (; cr && (nr < 0 || i < first + nr); cr = cr->next, i++) {
+    /*fprintf(stderr, "%d:%s\n", i, cr->res_str);*/
+    proc_sentence(ac, cr, err_fp);
+    if (!(i % 100)) {
+      fprintf(stderr, "%d\n", i);
+    }
+  }
+  anthy_release_context(ac);
+}
+
+/* 例文をnr_jobs個の区間に分けて子プロセスで処理する
+ * 各プロセスは前の区間での学習結果を引き継がないので、
+ * 逐次処理とは出力が異なることがある
+ */
+static void
+proc_sentences_in_parallel(struct res_db *db, int nr_jobs, FILE *err_fp)
+{
+  struct conv_res *cr;
+  FILE **outs, **errs;
+  pid_t *pids;
+  int i, nr = 0, failed = 0;
+
+  for (cr = db->res_list.next; cr; cr = cr->next) {
+    nr ++;
+  }
+  outs = malloc(sizeof(FILE *) * nr_jobs);
+  errs = malloc(sizeof(FILE *) * nr_jobs);
+  pids = malloc(sizeof(pid_t) * nr_jobs);
+  /* 子プロセスで二重に出力されないようにする */
+  fflush(stdout);
+  fflush(stderr);
+  for (i = 0; i < nr_jobs; i++) {
+    int first = (int)((long)nr * i / nr_jobs);
+    int last = (int)((long)nr * (i + 1) / nr_jobs);
+    outs[i] = open_tmpfile();
+    errs[i] = err_fp ? open_tmpfile() : NULL;
+    if (!outs[i] || (err_fp && !errs[i])) {
+      fprintf(stderr, "failed to open temporary file\n");
+      exit(1);
+    }
+    pids[i] = fork();
+    if (pids[i] == 0) {
+      /* 標準出力を一時ファイルに向ける */
+      dup2(fileno(outs[i]), 1);
+      proc_sentences(db, first, last - first, errs[i]);
+      fflush(stdout);
+      if (errs[i]) {
+	fflush(errs[i]);
+      }
+      _exit(0);
+    }
+    if (pids[i] < 0) {
+      /* forkできなければ自分で処理する、連結の順序を保つために
+	 出力は同じように一時ファイルに向ける */
+      int saved_stdout = dup(1);
+      fflush(stdout);
+      dup2(fileno(outs[i]), 1);
+      proc_sentences(db, first, last - first, errs[i]);
+      fflush(stdout);
+      dup2(saved_stdout, 1);
+      close(saved_stdout);
+    }
+  }
+  for (i = 0; i < nr_jobs; i++) {
+    int status;
+    if (pids[i] > 0 &&
+	(waitpid(pids[i], &status, 0) < 0 ||
+	 !WIFEXITED(status) || WEXITSTATUS(status))) {
+      failed = 1;
+    }
+  }
+  if (failed) {
+    fprintf(stderr, "proccorpus: a worker process failed\n");
+    exit(1);
+  }
+  /* 元の順に連結する */
+  for (i = 0; i < nr_jobs; i++) {
+    append_output(outs[i], stdout);
+    if (errs[i]) {
+      append_output(errs[i], err_fp);
+    }
+    fclose(outs[i]);
+    if (errs[i]) {
+      fclose(errs[i]);
+    }
+  }
+  free(outs);
+  free(errs);
+  free(pids);
+}
+
 int
 main(int argc, char **argv)
 {
   struct res_db *db;
-  struct conv_res *cr;
-  anthy_context_t ac;
   FILE *err_fp = NULL;
-  int i, nr;
+  int i, nr_jobs = 1;
 
   db = create_db();
   for (i = 1; i < argc; i++) {
@@ -239,6 +357,9 @@ main(int argc, char **argv)
     } else if (!strcmp("-e", argv[i]) && i < argc - 1) {
       err_fp = fopen(argv[i+1], "w");
       i++;
+    } else if (!strcmp("-j", argv[i]) && i < argc - 1) {
+      nr_jobs = atoi(argv[i+1]);
+      i++;
     } else {
       read_db(db, argv[i]);
     }
@@ -248,18 +369,11 @@ main(int argc, char **argv)
   anthy_conf_override("DIC_FILE", "../mkanthydic/anthy.dic");
   anthy_init();
   anthy_set_personality("");
-  ac = anthy_create_context();
 
-  /**/
-  nr = 0;
-  /**/
-  for (cr = db->res_list.next; cr; cr = cr->next) {
-    /*fprintf(stderr, "%d:%s\n", nr, cr->res_str);*/
-    proc_sentence(ac, cr, err_fp);
-    if (!(nr % 100)) {
-      fprintf(stderr, "%d\n", nr);
-    }
-    nr ++;
+  if (nr_jobs > 1) {
+    proc_sentences_in_parallel(db, nr_jobs, err_fp);
+  } else {
+    proc_sentences(db, 0, -1, err_fp);
   }
   return 0;
 }
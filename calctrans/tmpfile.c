@@ -0,0 +1,36 @@
+/* 子プロセスの結果を受け渡す一時ファイル
+ *
+ * tmpfile()はTMPDIRを見ないので、TMPDIRが指定された場合は
+ * mkworddicと同じようにmkstempで作る
+ *
+ * Copyright (C) 2006-2007 TABATA Yusuke
+ *
+ */
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "tmpfile.h"
+
+FILE *
+open_tmpfile(void)
+{
+  char *tmpdir = getenv("TMPDIR");
+  char buf[256];
+  FILE *fp;
+  int fd;
+  if (!tmpdir) {
+    return tmpfile();
+  }
+  snprintf(buf, sizeof(buf), "%s/calctrans.XXXXXX", tmpdir);
+  fd = mkstemp(buf);
+  if (fd == -1) {
+    return NULL;
+  }
+  /* 開いたままなので名前は要らない */
+  unlink(buf);
+  fp = fdopen(fd, "w+");
+  if (!fp) {
+    close(fd);
+  }
+  return fp;
+}
@@ -0,0 +1,10 @@
+/**/
+#ifndef _tmpfile_h_included_
+#define _tmpfile_h_included_
+
+#include <stdio.h>
+
+/* TMPDIRの下に一時ファイルを作る、失敗したらNULLを返す */
+FILE *open_tmpfile(void);
+
+#endif
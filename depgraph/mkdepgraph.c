@@ -3,9 +3,9 @@
  * Copyright (C) 2004-2006 YOSHIDA Yuichi
  */
 /*
- * °쥰դХʥ경
+ * 付属語グラフをバイナリ化する
  * init_word_seq_tab()
- *   °ơ֥ΥΡɤؤΥݥ󥿤ν
+ *   付属語テーブル中のノードへのポインタの初期化
  */
 /*
   This library is free software; you can redistribute it and/or
@@ -47,39 +47,50 @@ static struct dep_node* gNodes;
 static char** gNodeNames;
 static int nrNodes;
 
-/* ñ³롼 */
+/* 単語接続ルール */
 static struct wordseq_rule *gRules;
 static int nrRules;
 
+/* 遷移条件のトライの状態 */
+struct trie_state {
+  int nr_edges;
+  struct dep_edge *edges;
+  int nr_accepts;
+  struct dep_accept *accepts;
+};
+static struct trie_state *gStates;
+static int nrStates;
+
 static int 
 get_node_id_by_name(const char *name)
 {
   int i;
-  /* ϿѤߤΤΤõ */
+  /* 登録済みのものから探す */
   for (i = 0; i < nrNodes; i++) {
     if (!strcmp(name,gNodeNames[i])) {
       return i;
     }
   }
-  /* ʤäΤǺ */
+  /* なかったので作る */
   gNodes = realloc(gNodes, sizeof(struct dep_node)*(nrNodes+1));
   gNodeNames = realloc(gNodeNames, sizeof(char*)*(nrNodes+1));
   gNodes[nrNodes].nr_branch = 0;
   gNodes[nrNodes].follow_mask = 0;
   gNodes[nrNodes].branch = NULL;
+  gNodes[nrNodes].root_state = 0;
   gNodeNames[nrNodes] = strdup(name);
   nrNodes++;
   return nrNodes-1;
 }
 
 
-/* ܾ狼branchܤФ */
+/* 遷移条件からbranchを捜し出す */
 static struct dep_branch *
 find_branch(struct dep_node *node, xstr **strs, int nr_strs)
 {
   struct dep_branch *db;
   int i, j;
-  /* ƱܾΥ֥õ */
+  /* 同じ遷移条件のブランチを探す */
   for (i = 0; i < node->nr_branch; i++) {
     db = &node->branch[i];
     if (nr_strs != db->nr_cond_strs) {
@@ -94,7 +105,7 @@ find_branch(struct dep_node *node, xstr **strs, int nr_strs)
     return db;
   fail:;
   }
-  /* ֥ݤ */
+  /* 新しいブランチを確保する */
   node->branch = realloc(node->branch,
 			 sizeof(struct dep_branch)*(node->nr_branch+1));
   db = &node->branch[node->nr_branch];
@@ -110,8 +121,8 @@ find_branch(struct dep_node *node, xstr **strs, int nr_strs)
 }
 
 /*
- * ܤparse
- *  doc/SPLITTER
+ * 遷移をparseする
+ *  doc/SPLITTER参照
  */
 static void
 parse_transition(char *token, struct dep_transition *tr)
@@ -122,7 +133,7 @@ parse_transition(char *token, struct dep_transition *tr)
   char *str = token;
   tr->head_pos = POS_NONE;
   tr->weak = 0;
-  /* ܤ°*/
+  /* 遷移の属性を解析*/
   while (*token != '@') {
     switch(*token){
     case ':':
@@ -130,7 +141,7 @@ parse_transition(char *token, struct dep_transition *tr)
       tr->weak = 1;
       break;
     case 'C':
-      /* ѷ */
+      /* 活用形 */
       switch (token[1]) {
       case 'z': ct = CT_MIZEN; break;
       case 'y': ct = CT_RENYOU; break;
@@ -143,7 +154,7 @@ parse_transition(char *token, struct dep_transition *tr)
       token ++;
       break;
     case 'H':
-      /* Ωʻ */
+      /* 自立語部の品詞 */
       switch (token[1]) {
       case 'n':	tr->head_pos = POS_NOUN; break;
       case 'v':	tr->head_pos = POS_V; break;
@@ -152,7 +163,7 @@ parse_transition(char *token, struct dep_transition *tr)
       token ++;
       break;
     case 'S':
-      /* ʸ° */
+      /* 文節の属性 */
       switch (token[1]) {
 	/*      case 'n': sc = DEP_NO; break;*/
       case 'f': dc = DEP_FUZOKUGO; break;
@@ -171,7 +182,7 @@ parse_transition(char *token, struct dep_transition *tr)
     }
     token ++;
   }
-  /* @ϥΡɤ̾ */
+  /* @から後はノードの名前 */
   tr->next_node = get_node_id_by_name(token);
   /**/
   tr->pos = pos;
@@ -180,7 +191,7 @@ parse_transition(char *token, struct dep_transition *tr)
 }
 
 /*
- * Ρ̾ ܾ+ +
+ * ノード名 遷移条件+ 遷移先+
  */
 static void
 parse_dep(char **tokens, int nr)
@@ -191,14 +202,14 @@ parse_dep(char **tokens, int nr)
   int nr_strs;
   xstr **strs = alloca(sizeof(xstr*) * nr);
 
-  /* ΡɤȤid */
+  /* ノードとそのidを確保 */
   id = get_node_id_by_name(tokens[row]);
   dn = &gNodes[id];
   row ++;
 
   nr_strs = 0;
 
-  /* ܾ° */
+  /* 遷移条件の付属語の配列を作る */
   for (; row < nr && tokens[row][0] == '\"'; row++) {
     char *s;
     s = strdup(&tokens[row][1]);
@@ -208,7 +219,7 @@ parse_dep(char **tokens, int nr)
     free(s);
   }
 
-  /* ܾ郎ʤϷٹФơܾɲä */
+  /* 遷移条件がない時は警告を出して、空の遷移条件を追加する */
   if (nr_strs == 0) {
     char *s;
     anthy_log(0, "node %s has a branch without any transition condition.\n",
@@ -219,7 +230,7 @@ parse_dep(char **tokens, int nr)
     free(s);
   }
 
-  /* ֥ΥΡɤɲä */
+  /* ブランチに遷移先のノードを追加する */
   db = find_branch(dn, strs, nr_strs);
   for ( ; row < nr; row++){
     struct dep_transition *tr;
@@ -232,7 +243,7 @@ parse_dep(char **tokens, int nr)
   }
 }
 
-/* ʸˡե˶ΥΡɤ뤫å */
+/* 文法定義ファイル中に空のノードがあるかチェックする */
 static void
 check_nodes(void)
 {
@@ -249,7 +260,7 @@ do_calc_follow_mask(struct dep_node *node)
 {
   int i, mask;
   if (node->follow_mask) {
-    /* ׻Ѥ */
+    /* 計算済み */
     return ;
   }
   mask = 0;
@@ -262,23 +273,23 @@ do_calc_follow_mask(struct dep_node *node)
       if (cond_xs->len == 0) {
 	has_epsilon = 1;
       } else {
-	/* ܾΰʸܤФơޥɲä */
+	/* 遷移条件の一文字目を取り出して、マスクに追加する */
 	mask |= (1 << (cond_xs->str[0] & 31));
       }
     }
     /**/
     if (has_epsilon || br->nr_cond_strs == 0) {
-      /* ܾ郎ʸʪΤǡΥޥɲä */
+      /* 遷移条件が空文字列の物があるので、遷移先のマスクを追加する */
       int k;
       for (k = 0; k < br->nr_transitions; k++) {
-	/* Υޥ */
+	/* 遷移先のマスク */
 	int next_node_id = br->transitions[k].next_node;
 	struct dep_node *next_node = &gNodes[next_node_id];
 	do_calc_follow_mask(next_node);
 	mask |= next_node->follow_mask;
 	/**/
 	if (next_node_id == 0) {
-	  /* üؤ */
+	  /* 終端への遷移 */
 	  mask |= 1;
 	}
       }
@@ -297,6 +308,99 @@ calc_follow_mask(void)
   }
 }
 
+static int
+new_trie_state(void)
+{
+  gStates = realloc(gStates, sizeof(struct trie_state)*(nrStates+1));
+  gStates[nrStates].nr_edges = 0;
+  gStates[nrStates].edges = NULL;
+  gStates[nrStates].nr_accepts = 0;
+  gStates[nrStates].accepts = NULL;
+  nrStates++;
+  return nrStates-1;
+}
+
+/* 状態sから文字cで遷移する先を返す、無ければ作る */
+static int
+trie_child(int s, xchar c)
+{
+  struct trie_state *ts = &gStates[s];
+  int i, next;
+  for (i = 0; i < ts->nr_edges; i++) {
+    if (ts->edges[i].c == c) {
+      return ts->edges[i].next_state;
+    }
+    if (ts->edges[i].c > c) {
+      break;
+    }
+  }
+  next = new_trie_state();
+  /* reallocでgStatesが動くので取り直す */
+  ts = &gStates[s];
+  ts->edges = realloc(ts->edges, sizeof(struct dep_edge)*(ts->nr_edges+1));
+  memmove(&ts->edges[i+1], &ts->edges[i],
+	  sizeof(struct dep_edge)*(ts->nr_edges-i));
+  ts->edges[i].c = c;
+  ts->edges[i].next_state = next;
+  ts->nr_edges++;
+  return next;
+}
+
+static void
+trie_add_accept(int s, int rank, int branch)
+{
+  struct trie_state *ts = &gStates[s];
+  ts->accepts = realloc(ts->accepts,
+			sizeof(struct dep_accept)*(ts->nr_accepts+1));
+  ts->accepts[ts->nr_accepts].rank = rank;
+  ts->accepts[ts->nr_accepts].branch = branch;
+  ts->nr_accepts++;
+}
+
+/* 根からの経路上で受理される遷移条件の数の最大値 */
+static int
+max_path_accepts(int s)
+{
+  struct trie_state *ts = &gStates[s];
+  int i, m = 0;
+  for (i = 0; i < ts->nr_edges; i++) {
+    int n = max_path_accepts(ts->edges[i].next_state);
+    if (n > m) {
+      m = n;
+    }
+  }
+  return m + ts->nr_accepts;
+}
+
+/* 各ノードの遷移条件をトライにまとめる */
+static int
+build_automaton(void)
+{
+  int i, j, k;
+  for (i = 0; i < nrNodes; i++) {
+    struct dep_node *node = &gNodes[i];
+    int rank = 0;
+    node->root_state = new_trie_state();
+    for (j = 0; j < node->nr_branch; j++) {
+      struct dep_branch *br = &node->branch[j];
+      for (k = 0; k < br->nr_cond_strs; k++, rank++) {
+	xstr *cond_xs = br->cond_strs[k];
+	int s = node->root_state;
+	int l;
+	for (l = 0; l < cond_xs->len; l++) {
+	  s = trie_child(s, cond_xs->str[l]);
+	}
+	trie_add_accept(s, rank, j);
+      }
+    }
+    if (max_path_accepts(node->root_state) > DEP_MAX_MATCHES) {
+      anthy_log(0, "node %s has too many conditions.\n", gNodeNames[i]);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 static int
 init_depword_tab(void)
 {
@@ -304,7 +408,7 @@ init_depword_tab(void)
   char **tokens;
   int nr;
 
-  /* id 0 Ρɤ˳Ƥ */
+  /* id 0 を空ノードに割当てる */
   get_node_id_by_name("@");
 
   /**/
@@ -317,7 +421,7 @@ init_depword_tab(void)
     anthy_log(0, "Failed to open dep word dict (%s).\n", fn);
     return -1;
   }
-  /* Ԥ°쥰դɤ */
+  /* 一行ずつ付属語グラフを読む */
   while (!anthy_read_line(&tokens, &nr)) {
     parse_dep(tokens, nr);
     anthy_free_line();
@@ -326,7 +430,7 @@ init_depword_tab(void)
 
   calc_follow_mask();
   check_nodes();
-  return 0;
+  return build_automaton();
 }
 
 
@@ -340,10 +444,10 @@ parse_indep(char **tokens, int nr)
   }
   gRules = realloc(gRules, sizeof(struct wordseq_rule)*(nrRules+1));
 
-  /* ԤƬˤʻ̾äƤ */
+  /* 行の先頭には品詞の名前が入っている */
   gRules[nrRules].wt = anthy_init_wtype_by_name(tokens[0]);
 
-  /* μˤϥΡ̾äƤ */
+  /* その次にはノード名が入っている */
   gRules[nrRules].node_id = get_node_id_by_name(tokens[1]);
 
   if (verbose) {
@@ -353,7 +457,7 @@ parse_indep(char **tokens, int nr)
   nrRules ++;
 }
 
-/** Ω줫ɽ */
+/** 自立語からの遷移表 */
 static int 
 init_indep_word_seq_tab(void)
 {
@@ -370,7 +474,7 @@ init_indep_word_seq_tab(void)
     printf("Failed to open indep word dict (%s).\n", fn);
     return -1;
   }
-  /* եԤɤ */
+  /* ファイルを一行ずつ読む */
   while (!anthy_read_line(&tokens, &nr)) {
     parse_indep(tokens, nr);
     anthy_free_line();
@@ -381,7 +485,7 @@ init_indep_word_seq_tab(void)
 }
 
 /*  
-    ͥåȥХȥ4byte񤭽Ф
+    ネットワークバイトオーダーで4byte書き出す
 */
 static void
 write_nl(FILE* fp, int i)
@@ -419,13 +523,13 @@ write_branch(FILE* fp, struct dep_branch* branch)
 {
   int i;
 
-  /* ܾ */
+  /* 遷移条件 */
   write_nl(fp, branch->nr_cond_strs);
   for (i = 0; i < branch->nr_cond_strs; ++i) {
     write_xstr(fp, branch->cond_strs[i]);
   }
 
-  /*  */
+  /* 遷移先 */
   write_nl(fp, branch->nr_transitions);
   for (i = 0; i < branch->nr_transitions; ++i) {
     write_transition(fp, &branch->transitions[i]);
@@ -456,26 +560,74 @@ write_wtype(FILE *fp, wtype_t wt)
   fputc(0, fp);
 }
 
-/* °쥰դե˽񤭽Ф */
+static void
+write_automaton(FILE *fp)
+{
+  int i, j;
+  int nr_edges = 0, nr_accepts = 0;
+
+  for (i = 0; i < nrStates; i++) {
+    nr_edges += gStates[i].nr_edges;
+    nr_accepts += gStates[i].nr_accepts;
+  }
+  write_nl(fp, DEP_AUTOMATON_MAGIC);
+  write_nl(fp, nrStates);
+  write_nl(fp, nr_edges);
+  write_nl(fp, nr_accepts);
+  /* 各ノードの根 */
+  for (i = 0; i < nrNodes; i++) {
+    write_nl(fp, gNodes[i].root_state);
+  }
+  /* 各状態 */
+  nr_edges = 0;
+  nr_accepts = 0;
+  for (i = 0; i < nrStates; i++) {
+    write_nl(fp, nr_edges);
+    write_nl(fp, gStates[i].nr_edges);
+    write_nl(fp, nr_accepts);
+    write_nl(fp, gStates[i].nr_accepts);
+    nr_edges += gStates[i].nr_edges;
+    nr_accepts += gStates[i].nr_accepts;
+  }
+  /* 出力辺 */
+  for (i = 0; i < nrStates; i++) {
+    for (j = 0; j < gStates[i].nr_edges; j++) {
+      write_nl(fp, gStates[i].edges[j].c);
+      write_nl(fp, gStates[i].edges[j].next_state);
+    }
+  }
+  /* 受理する遷移条件 */
+  for (i = 0; i < nrStates; i++) {
+    for (j = 0; j < gStates[i].nr_accepts; j++) {
+      write_nl(fp, gStates[i].accepts[j].rank);
+      write_nl(fp, gStates[i].accepts[j].branch);
+    }
+  }
+}
+
+/* 付属語グラフをファイルに書き出す */
 static void
 write_depgraph_file(const char* file_name)
 {
   int i;
   FILE* fp = fopen(file_name, "w");
 
-  /* ƥ롼 */
+  /* 各ルール */
   write_nl(fp, nrRules);
   for (i = 0; i < nrRules; ++i) {
     write_wtype(fp, gRules[i].wt);
     write_nl(fp, gRules[i].node_id);
   }
 
-  /* ƥΡ */
+  /* 各ノード */
   write_nl(fp, nrNodes);
   for (i = 0; i < nrNodes; ++i) {
     write_node(fp, &gNodes[i]);
   }
 
+  /* 遷移条件のオートマトン */
+  write_automaton(fp);
+
   fclose(fp);
 }
 
@@ -485,15 +637,17 @@ main(int argc, char* argv[])
   (void) argc;
   (void) argv;
 
-  /* °켭ɤ߹ǥե˽񤭽Ф */
+  /* 付属語辞書を読み込んでファイルに書き出す */
   anthy_conf_override("CONFFILE", "../anthy-conf");
   anthy_conf_override("ANTHYDIR", SRCDIR "/../depgraph/");
 
   anthy_init_wtypes();
   anthy_do_conf_init();
-  /* °쥰 */
-  init_depword_tab();
-  /* Ω줫ɽ */
+  /* 付属語グラフ */
+  if (init_depword_tab()) {
+    return 1;
+  }
+  /* 自立語からの遷移表 */
   init_indep_word_seq_tab();
 
   write_depgraph_file("anthy.dep");
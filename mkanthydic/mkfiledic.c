@@ -1,20 +1,20 @@
 /*
- * եޤȤƼե
+ * ファイルをまとめて辞書ファイルを生成する
  *
- * ǥեȤǤϤҤȤľΥǥ쥯ȥ..פ˳ƥե
- * ѥ̾դ뤬ΥޥɤФ -p ץ
- * ѹ뤳ȤǤ롣
+ * デフォルトではひとつ上のディレクトリ「..」に各ファイルの
+ * パス名を付けるが、このコマンドに対する -p オプションで
+ * 変更することができる。
  *
- * entry_numĤΥեФ
- *  0: entry_num եθĿ
- *  1: ƥեξ
+ * entry_num個のファイルに対して
+ *  0: entry_num ファイルの個数
+ *  1: 各ファイルの情報
  *    n * 3    : name_offset
  *    n * 3 + 1: strlen(key)
  *    n * 3 + 2: contents_offset
  *  [name_of_section]*entry_num
- *   : ƥե̾
+ *   : 各ファイルの名前
  *  [file]*entry_num
- *   : ƥե
+ *   : 各ファイルの内容
  *
  * Copyright (C) 2005-2006 YOSHIDA Yuichi
  * Copyright (C) 2006-2007 TABATA Yusuke
@@ -38,6 +38,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
 #include <sys/stat.h>
 
 #include <anthy/xstr.h>
@@ -46,6 +47,10 @@
 
 #define SECTION_ALIGNMENT 64
 #define DIC_NAME "anthy.dic"
+/* corpus_infoから変換したセクションの形式を記録するファイル */
+#define SECTION_STAMP "anthy.sections_stamp"
+/* セクションの形式を変えたら上げて、古い形式のセクションを作り直させる */
+#define SECTION_FORMAT_VERSION 2
 
 struct header_entry {
   const char* key;
@@ -60,7 +65,7 @@ write_nl(FILE* fp, int i)
 }
 
 
-/** եΥ */
+/** ファイルのサイズを取得する */
 static int
 get_file_size(const char* fn)
 {
@@ -100,10 +105,10 @@ write_header(FILE* fp, const char *prefix,
   contents_offset =
     (contents_offset + SECTION_ALIGNMENT - 1) & (-SECTION_ALIGNMENT);
 
-  /* եο */
+  /* ファイルの数 */
   write_nl(fp, entry_num);
 
-  /* ƥեξϤ */
+  /* 各ファイルの場所を出力する */
   for (i = 0; i < entry_num; ++i) {
     char *fn = get_file_name(prefix, &entries[i]);
     int file_size = get_file_size(fn);
@@ -123,7 +128,7 @@ write_header(FILE* fp, const char *prefix,
     contents_offset += file_size;
   }
 
-  /* ƥե̾Ϥ */
+  /* 各ファイルの名前を出力する */
   for (i = 0; i < entry_num; ++i) {
     fprintf(fp, "%s", entries[i].key);
   }
@@ -186,13 +191,13 @@ create_file_dic(const char* fn, const char *prefix,
     fprintf(stderr, "failed to open file dictionary file (%s).\n", fn);
     exit(1);
   }
-  /* إå񤭽Ф */
+  /* ヘッダを書き出す */
   res = write_header(fp, prefix, entry_num, entries);
   if (res) {
     exit(1);
   }
 
-  /* եȤ񤭽Ф */
+  /* ファイルの中身を書き出す */
   write_contents(fp, prefix, entry_num, entries);
   fclose(fp);
 }
@@ -209,11 +214,167 @@ convert_line(FILE *ofp, char *buf)
   } while (tok);
 }
 
+/* 確率のテーブルの一行 */
+struct feature_row {
+  int f[NR_EM_FEATURES];
+  int neg, pos;
+};
+
+/* 確率のテーブルを詰めた形式に変換するための状態 */
+static struct feature_rows {
+  int nr;
+  int size;
+  struct feature_row *rows;
+} feature_rows;
+
+/* 素性,...,負例,正例 の行を読んで溜めておく */
+static void
+add_feature_row(char *buf)
+{
+  int v[NR_EM_FEATURES + 2];
+  int i, nr = 0;
+  char *tok;
+  struct feature_row *row;
+  for (tok = strtok(buf, ","); tok && nr < NR_EM_FEATURES + 2;
+       tok = strtok(NULL, ",")) {
+    v[nr] = atoi(tok);
+    nr ++;
+  }
+  if (nr < 2) {
+    return ;
+  }
+  if (feature_rows.nr == feature_rows.size) {
+    feature_rows.size = feature_rows.size ? feature_rows.size * 2 : 1024;
+    feature_rows.rows = realloc(feature_rows.rows,
+				sizeof(struct feature_row) *
+				feature_rows.size);
+  }
+  row = &feature_rows.rows[feature_rows.nr];
+  for (i = 0; i < NR_EM_FEATURES; i++) {
+    row->f[i] = (i < nr - 2) ? v[i] : 0;
+  }
+  row->neg = v[nr - 2];
+  row->pos = v[nr - 1];
+  feature_rows.nr ++;
+}
+
+static int
+compare_feature_row(const void *p1, const void *p2)
+{
+  const struct feature_row *r1 = p1;
+  const struct feature_row *r2 = p2;
+  int i;
+  for (i = 0; i < NR_EM_FEATURES; i++) {
+    if (r1->f[i] != r2->f[i]) {
+      return r1->f[i] - r2->f[i];
+    }
+  }
+  return 0;
+}
+
+/* 正例の割合の対数を16bitにする */
+static int
+quantize_prob(const struct feature_row *row)
+{
+  double q;
+  if (row->pos <= 0 || row->pos + row->neg <= 0) {
+    return FEATURE_PROB_ZERO;
+  }
+  q = -log((double)row->pos / (row->pos + row->neg)) * FEATURE_PROB_SCALE;
+  if (q >= FEATURE_PROB_ZERO) {
+    return FEATURE_PROB_ZERO - 1;
+  }
+  return (int)(q + 0.5);
+}
+
+static void
+write_varint(FILE *fp, unsigned int v)
+{
+  while (v >= 0x80) {
+    fputc((v & 0x7f) | 0x80, fp);
+    v >>= 7;
+  }
+  fputc(v, fp);
+}
+
+/* 末尾の0を除いた素性の数 */
+static int
+nr_row_features(const struct feature_row *row)
+{
+  int nr;
+  for (nr = NR_EM_FEATURES; nr > 0 && !row->f[nr - 1]; nr--);
+  return nr;
+}
+
+/* 溜めておいた行をFEATURE_BLOCK_ROWS行ごとのブロックにして出力する */
+static void
+write_feature_rows(FILE *ofp, int weight)
+{
+  struct feature_row *rows = feature_rows.rows;
+  int nr_rows = feature_rows.nr;
+  int nr_blocks;
+  FILE *data = tmpfile();
+  char buf[BUFSIZ];
+  size_t nread;
+  int i, j;
+
+  if (!data) {
+    fprintf(stderr, "failed to open temporary file\n");
+    abort();
+  }
+  qsort(rows, nr_rows, sizeof(struct feature_row), compare_feature_row);
+  /* 同じ素性の行は頻度を足してまとめる */
+  for (i = 0, j = 0; i < nr_rows; i++) {
+    if (j > 0 && !compare_feature_row(&rows[j - 1], &rows[i])) {
+      rows[j - 1].neg += rows[i].neg;
+      rows[j - 1].pos += rows[i].pos;
+      continue;
+    }
+    rows[j] = rows[i];
+    j ++;
+  }
+  nr_rows = j;
+  nr_blocks = (nr_rows + FEATURE_BLOCK_ROWS - 1) / FEATURE_BLOCK_ROWS;
+
+  write_nl(ofp, FEATURE_SECTION_MAGIC);
+  write_nl(ofp, nr_rows);
+  write_nl(ofp, nr_blocks);
+  write_nl(ofp, weight);
+  for (i = 0; i < nr_rows; i++) {
+    int nr = nr_row_features(&rows[i]);
+    int shared = 0, q;
+    if (i % FEATURE_BLOCK_ROWS == 0) {
+      /* ブロックの位置 */
+      write_nl(ofp, ftell(data));
+    } else {
+      for (; shared < nr && rows[i].f[shared] == rows[i - 1].f[shared];
+	   shared++);
+    }
+    fputc(shared, data);
+    fputc(nr - shared, data);
+    for (j = shared; j < nr; j++) {
+      write_varint(data, rows[i].f[j]);
+    }
+    q = quantize_prob(&rows[i]);
+    fputc(q >> 8, data);
+    fputc(q & 255, data);
+  }
+  /* データはブロックの位置の直後に続ける */
+  rewind(data);
+  while ((nread = fread(buf, 1, sizeof(buf), data)) > 0) {
+    fwrite(buf, 1, nread, ofp);
+  }
+  fclose(data);
+  feature_rows.nr = 0;
+}
+
 static void
 convert_file(FILE *ifp)
 {
   char buf[1024];
   FILE *ofp = NULL;
+  /* 確率のテーブルを変換中ならその重みの合計、そうでなければ-1 */
+  int feature_weight = -1;
   while (fgets(buf, 1024, ifp)) {
     /**/
     if (buf[0] == '#') {
@@ -223,6 +384,9 @@ convert_file(FILE *ifp)
       int w, n, i;
       char fn[1024];
       if (ofp) {
+	if (feature_weight >= 0) {
+	  write_feature_rows(ofp, feature_weight);
+	}
 	fclose(ofp);
 	ofp = NULL;
       }
@@ -232,20 +396,90 @@ convert_file(FILE *ifp)
 	fprintf(stderr, "failed to open (%s)\n", fn);
 	abort();
       }
+      if (strlen(fn) > 5 && !strcmp(&fn[strlen(fn) - 5], "_info")) {
+	/* 確率のテーブルは詰めた形式にする */
+	feature_weight = w;
+	continue;
+      }
+      feature_weight = -1;
       write_nl(ofp, w);
       write_nl(ofp, n);
       for (i = 0; i < NR_EM_FEATURES; i++) {
 	write_nl(ofp, 0);
       }
+    } else if (feature_weight >= 0) {
+      add_feature_row(buf);
     } else {
       convert_line(ofp, buf);
     }
   }
   if (ofp) {
+    if (feature_weight >= 0) {
+      write_feature_rows(ofp, feature_weight);
+    }
     fclose(ofp);
   }
 }
 
+/* 変換したセクションの形式を記録する */
+static void
+write_section_stamp(void)
+{
+  FILE *fp = fopen(SECTION_STAMP, "w");
+  if (!fp) {
+    return ;
+  }
+  fprintf(fp, "%d %x\n", SECTION_FORMAT_VERSION, FEATURE_SECTION_MAGIC);
+  fclose(fp);
+}
+
+/* 前回変換したセクションが今の形式であれば1を返す */
+static int
+check_section_stamp(void)
+{
+  FILE *fp = fopen(SECTION_STAMP, "r");
+  int version, r = 0;
+  unsigned int magic;
+  if (!fp) {
+    return 0;
+  }
+  if (fscanf(fp, "%d %x", &version, &magic) == 2 &&
+      version == SECTION_FORMAT_VERSION &&
+      magic == FEATURE_SECTION_MAGIC) {
+    r = 1;
+  }
+  fclose(fp);
+  return r;
+}
+
+/* corpus_infoから変換したセクションのファイルが今の形式で、
+ * corpus_infoとmkfiledic自身(prog)よりも全て新しければ1を返す */
+static int
+is_converted(const char *fn, const char *prog,
+	     int entry_num, struct header_entry* entries)
+{
+  struct stat src_st, prog_st, st;
+  int i;
+  if (stat(fn, &src_st) < 0 || stat(prog, &prog_st) < 0) {
+    return 0;
+  }
+  if (!check_section_stamp()) {
+    return 0;
+  }
+  for (i = 0; i < entry_num; i++) {
+    if (entries[i].file_name[0] == '/') {
+      /* 他のディレクトリで作られるファイル */
+      continue;
+    }
+    if (stat(entries[i].file_name, &st) < 0 ||
+	st.st_mtime < src_st.st_mtime ||
+	st.st_mtime < prog_st.st_mtime) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
 static void
 convert_data(const char *fn)
 {
@@ -257,6 +491,7 @@ convert_data(const char *fn)
   }
   convert_file(ifp);
   fclose(ifp);
+  write_section_stamp();
 }
 
 int
@@ -290,7 +525,13 @@ main(int argc, char* argv[])
     prev_arg = argv[i];
   }
   if (dict_source) {
-    convert_data(dict_source);
+    if (is_converted(dict_source, argv[0],
+		     sizeof(entries)/sizeof(struct header_entry),
+		     entries)) {
+      printf("sections from %s are up to date.\n", dict_source);
+    } else {
+      convert_data(dict_source);
+    }
   }
   printf("file name prefix=[%s] you can change this by -p option.\n", prefix);
 
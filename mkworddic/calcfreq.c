@@ -1,4 +1,4 @@
-/* ñ٤׻ */
+/* 単語の頻度を計算する */
 #include <stdlib.h>
 #include "mkdic.h"
 
@@ -30,7 +30,7 @@ make_word_array(struct yomi_entry_list *yl, int nr)
   return array;
 }
 
-/** qsortѤӴؿ */
+/** qsort用の比較関数 */
 static int
 compare_word_entry_by_freq(const void *p1, const void *p2)
 {
@@ -44,8 +44,12 @@ set_freq(struct word_entry **array, int nr)
 {
   int i;
   int percent = nr / 100;
+  /* 100語に満たない小さな辞書 */
+  if (percent == 0) {
+    percent = 1;
+  }
   for (i = 0; i < nr; i++) {
-    /* raw_freq礭 */
+    /* raw_freqの大きい順 */
     struct word_entry *we = array[i];
     we->cost = 99 - (i / percent);
     if (we->cost < 1) {
@@ -53,7 +57,7 @@ set_freq(struct word_entry **array, int nr)
     }
     we->cost *= 100;
     we->cost -= we->source_order;
-    /* ѴѤʤΤ-1 */
+    /* 逆変換用なので-1倍 */
     if (we->raw_freq < 0) {
       we->cost *= -1;
     }
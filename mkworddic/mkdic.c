@@ -1,43 +1,46 @@
 /*
- * cannadicΥե뤫鼭ե
+ * cannadic形式のファイルから辞書ファイルを作る
  *
- * Funded by IPA̤Ƨեȥ¤ 2002 1/1
+ * Funded by IPA未踏ソフトウェア創造事業 2002 1/1
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  * Copyright (C) 2005 YOSHIDA Yuichi
  * Copyright (C) 2001-2002 TAKAI Kousuke
  */
 /*
- * ɤߤindexȤʻѴñ(=entry)򸡺
- * 빽¤ˤʤäƤ롣
+ * 辞書は読みをindexとし、品詞や変換後の単語(=entry)を検索
+ * する構造になっている。
  *
- * ɤ -> ñ졢ñ졢
+ * 読み -> 単語、単語、、
  *
- * եϥͥåȥХȥѤ롣
+ * 辞書ファイルはネットワークバイトオーダーを用いる。
  *
- * եʣΥ󤫤鹽Ƥ
- *  0 إå 16*4 bytes
- *  2 ɤߤΥǥå (ɤ512Ĥ)
- *  3 ɤ
- *  4 ڡ
- *  5 ڡΥǥå
- *  6 㼭(?)
- *  7 ɤ hash
+ * 辞書ファイルは複数のセクションから構成されている
+ *  0 ヘッダ 16*4 bytes
+ *  2 読みのインデックス (読み512個ごと)
+ *  3 読み
+ *  4 ページ
+ *  5 ページのインデックス
+ *  6 用例辞書(?)
+ *  7 読み hash
+ *  8 逆変換用の辞書 (2から7と同じ構成の辞書をもう一つ持つ)
  *
- * source μե
- * file_dic ե
+ * source 元の辞書ファイル
+ * file_dic 生成するファイル
  *
- * yomi_hash ե˽Ϥhashbitmap
- * index_hash Υstruct yomi_entry򸡺뤿hash
+ * yomi_hash 辞書ファイルに出力されるhashのbitmap
+ * index_hash このソース中でstruct yomi_entryを検索するためのhash
  *
  */
 
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <math.h>
 
 #include <config.h>
 
@@ -53,19 +56,29 @@
 #define SECTION_ALIGNMENT 8
 
 #define DEFAULT_FN "anthy.wdic"
+/* 読み込み時に使うメモリの上限のデフォルト */
+#define DEFAULT_SORT_MEMORY (256 * 1024 * 1024)
+/* 読みのBloom filterの誤検出率 */
+#define DEFAULT_BLOOM_ERROR_RATE 0.01
 
 static const char *progname;
 
-/* writewords.c饢뤿ˡglobalѿ */
+/* writewords.cからアクセスするために、global変数 */
 FILE *yomi_entry_index_out, *yomi_entry_out;
 FILE *page_out, *page_index_out;
 /**/
 static FILE *uc_out;
 static FILE *yomi_hash_out;
-/* ϥåξͤο׾ */
-static int yomi_hash_collision;
-
-/* եν˽ä¤٤ */
+/* ハッシュの衝突の数、統計情報 */
+/* 逆変換用の辞書の各セクション */
+static FILE *rev_entry_index_out, *rev_entry_out;
+static FILE *rev_page_out, *rev_page_index_out;
+static FILE *rev_uc_out, *rev_hash_out;
+/* 逆変換用の辞書をまとめたもの */
+static FILE *reverse_out;
+static char *reverse_fn;
+
+/* ファイル中の順序に従って並べる */
 struct file_section {
   FILE **fpp;
   char *fn;
@@ -77,41 +90,66 @@ struct file_section {
   {&uc_out, NULL},
   {&yomi_hash_out, NULL},
   {NULL, NULL},
+}, reverse_file_array[] = {
+  {&rev_entry_index_out, NULL},
+  {&rev_entry_out, NULL},
+  {&rev_page_out, NULL},
+  {&rev_page_index_out, NULL},
+  {&rev_uc_out, NULL},
+  {&rev_hash_out, NULL},
+  {NULL, NULL},
 };
 
-/* νΥե򥪡ץ󤹤 */
-static void
-open_output_files(void)
+/* 一時ファイルをオープンする、失敗したらNULLを返す
+ * 名前のあるファイルを作った場合は*fnpにその名前が入る */
+FILE *
+mkdic_open_tmpfile(char **fnp)
 {
-  struct file_section *fs;
-  for (fs = file_array; fs->fpp; fs ++) {
-    char *tmpdir = getenv("TMPDIR");
-    fs->fn = NULL;
-    if (tmpdir) {
-      /* tmpfile()TMPDIR򸫤ʤᡢTMPDIRꤵ줿mkstempȤ*/
-      char buf[256];
-      int fd = -1;
-      snprintf(buf, sizeof(buf), "%s/mkanthydic.XXXXXX", tmpdir);
-      fd = mkstemp(buf);
-      if (fd == -1) {
-	*(fs->fpp) = NULL;
-      } else {
-	*(fs->fpp) = fdopen(fd, "w+");
-	fs->fn = strdup(buf);
-      }
+  FILE *fp;
+  char *tmpdir = getenv("TMPDIR");
+  *fnp = NULL;
+  if (tmpdir) {
+    /* tmpfile()がTMPDIRを見ないため、TMPDIRを指定された場合mkstempを使う。*/
+    char buf[256];
+    int fd = -1;
+    snprintf(buf, sizeof(buf), "%s/mkanthydic.XXXXXX", tmpdir);
+    fd = mkstemp(buf);
+    if (fd == -1) {
+      fp = NULL;
     } else {
-      *(fs->fpp) = tmpfile();
-    }
-    /**/
-    if (!(*(fs->fpp))) {
-      fprintf (stderr, "%s: cannot open temporary file: %s\n",
-	       progname, strerror (errno));
-      exit (2);
+      fp = fdopen(fd, "w+");
+      *fnp = strdup(buf);
     }
+  } else {
+    fp = tmpfile();
+  }
+  return fp;
+}
+
+/* 一時ファイルをオープンする、失敗したら終了する */
+FILE *
+mkdic_tmpfile(char **fnp)
+{
+  FILE *fp = mkdic_open_tmpfile(fnp);
+  if (!fp) {
+    fprintf (stderr, "%s: cannot open temporary file: %s\n",
+	     progname, strerror (errno));
+    exit (2);
+  }
+  return fp;
+}
+
+/* 辞書の出力先のファイルをオープンする */
+static void
+open_output_files(struct file_section *fa)
+{
+  struct file_section *fs;
+  for (fs = fa; fs->fpp; fs ++) {
+    *(fs->fpp) = mkdic_tmpfile(&fs->fn);
   }
 }
 
-/* fflush */
+/* fflushする */
 static void
 flush_output_files (void)
 {
@@ -130,7 +168,7 @@ flush_output_files (void)
   }
 }
 
-/* ͥåȥbyteorder4bytes񤭽Ф */
+/* ネットワークbyteorderで4bytes書き出す */
 void
 write_nl(FILE *fp, int i)
 {
@@ -142,6 +180,11 @@ static void
 print_usage(void)
 {
   printf("please do not use mkanthydic command directly.\n");
+  printf(" -j <jobs>: number of processes to read source files\n");
+  printf(" -m <MB>: memory limit of the reading workers only\n");
+  printf(" -c <dir>: directory to cache words read from each file\n");
+  printf(" -H <n>: put entries of the n most frequent yomi first\n");
+  printf(" -e <rate>: false positive rate of the yomi bloom filter\n");
   exit(0);
 }
 
@@ -171,7 +214,7 @@ get_wt_name(const char *name)
   return res;
 }
 
-/** ɤߤФơñĤɲä */
+/** 読みに対して、単語を一つを追加する */
 void
 push_back_word_entry(struct mkdic_stat *mds,
 		     struct yomi_entry *ye, const char *wt_name,
@@ -183,9 +226,29 @@ push_back_word_entry(struct mkdic_stat *mds,
     return ;
   }
   if (!anthy_type_to_wtype(wt_name, &wt)) {
-    /* anthyΤʤʻ */
+    /* anthyの知らない品詞 */
+    return ;
+  }
+  if (mds->input_encoding == ANTHY_EUC_JP_ENCODING) {
+    s = anthy_conv_euc_to_utf8(word);
+  } else {
+    s = strdup(word);
+  }
+  if (mds->run) {
+    /* 子プロセスで読み込み中 */
+    run_add_word(mds->run, wt_name, freq, s, order);
+    free(s);
     return ;
   }
+  append_word_entry(ye, wt_name, freq, s, order);
+}
+
+/** 読みに対して、UTF-8に変換済みの単語を一つ追加する
+ * word_utf8はyomi_entryが所有する */
+void
+append_word_entry(struct yomi_entry *ye, const char *wt_name,
+		  int freq, char *word_utf8, int order)
+{
   ye->entries = realloc(ye->entries,
 			sizeof(struct word_entry) *
 			(ye->nr_entries + 1));
@@ -194,16 +257,11 @@ push_back_word_entry(struct mkdic_stat *mds,
   ye->entries[ye->nr_entries].raw_freq = freq;
   ye->entries[ye->nr_entries].feature = 0;
   ye->entries[ye->nr_entries].source_order = order;
-  if (mds->input_encoding == ANTHY_EUC_JP_ENCODING) {
-    s = anthy_conv_euc_to_utf8(word);
-  } else {
-    s = strdup(word);
-  }
-  ye->entries[ye->nr_entries].word_utf8 = s;
+  ye->entries[ye->nr_entries].word_utf8 = word_utf8;
   ye->nr_entries ++;
 }
 
-/** Ʊñ줬̵å */
+/** 同じ単語が無いかチェック */
 static int
 check_same_word(struct yomi_entry *ye, int idx)
 {
@@ -220,24 +278,24 @@ check_same_word(struct yomi_entry *ye, int idx)
     if (strcmp(base->word_utf8, cur->word_utf8)) {
       return 0;
     }
-    /* Ʊä */
+    /* 同じだった */
     return 1;
   }
   return 0;
 }
 
-/** qsortѤӴؿ */
+/** qsort用の比較関数 */
 static int
 compare_word_entry_by_freq(const void *p1, const void *p2)
 {
   const struct word_entry *e1 = p1;
   const struct word_entry *e2 = p2;
-  /*(¤٤)
+  /*(小さい順に並べる)
     return e1->raw_freq - e2->raw_freq;*/
   return e2->raw_freq - e1->raw_freq;
 }
 
-/** qsortѤӴؿ */
+/** qsort用の比較関数 */
 static int
 compare_word_entry_by_wtype(const void *p1, const void *p2)
 {
@@ -251,7 +309,7 @@ compare_word_entry_by_wtype(const void *p1, const void *p2)
   }
 }
 
-/** ɤߤФñٽ¤١ʤñä */
+/** 読みに対する単語を頻度順に並べ、いらない単語を消す */
 static int
 normalize_word_entry(struct yomi_entry *ye)
 {
@@ -259,25 +317,25 @@ normalize_word_entry(struct yomi_entry *ye)
   if (!ye) {
     return 0;
   }
-  /* ñ¤٤ */
+  /* 単語を並べる */
   qsort(ye->entries, ye->nr_entries,
 	sizeof(struct word_entry),
 	compare_word_entry_by_freq);
-  /* ֤ä顢̵뤵Ĥ */
+  /* ダブったら、無視される点をつける */
   for (i = 0; i < ye->nr_entries; i++) {
     if (check_same_word(ye, i)) {
       ye->entries[i].raw_freq = INVALID_FREQ;
       nr_dup ++;
     }
   }
-  /* Ƥӥ */
+  /* 再びソート */
   qsort(ye->entries, ye->nr_entries,
 	sizeof(struct word_entry),
 	compare_word_entry_by_wtype);
   return ye->nr_entries - nr_dup;
 }
 
-/*ɤߤбyomi_entry֤
+/*その読みに対応するyomi_entryを返す
 **/
 struct yomi_entry *
 find_yomi_entry(struct yomi_entry_list *yl, xstr *index, int create)
@@ -285,7 +343,7 @@ find_yomi_entry(struct yomi_entry_list *yl, xstr *index, int create)
   struct yomi_entry *ye;
   int hash = index_hash(index);
   int search = 0;
-  /* hash chainõ */
+  /* hash chainから探す */
   for (ye = yl->hash[hash];ye ; ye = ye->hash_next) {
     search ++;
     if (!anthy_xstrcmp(ye->index_xstr, index)) {
@@ -296,7 +354,7 @@ find_yomi_entry(struct yomi_entry_list *yl, xstr *index, int create)
     return NULL;
   }
 
-  /* ̵Τǳ */
+  /* 無いので確保 */
   ye = malloc(sizeof(struct yomi_entry));
   ye->nr_entries = 0;
   ye->entries = 0;
@@ -304,11 +362,11 @@ find_yomi_entry(struct yomi_entry_list *yl, xstr *index, int create)
   ye->index_xstr = anthy_xstr_dup(index);
   ye->index_str = NULL;
 
-  /* hash chainˤĤʤ */
+  /* hash chainにつなぐ */
   ye->hash_next = yl->hash[hash];
   yl->hash[hash] = ye;
 
-  /* ꥹȤˤĤʤ */
+  /* リストにつなぐ */
 
   ye->next = yl->head;
   yl->head = ye;
@@ -318,44 +376,70 @@ find_yomi_entry(struct yomi_entry_list *yl, xstr *index, int create)
   return ye;
 }
 
-/* եhash bitmap˥ޡդ */
-static void
-mark_hash_array(unsigned char *hash_array, xstr *xs)
+/* Bloom filterに読みを加える、既に全てのビットが立っていたら1を返す */
+static int
+mark_bloom_filter(unsigned char *filter, int nr_blocks, int nr_hashes,
+		  xstr *xs)
 {
-  int val, idx, bit, mask;
-  val = anthy_xstr_hash(xs);
-  val &= (YOMI_HASH_ARRAY_SIZE*YOMI_HASH_ARRAY_BITS-1);
-  idx=(val>>YOMI_HASH_ARRAY_SHIFT)&(YOMI_HASH_ARRAY_SIZE-1);
-  bit= val & ((1<<YOMI_HASH_ARRAY_SHIFT)-1);
-  mask = (1<<bit);
-  if (hash_array[idx] & mask) {
-    yomi_hash_collision ++;
+  unsigned int h2;
+  unsigned int h1 = anthy_xstr_hash_pair(xs, &h2);
+  unsigned char *block;
+  int i, dup = 1;
+  block = &filter[(h1 & (nr_blocks - 1)) * (WORD_DIC_BLOOM_BLOCK_BITS / 8)];
+  for (i = 0; i < nr_hashes; i++) {
+    int b = WORD_DIC_BLOOM_BIT(h2, i);
+    if (!(block[b >> 3] & (1 << (b & 7)))) {
+      dup = 0;
+    }
+    block[b >> 3] |= (1 << (b & 7));
   }
-  hash_array[idx] |= mask;
+  return dup;
 }
 
-/* ɤhashΥӥåȥޥåפ */
+/* 読みのBloom filterを作る
+ * 誤検出率がmds->bloom_error_rateになるように大きさとハッシュ関数の数を決め、
+ * *hashesと*blocksに返す
+ */
 static void
-mk_yomi_hash(FILE *yomi_hash_out, struct yomi_entry_list *yl)
+mk_yomi_hash(struct mkdic_stat *mds, FILE *yomi_hash_out,
+	     struct yomi_entry_list *yl, int *hashes, int *blocks)
 {
-  unsigned char *hash_array;
-  int i;
-  struct yomi_entry *ye;
-  hash_array = (unsigned char *)malloc(YOMI_HASH_ARRAY_SIZE);
-  for (i = 0; i < YOMI_HASH_ARRAY_SIZE; i++) {
-    hash_array[i] = 0;
+  unsigned char *filter;
+  int i, nr_blocks, nr_hashes;
+  int nr = yl->nr_valid_entries;
+  int nr_dup = 0;
+  double bits;
+
+  /* 必要なビット数 m = -n ln(p) / (ln 2)^2 */
+  bits = -(nr > 0 ? nr : 1) * log(mds->bloom_error_rate) / (M_LN2 * M_LN2);
+  for (nr_blocks = 1;
+       (double)nr_blocks * WORD_DIC_BLOOM_BLOCK_BITS < bits;
+       nr_blocks *= 2);
+  /* ハッシュ関数の数 k = m / n ln 2 */
+  nr_hashes = (int)((double)nr_blocks * WORD_DIC_BLOOM_BLOCK_BITS /
+		    (nr > 0 ? nr : 1) * M_LN2 + 0.5);
+  if (nr_hashes < 1) {
+    nr_hashes = 1;
   }
-  for (i = 0; i < yl->nr_valid_entries; i++) {
-    ye = yl->ye_array[i];
-    mark_hash_array(hash_array, ye->index_xstr);
+  if (nr_hashes > WORD_DIC_BLOOM_MAX_HASHES) {
+    nr_hashes = WORD_DIC_BLOOM_MAX_HASHES;
+  }
+
+  filter = calloc(nr_blocks, WORD_DIC_BLOOM_BLOCK_BITS / 8);
+  for (i = 0; i < nr; i++) {
+    nr_dup += mark_bloom_filter(filter, nr_blocks, nr_hashes,
+				yl->ye_array[i]->index_xstr);
   }
-  fwrite(hash_array, YOMI_HASH_ARRAY_SIZE, 1, yomi_hash_out);
-  printf("generated yomi hash bitmap (%d collisions/%d entries)\n",
-	 yomi_hash_collision, yl->nr_valid_entries);
-	 
+  fwrite(filter, WORD_DIC_BLOOM_BLOCK_BITS / 8, nr_blocks, yomi_hash_out);
+  free(filter);
+  *hashes = nr_hashes;
+  *blocks = nr_blocks;
+  printf("generated yomi bloom filter (%d bytes, %d hashes, "
+	 "%d collisions/%d entries)\n",
+	 nr_blocks * WORD_DIC_BLOOM_BLOCK_BITS / 8, nr_hashes, nr_dup, nr);
 }
 
-/* ɤߡʻ졢ñλȤñι¤Τ */
+/* 読み、品詞、単語の三つ組から単語の構造体を取得する */
 static struct word_entry *
 find_word_entry(struct yomi_entry_list *yl, xstr *yomi,
 		const char *wt, char *word)
@@ -375,7 +459,7 @@ find_word_entry(struct yomi_entry_list *yl, xstr *yomi,
   return NULL;
 }
 		
-/* ĴΥޥɤŬѤ */
+/* 頻度調整のコマンドを適用する */
 static void
 apply_adjust_command(struct yomi_entry_list *yl,
 		     struct adjust_command *ac_list)
@@ -406,7 +490,7 @@ apply_adjust_command(struct yomi_entry_list *yl,
   }
 }
 
-/* qsortѤӴؿ */
+/* qsort用の比較関数 */
 static int
 compare_yomi_entry(const void *p1, const void *p2)
 {
@@ -415,14 +499,14 @@ compare_yomi_entry(const void *p1, const void *p2)
   return strcmp((*y1)->index_str, (*y2)->index_str);
 }
 
-/* yomi_entrysort */
+/* yomi_entryでsortする */
 static void
 sort_word_dict(struct yomi_entry_list *yl)
 {
   int i;
   struct yomi_entry *ye;
   yl->nr_valid_entries = 0;
-  /* ñɤߤ yl->ye_array˵ͤľ */
+  /* 単語を持つ読みだけを yl->ye_arrayに詰め直す */
   yl->ye_array = malloc(sizeof(struct yomi_entry *) * yl->nr_entries);
   for (i = 0, ye = yl->head; i < yl->nr_entries; i++, ye = ye->next) {
     if (ye->nr_entries > 0) {
@@ -435,11 +519,11 @@ sort_word_dict(struct yomi_entry_list *yl)
     struct yomi_entry *ye = yl->ye_array[i];
     ye->index_str = anthy_xstr_to_cstr(ye->index_xstr, ANTHY_UTF8_ENCODING);
   }
-  /* Ȥ */
+  /* ソートする */
   qsort(yl->ye_array, yl->nr_valid_entries,
 	sizeof(struct yomi_entry *),
 	compare_yomi_entry);
-  /* פñä */
+  /* 不要な単語を消す */
   yl->nr_words = 0;
   for (i = 0; i < yl->nr_valid_entries; i++) {
     struct yomi_entry *ye = yl->ye_array[i];
@@ -447,7 +531,7 @@ sort_word_dict(struct yomi_entry_list *yl)
   }
 }
 
-/** եΥ */
+/** ファイルのサイズを取得する */
 static int
 get_file_size(FILE *fp)
 {
@@ -481,42 +565,62 @@ copy_file(struct mkdic_stat *mds, FILE *in, FILE *out)
   }
 }
 
-static void
-generate_header(FILE *fp)
+/* ヘッダを初期化し、faの各セクションのオフセットを書き込む
+ * 最後のセクションの終わりのオフセットを返す */
+static int
+set_section_offsets(int *buf, struct file_section *fa)
 {
-  int buf[NR_HEADER_SECTIONS];
   int i;
   struct file_section *fs;
   int off;
 
-  /*  */
+  /* 初期化 */
   for (i = 0; i < NR_HEADER_SECTIONS; i++) {
     buf[i] = 0;
   }
 
-  /* إå */
+  /* ヘッダ */
   buf[0] = NR_HEADER_SECTIONS * sizeof(int);
-  buf[1] = 0;
+  buf[1] = WORD_ENTRY_BINARY;
 
-  /* ƥΥեå */
+  /* 各セクションのオフセット */
   off = buf[0];
-  for (i = 2, fs = file_array; fs->fpp; fs ++, i++) {
+  for (i = 2, fs = fa; fs->fpp; fs ++, i++) {
     buf[i] = off;
     off += get_file_size(*(fs->fpp));
   }
+  return off;
+}
+
+/* ヘッダとfaの各セクションのファイルを結合してfpへ出力する */
+static void
+write_sections(struct mkdic_stat *mds, int *buf,
+	       struct file_section *fa, FILE *fp)
+{
+  int i;
+  struct file_section *fs;
 
-  /* եؽϤ */
+  /* ヘッダを出力する */
   for (i = 0; i < NR_HEADER_SECTIONS; i++) {
     write_nl(fp, buf[i]);
   }
+
+  for (fs = fa; fs->fpp; fs ++) {
+    /* 各セクションのファイルを結合する */
+    copy_file(mds, *(fs->fpp), fp);
+    if (fs->fn) {
+      unlink(fs->fn);
+    }
+  }
 }
 
-/* ƥΥեޡơҤȤĤμե */
+/* 各セクションのファイルをマージして、ひとつの辞書ファイルを作る */
 static void
 link_dics(struct mkdic_stat *mds)
 {
   FILE *fp;
-  struct file_section *fs;
+  int buf[NR_HEADER_SECTIONS];
+  int end;
 
   fp = fopen (mds->output_fn, "w");
   if (!fp) {
@@ -525,14 +629,23 @@ link_dics(struct mkdic_stat *mds)
       exit (1);
   }
 
-  /* إåϤ */
-  generate_header(fp);
+  end = set_section_offsets(buf, file_array);
+  /* 先読みする領域の大きさ */
+  buf[WORD_DIC_HOT_SIZE_INDEX] = mds->hot_entry_size;
+  /* 読みのBloom filterの形 */
+  buf[WORD_DIC_BLOOM_HASHES_INDEX] = mds->bloom_hashes;
+  buf[WORD_DIC_BLOOM_BLOCKS_INDEX] = mds->bloom_blocks;
+  /* 逆変換用の辞書は最後のセクションの後ろに置く */
+  if (reverse_out) {
+    buf[WORD_DIC_REVERSE_INDEX] = end;
+  }
 
-  for (fs = file_array; fs->fpp; fs ++) {
-    /* ƥΥե礹 */
-    copy_file(mds, *(fs->fpp), fp);
-    if (fs->fn) {
-      unlink(fs->fn);
+  write_sections(mds, buf, file_array, fp);
+  if (reverse_out) {
+    copy_file(mds, reverse_out, fp);
+    fclose(reverse_out);
+    if (reverse_fn) {
+      unlink(reverse_fn);
     }
   }
 
@@ -543,25 +656,137 @@ link_dics(struct mkdic_stat *mds)
   }
 }
 
+/* 読みに単語をコピーする */
+static void
+copy_word_entry(struct yomi_entry *ye, struct word_entry *we, char *word)
+{
+  ye->entries = realloc(ye->entries,
+			sizeof(struct word_entry) *
+			(ye->nr_entries + 1));
+  ye->entries[ye->nr_entries] = *we;
+  ye->entries[ye->nr_entries].ye = ye;
+  ye->entries[ye->nr_entries].word_utf8 = word;
+  ye->nr_entries ++;
+}
+
+/* 逆変換用の単語を別の読みのリストに分ける
+ * 変換時に見える頻度(cost / 100)が負の単語は逆変換でしか使わないので、
+ * 通常の辞書から取り除く。頻度が0の単語はどちらからも見えるので両方に置く。
+ * 平仮名の読みは逆変換で読み自身が候補になるので、その目印として
+ * 空の単語を逆変換用の辞書に置く
+ */
+static void
+split_reverse_dict(struct mkdic_stat *mds)
+{
+  static char hira_mark[] = "";
+  struct yomi_entry_list *rl;
+  struct yomi_entry *ye;
+  int i;
+
+  rl = malloc(sizeof(struct yomi_entry_list));
+  rl->head = NULL;
+  rl->nr_entries = 0;
+  for (i = 0; i < YOMI_HASH; i++) {
+    rl->hash[i] = NULL;
+  }
+
+  for (ye = mds->yl.head; ye; ye = ye->next) {
+    int is_hira = anthy_get_xstr_type(ye->index_xstr) & XCT_HIRA;
+    struct yomi_entry *rye = NULL;
+    int nr = 0;
+    for (i = 0; i < ye->nr_entries; i++) {
+      struct word_entry *we = &ye->entries[i];
+      int freq = we->cost / 100;
+      if (freq <= 0 || is_hira) {
+	if (!rye) {
+	  rye = find_yomi_entry(rl, ye->index_xstr, 1);
+	}
+	copy_word_entry(rye, we, freq > 0 ? hira_mark : we->word_utf8);
+      }
+      if (freq >= 0) {
+	ye->entries[nr] = *we;
+	nr ++;
+      }
+    }
+    ye->nr_entries = nr;
+  }
+  mds->reverse_yl = rl;
+}
+
+/* 逆変換用の辞書を作り、reverse_outにまとめておく */
+static void
+write_reverse_dict(struct mkdic_stat *mds)
+{
+  struct yomi_entry_list *rl = mds->reverse_yl;
+  FILE *saved_index_out = yomi_entry_index_out;
+  FILE *saved_entry_out = yomi_entry_out;
+  FILE *saved_page_out = page_out;
+  FILE *saved_page_index_out = page_index_out;
+  int buf[NR_HEADER_SECTIONS];
+  int hashes, blocks;
+  struct file_section *fs;
+
+  printf("writing reverse index\n");
+  sort_word_dict(rl);
+  open_output_files(reverse_file_array);
+
+  /* writewords.cの出力先を切り替える */
+  yomi_entry_index_out = rev_entry_index_out;
+  yomi_entry_out = rev_entry_out;
+  page_out = rev_page_out;
+  page_index_out = rev_page_index_out;
+  output_word_dict(rl, 0);
+  mk_yomi_hash(mds, rev_hash_out, rl, &hashes, &blocks);
+  yomi_entry_index_out = saved_index_out;
+  yomi_entry_out = saved_entry_out;
+  page_out = saved_page_out;
+  page_index_out = saved_page_index_out;
+
+  for (fs = reverse_file_array; fs->fpp; fs ++) {
+    if (fflush(*(fs->fpp))) {
+      fprintf (stderr, "%s: write error: %s\n", progname, strerror (errno));
+      exit (1);
+    }
+  }
+  set_section_offsets(buf, reverse_file_array);
+  buf[WORD_DIC_BLOOM_HASHES_INDEX] = hashes;
+  buf[WORD_DIC_BLOOM_BLOCKS_INDEX] = blocks;
+  reverse_out = mkdic_tmpfile(&reverse_fn);
+  write_sections(mds, buf, reverse_file_array, reverse_out);
+  for (fs = reverse_file_array; fs->fpp; fs ++) {
+    fclose(*(fs->fpp));
+  }
+}
+
 static void
 complete_words(struct mkdic_stat *mds)
 {
-  /* ŬѤ */
+  /* 頻度補正を適用する */
   apply_adjust_command(&mds->yl, &mds->ac_list);
 
   /**/
   calc_freq(&mds->yl);
 
-  /* ɤߤ¤ؤ */
+  /* 逆変換用の単語を分ける */
+  if (mds->build_reverse) {
+    split_reverse_dict(mds);
+  }
+
+  /* 読みで並び替える */
   sort_word_dict(&mds->yl);
 
-  /* ե */
-  open_output_files();
-  /* ñ켭Ϥ */
-  output_word_dict(&mds->yl);
+  /* ファイルを準備する */
+  open_output_files(file_array);
+  /* 単語辞書を出力する */
+  mds->hot_entry_size = output_word_dict(&mds->yl, mds->nr_hot_entries);
+
+  /* 読みハッシュを作る */
+  mk_yomi_hash(mds, yomi_hash_out, &mds->yl,
+	       &mds->bloom_hashes, &mds->bloom_blocks);
 
-  /* ɤߥϥå */
-  mk_yomi_hash(yomi_hash_out, &mds->yl);
+  if (mds->reverse_yl) {
+    write_reverse_dict(mds);
+  }
 }
 
 static void
@@ -588,7 +813,7 @@ xstr_strncat(xstr* xs, xchar* src, int n)
   return xs;
 }
 
-/* ʣǤĹ 1,2,3, ... 9,a,b,c */
+/* 複合語の要素の長さは 1,2,3, ... 9,a,b,c */
 int
 get_compound_element_len(xchar xc)
 {
@@ -605,13 +830,13 @@ static void
 reverse_multi_segment_word(struct mkdic_stat *mds, struct word_entry *we)
 {
   /*
-    ֤ʤ󤸤ؤ󤫤󤨤󤸤 #T35 #_2̾_3_4Ѵ_4󥸥
-    
-    ֲ̾Ѵ󥸥 #T35 #_2_2_2ؤ󤫤_4󤸤
-    
+    「かなかんじへんかんえんじん #T35 #_2仮名_3漢字_4変換_4エンジン」
+    から
+    「仮名漢字変換エンジン #T35 #_2かな_2かんじ_2へんかん_4えんじん」
+    を作る
   */
   int j;
-  /* yomiϲ̾ wordʿ̾Τߤʤ */
+  /* yomiは仮名漢字混じり wordは平仮名のみからなる */
   int yomi_seg_start = 0;
   int word_seg_start = 0;
   int word_seg_len = 0;
@@ -644,7 +869,7 @@ reverse_multi_segment_word(struct mkdic_stat *mds, struct word_entry *we)
   target_ye = find_yomi_entry(&mds->yl, yomi_xs, 1);
   word = anthy_xstr_to_cstr(word_xs, mds->input_encoding);
 
-  /* ѴѤμfreq */
+  /* 逆変換用の辞書はfreqが負 */
   push_back_word_entry(mds, target_ye, we->wt_name, -we->raw_freq,
 		       word, we->source_order);
 
@@ -654,7 +879,7 @@ reverse_multi_segment_word(struct mkdic_stat *mds, struct word_entry *we)
   anthy_free_xstr(word_xs);
 }
 
-/* ѴѤμ */
+/* 逆変換用の辞書を作る */
 static void
 build_reverse_dict(struct mkdic_stat *mds)
 {
@@ -662,16 +887,17 @@ build_reverse_dict(struct mkdic_stat *mds)
   int i, n;
   struct word_entry *we_array;
   printf("building reverse index\n");
+  mds->build_reverse = 1;
 
-  /* ñο */
+  /* 単語の数を数える */
   n = 0;
   for (ye = mds->yl.head; ye; ye = ye->next) {
     for (i = 0; i < ye->nr_entries; i++) {
       n++;
     }
   }
-  /* ԡ
-   * (μΥݥ󥿤reallocưΤǥԡɬ)
+  /* コピーする
+   * (元の辞書中のポインタはreallocで動くのでコピーが必要)
    */
   we_array = malloc(sizeof(struct word_entry )* n);
   n = 0;
@@ -682,7 +908,7 @@ build_reverse_dict(struct mkdic_stat *mds)
     }
   }
 
-  /* ɲäƤ */
+  /* 辞書に追加していく */
   for (i = 0; i < n; i++) {
     struct word_entry *we;
     struct yomi_entry *target_ye;
@@ -693,7 +919,7 @@ build_reverse_dict(struct mkdic_stat *mds)
 	reverse_multi_segment_word(mds, we);
       }
     } else {
-      /* yomiϲ̾ wordʿ̾Τߤʤ */
+      /* yomiは仮名漢字混じり wordは平仮名のみからなる */
       xstr *yomi_xs;
       char *word;
 
@@ -701,7 +927,7 @@ build_reverse_dict(struct mkdic_stat *mds)
       target_ye = find_yomi_entry(&mds->yl, yomi_xs, 1);
       word = anthy_xstr_to_cstr(we->ye->index_xstr, mds->input_encoding);
 
-      /* ѴѤμfreq */
+      /* 逆変換用の辞書はfreqが負 */
       push_back_word_entry(mds, target_ye, we->wt_name, -we->raw_freq,
 			   word, we->source_order);
 
@@ -757,10 +983,10 @@ write_dict_file(struct mkdic_stat *mds)
     exit(1);
   }
 
-  /* 㼭 */
+  /* 用例辞書を作る */
   make_ucdict(uc_out, mds->ud);
 
-  /* եˤޤȤ */
+  /* 辞書ファイルにまとめる */
   flush_output_files();
   link_dics(mds);
 }
@@ -789,10 +1015,17 @@ execute_batch(struct mkdic_stat *mds, const char *fn)
     char *cmd = tokens[0];
     show_command(tokens, nr);
     if (!strcmp(cmd, "read") && nr == 2) {
-      read_traditional_dict_file(mds, tokens[1]);
+      queue_word_source(mds, tokens[1], 1);
+      anthy_free_line();
+      continue;
     } else if (!strcmp(cmd, "read_ld") && nr == 2) {
-      read_dict_file(mds, tokens[1]);
-    } else if (!strcmp(cmd, "read_uc") && nr == 2) {
+      queue_word_source(mds, tokens[1], 0);
+      anthy_free_line();
+      continue;
+    }
+    /* 溜めておいたファイルを読み込む */
+    flush_word_sources(mds);
+    if (!strcmp(cmd, "read_uc") && nr == 2) {
       read_udict_file(mds, tokens[1]);
     } else if (!strcmp(cmd, "build_reverse_dict")) {
       build_reverse_dict(mds);
@@ -812,11 +1045,12 @@ execute_batch(struct mkdic_stat *mds, const char *fn)
     }
     anthy_free_line();
   }
+  flush_word_sources(mds);
   anthy_close_file();
   return 0;
 }
 
-/* Τѿν */
+/* 辞書生成のための変数の初期化 */
 static void
 init_mds(struct mkdic_stat *mds)
 {
@@ -824,7 +1058,7 @@ init_mds(struct mkdic_stat *mds)
   mds->output_fn = DEFAULT_FN;
   mds->ud = NULL;
 
-  /* ñ켭 */
+  /* 単語辞書を初期化する */
   mds->yl.head = NULL;
   mds->yl.nr_entries = 0;
   for (i = 0; i < YOMI_HASH; i++) {
@@ -839,9 +1073,28 @@ init_mds(struct mkdic_stat *mds)
   mds->excluded_wtypes = NULL;
   /**/
   mds->freq_order = 1;
+  /**/
+  mds->nr_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  if (mds->nr_jobs < 1) {
+    mds->nr_jobs = 1;
+  }
+  mds->sort_memory = DEFAULT_SORT_MEMORY;
+  mds->nr_sources = 0;
+  mds->sources = NULL;
+  mds->cache_dir = NULL;
+  mds->nr_cached_runs = 0;
+  mds->cached_runs = NULL;
+  mds->run = NULL;
+  mds->nr_hot_entries = 0;
+  mds->hot_entry_size = 0;
+  mds->bloom_error_rate = DEFAULT_BLOOM_ERROR_RATE;
+  mds->bloom_hashes = 0;
+  mds->bloom_blocks = 0;
+  mds->build_reverse = 0;
+  mds->reverse_yl = NULL;
 }
 
-/* libanthyλѤʬ */
+/* libanthyの使用する部分だけを初期化する */
 static void
 init_libs(void)
 {
@@ -875,11 +1128,35 @@ main(int argc, char **argv)
     if (!strcmp(prev_arg, "-f")) {
       script_fn = arg;
     }
+    if (!strcmp(prev_arg, "-j") && atoi(arg) > 0) {
+      mds.nr_jobs = atoi(arg);
+    }
+    if (!strcmp(prev_arg, "-c")) {
+      mds.cache_dir = arg;
+    }
+    if (!strcmp(prev_arg, "-m") && atoi(arg) > 0) {
+      /* MB単位 */
+      mds.sort_memory = atol(arg) * 1024 * 1024;
+    }
+    if (!strcmp(prev_arg, "-H") && atoi(arg) > 0) {
+      mds.nr_hot_entries = atoi(arg);
+    }
+    if (!strcmp(prev_arg, "-e") && atof(arg) > 0 && atof(arg) < 1) {
+      mds.bloom_error_rate = atof(arg);
+    }
   }
 
   if (help_mode || !script_fn) {
     print_usage();
   }
+  if (mds.cache_dir) {
+    /* 既にあれば失敗するが構わない */
+    mkdir(mds.cache_dir, 0777);
+  }
 
-  return execute_batch(&mds, script_fn);
+  if (execute_batch(&mds, script_fn)) {
+    return 1;
+  }
+  prune_run_cache(&mds);
+  return 0;
 }
@@ -4,34 +4,34 @@
 #include <stdio.h>
 #include <anthy/xstr.h>
 
-/** ñ */
+/** 単語 */
 struct word_entry {
-  /** ʻ̾ */
+  /** 品詞名 */
   const char *wt_name;
-  /**  */
+  /** 頻度 */
   int raw_freq;
   int source_order;
-  /* (٤ε) */
+  /* コスト(頻度の逆) */
   int cost;
-  /*  */
+  /* 素性 */
   int feature;
-  /** ñ */
+  /** 単語 */
   char *word_utf8;
-  /** եΥեå */
+  /** 辞書ファイル中のオフセット */
   int offset;
-  /** °yomi_entry*/
+  /** 属すyomi_entry*/
   struct yomi_entry* ye;
 };
 
-/** ɤ */
+/** ある読み */
 struct yomi_entry {
-  /* ɤߤʸ */
+  /* 読みの文字列 */
   xstr *index_xstr;
-  /* ɤߤʸ(եΥǥå) */
+  /* 読みの文字列(辞書ファイル内のインデックス) */
   char *index_str;
-  /* եΥڡΥեå */
+  /* 辞書ファイル中のページ中のオフセット */
   int offset;
-  /* ƥȥ */
+  /* 各エントリ */
   int nr_entries;
   struct word_entry *entries;
   /**/
@@ -41,15 +41,15 @@ struct yomi_entry {
 
 #define YOMI_HASH (16384 * 16)
 
-/*  */
+/* 辞書全体 */
 struct yomi_entry_list {
-  /* ФΥꥹ */
+  /* 見出しのリスト */
   struct yomi_entry *head;
-  /* եθФο */
+  /* 辞書ファイル中の見出しの数 */
   int nr_entries;
-  /* ФñĤΤο */
+  /* 見出しの中で単語を持つものの数 */
   int nr_valid_entries;
-  /* ñο */
+  /* 単語の数 */
   int nr_words;
   /**/
   struct yomi_entry *hash[YOMI_HASH];
@@ -60,7 +60,7 @@ struct yomi_entry_list {
 #define ADJUST_FREQ_DOWN 2
 #define ADJUST_FREQ_KILL 3
 
-/* ѥޥ */
+/* 頻度補正用コマンド */
 struct adjust_command {
   int type;
   xstr *yomi;
@@ -70,13 +70,13 @@ struct adjust_command {
 };
 
 
-/* ξ */
+/* 辞書生成の状態 */
 struct mkdic_stat {
-  /* ñΥꥹ */
+  /* 単語のリスト */
   struct yomi_entry_list yl;
   /**/
   struct adjust_command ac_list;
-  /* 㼭 */
+  /* 用例辞書 */
   struct uc_dict *ud;
   /**/
   const char *output_fn;
@@ -87,6 +87,31 @@ struct mkdic_stat {
   char **excluded_wtypes;
   /**/
   int freq_order;
+  /* 並列に読み込むプロセスの数 */
+  int nr_jobs;
+  /* 読み込み時に溜めておくメモリの上限(バイト) */
+  long sort_memory;
+  /* 読み込み待ちのファイル */
+  int nr_sources;
+  struct word_source *sources;
+  /* 読み込んだ結果をキャッシュするディレクトリ */
+  const char *cache_dir;
+  /* 今回使ったキャッシュのファイル名 */
+  int nr_cached_runs;
+  char **cached_runs;
+  /* 子プロセスでの読み込み中はランの出力先 */
+  struct run_writer *run;
+  /* 辞書の先頭にまとめる頻度の高い読みの数 */
+  int nr_hot_entries;
+  /* 先頭にまとめたエントリのバイト数 */
+  int hot_entry_size;
+  /* 読みのBloom filterの誤検出率と形 */
+  double bloom_error_rate;
+  int bloom_hashes;
+  int bloom_blocks;
+  /* 逆変換用の辞書を別に作るか、その単語のリスト */
+  int build_reverse;
+  struct yomi_entry_list *reverse_yl;
 };
 
 #define INVALID_FREQ 99999
@@ -96,29 +121,46 @@ struct mkdic_stat {
 struct yomi_entry *find_yomi_entry(struct yomi_entry_list *yl,
 				   xstr *index, int create);
 
-/* 񤭽ФѤ */
+/* 辞書書き出し用の補助 */
 void write_nl(FILE *fp, int i);
+FILE *mkdic_open_tmpfile(char **fnp);
+FILE *mkdic_tmpfile(char **fnp);
 
 /**/
 const char *get_wt_name(const char *name);
 void push_back_word_entry(struct mkdic_stat *mds,
 			  struct yomi_entry *ye, const char *wt_name,
 			  int freq, const char *word, int order);
+void append_word_entry(struct yomi_entry *ye, const char *wt_name,
+		       int freq, char *word_utf8, int order);
 int get_compound_element_len(xchar xc);
 
 /* mkudic.c
- * 㼭 */
+ * 用例辞書を作る */
 struct uc_dict *create_uc_dict(void);
 void read_uc_file(struct uc_dict *ud, const char *fn);
 void make_ucdict(FILE *out, struct uc_dict *uc);
 /**/
 
 /* writewords.c */
-void output_word_dict(struct yomi_entry_list *yl);
+int output_word_dict(struct yomi_entry_list *yl, int nr_hot);
 
 /* readwords.c */
 void read_traditional_dict_file(struct mkdic_stat *mds, const char *fn);
 void read_dict_file(struct mkdic_stat *mds, const char *fn);
+int parse_word_source(struct mkdic_stat *mds, const char *fn, int traditional);
+void read_adjust_command(struct mkdic_stat *mds, const char *buf);
+
+/* runsort.c
+ * 辞書ソースの並列読み込み */
+void queue_word_source(struct mkdic_stat *mds, const char *fn,
+		       int traditional);
+void flush_word_sources(struct mkdic_stat *mds);
+void prune_run_cache(struct mkdic_stat *mds);
+void run_add_yomi(struct run_writer *rw, xstr *yomi);
+void run_add_word(struct run_writer *rw, const char *wt_name, int freq,
+		  const char *word_utf8, int order);
+void run_add_adjust_command(struct run_writer *rw, const char *line);
 
 /* calcfreq.c */
 void calc_freq(struct yomi_entry_list *yl);
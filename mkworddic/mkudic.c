@@ -1,5 +1,5 @@
 /*
- * 㼭
+ * 用例辞書を作る
  *
  * Copyright (C) 2003-2005 TABATA Yusuke
  */
@@ -12,20 +12,20 @@
 
 #define LINE_LEN 256
 
-/*  */
+/* 用例 */
 struct use_case {
   int id[2];
   struct use_case *next;
 };
 
-/* 㼭 */
+/* 用例辞書 */
 struct uc_dict {
-  /* ꥹ */
+  /* 用例リスト */
   struct use_case uc_head;
   int nr_ucs;
 };
 
-/* ιԤñid
+/* 用例定義の行から単語のidを求める
  */
 static int
 get_id_from_word_line(char *buf)
@@ -63,7 +63,7 @@ commit_uc(struct uc_dict *dict, int x, int y)
   dict->nr_ucs ++;
 }
 
-/* ǡ١ */
+/* 用例データベースを作る */
 struct uc_dict *
 create_uc_dict(void)
 {
@@ -75,7 +75,7 @@ create_uc_dict(void)
   return dict;
 }
 
-/* եɤ߹ */
+/* 用例ファイルを読み込む */
 void
 read_uc_file(struct uc_dict *dict, const char *fn)
 {
@@ -89,8 +89,8 @@ read_uc_file(struct uc_dict *dict, const char *fn)
     return ;
   }
 
-  /* off=0      : ǽñ
-   * off=1,2..n : ȴطñ
+  /* off=0      : 最初の単語
+   * off=1,2..n : それと関係ある単語
    */
   off = 0;
   while (fgets(buf, LINE_LEN, uc_file)) {
@@ -98,11 +98,11 @@ read_uc_file(struct uc_dict *dict, const char *fn)
     line_number ++;
     /**/
     if (buf[0] == '#') {
-      /*  */
+      /* コメント */
       continue;
     }
     if (buf[0] == '-') {
-      /* ڤ국 */
+      /* 区切り記号 */
       off = 0;
       continue;
     }
@@ -112,17 +112,17 @@ read_uc_file(struct uc_dict *dict, const char *fn)
     }
     /**/
     if (off == 0) {
-      /* Ĥι */
+      /* 一つめの項目 */
       base = cur;
     } else {
-      /* Ĥʹߤι */
+      /* 二つめ以降の項目 */
       commit_uc(dict, cur, base);
     }
     off ++;
   }
 }
 
-/* 㼭ե˽񤭽Ф */
+/* 用例辞書をファイルに書き出す */
 void
 make_ucdict(FILE *uc_out, struct uc_dict *dict)
 {
@@ -130,7 +130,7 @@ make_ucdict(FILE *uc_out, struct uc_dict *dict)
   struct sparse_matrix *sm;
   struct matrix_image *mi;
   int i;
-  /* ¹˵ͤ */
+  /* 疎行列に詰め込む */
   sm = anthy_sparse_matrix_new();
   if (dict) {
     for (uc = dict->uc_head.next; uc; uc = uc->next) {
@@ -138,7 +138,7 @@ make_ucdict(FILE *uc_out, struct uc_dict *dict)
     }
   }
   anthy_sparse_matrix_make_matrix(sm);
-  /* ¹Υ᡼ƥե˽񤭽Ф */
+  /* 疎行列のイメージを作成してファイルに書き出す */
   mi = anthy_matrix_image_new(sm);
   for (i = 0; i < mi->size; i++) {
     write_nl(uc_out, mi->image[i]);
@@ -1,5 +1,5 @@
 /*
- * եɤ߹िΥ
+ * 辞書ファイルを読み込むためのコード
  *
  * Copyright (C) 2000-2006 TABATA Yusuke
  */
@@ -77,8 +77,31 @@ parse_adjust_command(const char *buf, struct adjust_command *ac_list)
   }
 }
 
+/** 頻度調整のコマンドを登録する */
+void
+read_adjust_command(struct mkdic_stat *mds, const char *buf)
+{
+  if (mds->run) {
+    run_add_adjust_command(mds->run, buf);
+    return ;
+  }
+  parse_adjust_command(buf, &mds->ac_list);
+}
+
+/** 読みに対するyomi_entryを返す
+ * 子プロセスで読み込み中は読みを記録してNULLを返す */
+static struct yomi_entry *
+get_yomi_entry(struct mkdic_stat *mds, xstr *index)
+{
+  if (mds->run) {
+    run_add_yomi(mds->run, index);
+    return NULL;
+  }
+  return find_yomi_entry(&mds->yl, index, 1);
+}
+
 
-/** cannadicμιԤindexȤʤʬФ */
+/** cannadic形式の辞書の行からindexとなる部分を取り出す */
 static xstr *
 get_index_from_line(struct mkdic_stat *mds, char *buf)
 {
@@ -86,7 +109,7 @@ get_index_from_line(struct mkdic_stat *mds, char *buf)
   xstr *xs;
   sp = strchr(buf, ' ');
   if (!sp) {
-    /* ΥեޥåȤ */
+    /* 辞書のフォーマットがおかしい */
     return NULL;
   }
   *sp = 0;
@@ -95,7 +118,7 @@ get_index_from_line(struct mkdic_stat *mds, char *buf)
   return xs;
 }
 
-/** cannadicμιԤindexʳʬФ */
+/** cannadic形式の辞書の行からindex以外の部分を取り出す */
 static char *
 get_entry_from_line(char *buf)
 {
@@ -110,7 +133,7 @@ get_entry_from_line(char *buf)
 static char *
 read_line(FILE *fp, char *buf)
 {
-  /* ĹԤ̵뤹 */
+  /* 長すぎる行を無視する */
   int toolong = 0;
 
   if (feof(fp)) {
@@ -140,14 +163,14 @@ read_line(FILE *fp, char *buf)
 static int
 parse_wtype(char *wtbuf, char *cur)
 {
-  /* ʻ */
+  /* 品詞 */
   char *t;
   int freq;
   if (strlen(cur) >= MAX_WTYPE_LEN) {
     return 0;
   }
   strcpy(wtbuf, cur);
-  /*  */
+  /* 頻度 */
   t = strchr(wtbuf, '*');
   freq = 1;
   if (t) {
@@ -190,11 +213,11 @@ find_token_end(char *cur)
   return n;
 }
 
-/** ʣηå */
+/** 複合候補の形式チェック */
 static int
 check_compound_candidate(struct mkdic_stat *mds, xstr *index, const char *cur)
 {
-  /* ɤߤʸιפ */
+  /* 読みの文字数の合計を数える */
   xstr *xs = anthy_cstr_to_xstr(cur, mds->input_encoding);
   int i, total = 0;
   for (i = 0; i < xs->len - 1; i++) {
@@ -203,7 +226,7 @@ check_compound_candidate(struct mkdic_stat *mds, xstr *index, const char *cur)
     }
   }
   anthy_free_xstr(xs);
-  /* Ӥ */
+  /* 比較する */
   if (total != index->len) {
     fprintf(stderr, "Invalid compound candidate (%s, length = %d).\n",
 	    cur, total);
@@ -212,10 +235,10 @@ check_compound_candidate(struct mkdic_stat *mds, xstr *index, const char *cur)
   return 1;
 }
 
-/** ɤߤбԤʬ䤷ơ */
+/** 読みに対応する行を分割して、配列を構成する */
 static void
 push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
-			  const char *ent)
+			  xstr *index, const char *ent)
 {
   char *buf = alloca(strlen(ent) + 1);
   char *cur = buf;
@@ -234,7 +257,7 @@ push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
   wtbuf[0] = 0;
 
   while (1) {
-    /* ȡ\0ڤ롣curθζ\0õ */
+    /* トークンを\0で切る。curの後の空白か\0を探す */
     n = find_token_end(cur);
     if (!n) {
       fprintf(stderr, "invalid \\ at the end of line (%s).\n",
@@ -249,7 +272,7 @@ push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
     /**/
     if (cur[0] == '#') {
       if (isalpha((unsigned char)cur[1])) {
-	/* #XX*?? ѡ */
+	/* #XX*?? をパース */
 	freq = parse_wtype(wtbuf, cur);
 	/**/
 	if (!mds->freq_order) {
@@ -257,16 +280,16 @@ push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
 	}
       } else {
 	if (cur[1] == '_' &&
-	    check_compound_candidate(mds, ye->index_xstr, &cur[1])) {
-	  /* #_ ʣ */
+	    check_compound_candidate(mds, index, &cur[1])) {
+	  /* #_ 複合候補 */
 	  push_back_word_entry(mds, ye, wtbuf, freq, cur, order);
 	  order ++;
 	}
       }
     } else {
-      /* ʻ줬ꥹȤäƤ뤫å */
+      /* 品詞が除去リストに入っているかをチェック */
       if (!is_excluded_wtype(mds, wtbuf)) {
-	/* ñɲ */
+	/* 単語を追加 */
 	push_back_word_entry(mds, ye, wtbuf, freq, cur, order);
 	order ++;
       }/* :to extract excluded words
@@ -276,7 +299,7 @@ push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
 	  }*/
     }
     if (!n) {
-      /*  */
+      /* 行末 */
       return ;
     }
     cur = n;
@@ -284,8 +307,8 @@ push_back_word_entry_line(struct mkdic_stat *mds, struct yomi_entry *ye,
   }
 }
 
-/** Ԥɤ߹ǥꥹȤ
- * ΥޥɤΥ */
+/** 辞書を一行ずつ読み込んでリストを作る
+ * このコマンドのコア */
 static void
 parse_traditional_dict_file(FILE *fin, struct mkdic_stat *mds)
 {
@@ -294,10 +317,10 @@ parse_traditional_dict_file(FILE *fin, struct mkdic_stat *mds)
   char *ent;
   struct yomi_entry *ye = NULL;
 
-  /* ԤĽ */
+  /* １行ずつ処理 */
   while (read_line(fin, buf)) {
     if (buf[0] == '\\' && buf[1] != ' ') {
-      parse_adjust_command(buf, &mds->ac_list);
+      read_adjust_command(mds, buf);
       continue ;
     }
     index_xs = get_index_from_line(mds, buf);
@@ -306,10 +329,10 @@ parse_traditional_dict_file(FILE *fin, struct mkdic_stat *mds)
     }
     ent = get_entry_from_line(buf);
 
-    /* ɤߤ30ʸ̵ۤ */
+    /* 読みが30文字を越える場合は無視 */
     if (index_xs->len < 31) {
-      ye = find_yomi_entry(&mds->yl, index_xs, 1);
-      push_back_word_entry_line(mds, ye, ent);
+      ye = get_yomi_entry(mds, index_xs);
+      push_back_word_entry_line(mds, ye, index_xs, ent);
     }
 
     free(ent);
@@ -340,6 +363,7 @@ parse_dict_file(FILE *fin, struct mkdic_stat *mds)
   char buf[MAX_LINE_LEN];
   char *idx = NULL;
   struct yomi_entry *ye = NULL;
+  int has_ye = 0;
   while (fgets(buf, MAX_LINE_LEN, fin)) {
     if (buf[0] == '#') {
       continue;
@@ -347,12 +371,12 @@ parse_dict_file(FILE *fin, struct mkdic_stat *mds)
     chomp(buf);
     /**/
     if (strlen(buf) == 0) {
-      /*  */
+      /* 空行 */
       continue;
     }
     /**/
     if (buf[0] == '[') {
-      /* Ф */
+      /* 見出し語 */
       char *p = strchr(buf, ']');
       if (p) {
 	*p = 0;
@@ -360,12 +384,14 @@ parse_dict_file(FILE *fin, struct mkdic_stat *mds)
       free(idx);
       idx = strdup(buf);
       ye = NULL;
+      has_ye = 0;
       continue;
     }
-    /* ñ */
-    if (!ye) {
+    /* 単語定義 */
+    if (!has_ye) {
       xstr *xs = anthy_cstr_to_xstr(idx, mds->input_encoding);
-      ye = find_yomi_entry(&mds->yl, xs, 1);
+      ye = get_yomi_entry(mds, xs);
+      has_ye = 1;
       anthy_free_xstr(xs);
     }
     parse_word_def(mds, ye, buf);
@@ -373,6 +399,24 @@ parse_dict_file(FILE *fin, struct mkdic_stat *mds)
   free(idx);
 }
 
+/** 辞書ファイルを読み込む
+ * ファイルを開けなければ-1を返す */
+int
+parse_word_source(struct mkdic_stat *mds, const char *fn, int traditional)
+{
+  FILE *fp = fopen(fn, "r");
+  if (!fp) {
+    return -1;
+  }
+  if (traditional) {
+    parse_traditional_dict_file(fp, mds);
+  } else {
+    parse_dict_file(fp, mds);
+  }
+  fclose(fp);
+  return 0;
+}
+
 void
 read_traditional_dict_file(struct mkdic_stat *mds, const char *fn)
 {
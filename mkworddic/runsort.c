@@ -0,0 +1,829 @@
+/*
+ * 辞書ソースの並列読み込みと外部ソート
+ *
+ * 連続した read, read_ld コマンドで指定されたファイルをまとめておき、
+ * 次のコマンドが来た時点でファイル毎に子プロセスで読み込む。
+ * 子プロセスは読み込んだ内容をレコード(run_record)の列として
+ * 読み順に整列し、一時ファイル(ラン)に書き出す。メモリの上限を
+ * 越えた場合は途中の結果を一時ファイルに吐き出して最後にマージする。
+ *
+ * 親プロセスは各ファイルのランをマージしながら単語を登録する。
+ * 各レコードは元の読み込み順の番号を持っているので、
+ * 逐次に読み込んだ場合と同じ辞書が生成される。
+ * メモリの上限は子プロセスの読み込みに対するもので、親プロセスは
+ * 頻度の補正や用例辞書のために従来通り全ての単語をメモリ上に持つ。
+ *
+ * キャッシュのディレクトリが指定された場合はランをそこに残しておき、
+ * ファイルの内容と読み込みの設定とmkworddic自身が同じであれば次回は
+ * それを使う。今回使わなかったランは最後に消す。
+ *
+ * Copyright (C) 2000-2007 TABATA Yusuke
+ */
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <config.h>
+
+#include <anthy/xstr.h>
+#include "mkdic.h"
+
+/* レコードの種類 */
+#define RR_ADJUST 0
+#define RR_YOMI 1
+#define RR_WORD 2
+
+/* 子プロセスの終了コード */
+#define RUN_OK 0
+#define RUN_NO_FILE 3
+#define RUN_WRITE_ERROR 4
+
+/* ランの形式を変えた場合はキャッシュを無効にするために変える */
+#define RUN_FORMAT_VERSION 1
+
+/* 読み込むファイル */
+struct word_source {
+  char *fn;
+  int traditional;
+  /* ランを書き出すファイル */
+  FILE *run_fp;
+  char *run_fn;
+  /* キャッシュのファイル名とキャッシュを使ったか */
+  char *cache_fn;
+  int cached;
+  /* 子プロセスのpidと終了コード */
+  pid_t pid;
+  int status;
+};
+
+/* ランの中のレコード */
+struct run_record {
+  int type;
+  /* 読み込み順の番号 */
+  int seq;
+  xstr yomi;
+  int freq;
+  int order;
+  /* 品詞名, 単語(UTF-8), 頻度調整のコマンド */
+  char *wt;
+  char *word;
+};
+
+/* 子プロセスでレコードを溜めておくところ */
+struct run_writer {
+  struct run_record *recs;
+  int nr_recs;
+  int array_size;
+  /* 溜めているレコードの大きさとその上限 */
+  long mem;
+  long limit;
+  /* 吐き出したランの一時ファイル */
+  FILE **chunks;
+  int nr_chunks;
+  /* 一時ファイルに書けなかった */
+  int error;
+  /**/
+  int seq;
+  xstr *cur_yomi;
+};
+
+/* ランからレコードを読む */
+struct run_reader {
+  FILE *fp;
+  struct run_record rec;
+  int valid;
+};
+
+static void
+write_str(FILE *fp, const char *s)
+{
+  int len = s ? (int)strlen(s) : -1;
+  fwrite(&len, sizeof(int), 1, fp);
+  if (len > 0) {
+    fwrite(s, len, 1, fp);
+  }
+}
+
+static char *
+read_str(FILE *fp)
+{
+  int len;
+  char *s;
+  if (fread(&len, sizeof(int), 1, fp) != 1 || len < 0) {
+    return NULL;
+  }
+  s = malloc(len + 1);
+  if (len > 0 && fread(s, len, 1, fp) != 1) {
+    free(s);
+    return NULL;
+  }
+  s[len] = 0;
+  return s;
+}
+
+static void
+write_record(FILE *fp, struct run_record *rr)
+{
+  fwrite(&rr->type, sizeof(int), 1, fp);
+  fwrite(&rr->seq, sizeof(int), 1, fp);
+  fwrite(&rr->freq, sizeof(int), 1, fp);
+  fwrite(&rr->order, sizeof(int), 1, fp);
+  fwrite(&rr->yomi.len, sizeof(int), 1, fp);
+  fwrite(rr->yomi.str, sizeof(xchar), rr->yomi.len, fp);
+  write_str(fp, rr->wt);
+  write_str(fp, rr->word);
+}
+
+/* 成功すれば0を返す */
+static int
+read_record(FILE *fp, struct run_record *rr)
+{
+  if (fread(&rr->type, sizeof(int), 1, fp) != 1 ||
+      fread(&rr->seq, sizeof(int), 1, fp) != 1 ||
+      fread(&rr->freq, sizeof(int), 1, fp) != 1 ||
+      fread(&rr->order, sizeof(int), 1, fp) != 1 ||
+      fread(&rr->yomi.len, sizeof(int), 1, fp) != 1 ||
+      rr->yomi.len < 0) {
+    return -1;
+  }
+  rr->yomi.str = malloc(sizeof(xchar) * (rr->yomi.len + 1));
+  if (fread(rr->yomi.str, sizeof(xchar), rr->yomi.len, fp) !=
+      (size_t)rr->yomi.len) {
+    free(rr->yomi.str);
+    return -1;
+  }
+  rr->wt = read_str(fp);
+  rr->word = read_str(fp);
+  return 0;
+}
+
+static void
+free_record(struct run_record *rr)
+{
+  free(rr->yomi.str);
+  free(rr->wt);
+  free(rr->word);
+}
+
+/* 読み、読み込み順の順に並べる */
+static int
+compare_record(const struct run_record *r1, const struct run_record *r2)
+{
+  int ret = anthy_xstrcmp((xstr *)&r1->yomi, (xstr *)&r2->yomi);
+  if (ret) {
+    return ret;
+  }
+  return r1->seq - r2->seq;
+}
+
+/** qsort用の比較関数 */
+static int
+compare_record_for_qsort(const void *p1, const void *p2)
+{
+  return compare_record(p1, p2);
+}
+
+static void
+open_reader(struct run_reader *rd, FILE *fp)
+{
+  rd->fp = fp;
+  rewind(fp);
+  rd->valid = !read_record(fp, &rd->rec);
+}
+
+static void
+advance_reader(struct run_reader *rd)
+{
+  free_record(&rd->rec);
+  rd->valid = !read_record(rd->fp, &rd->rec);
+}
+
+/* 次に取り出すレコードを持つreaderを返す
+ * 同じ読みならば前の方のファイルが先になる */
+static struct run_reader *
+min_reader(struct run_reader *rds, int nr)
+{
+  struct run_reader *min = NULL;
+  int i;
+  for (i = 0; i < nr; i++) {
+    if (!rds[i].valid) {
+      continue;
+    }
+    if (!min || anthy_xstrcmp(&rds[i].rec.yomi, &min->rec.yomi) < 0) {
+      min = &rds[i];
+    }
+  }
+  return min;
+}
+
+/* forkできずに親プロセスで読み込む場合もあるので、終了せずにエラーを記録する */
+static void
+check_write_error(struct run_writer *rw, FILE *fp)
+{
+  if (fflush(fp) || ferror(fp)) {
+    fprintf(stderr, "mkworddic: failed to write a temporary file\n");
+    rw->error = 1;
+  }
+}
+
+/* 溜めているレコードを整列して書き出す */
+static void
+flush_records(struct run_writer *rw, FILE *fp)
+{
+  int i;
+  qsort(rw->recs, rw->nr_recs, sizeof(struct run_record),
+	compare_record_for_qsort);
+  for (i = 0; i < rw->nr_recs; i++) {
+    write_record(fp, &rw->recs[i]);
+    free_record(&rw->recs[i]);
+  }
+  check_write_error(rw, fp);
+  rw->nr_recs = 0;
+  rw->mem = 0;
+}
+
+/* メモリの上限を越えたのでここまでのランを一時ファイルに吐き出す */
+static void
+spill_records(struct run_writer *rw)
+{
+  char *fn;
+  FILE *fp = mkdic_open_tmpfile(&fn);
+  if (fn) {
+    /* 開いたままなので名前は要らない */
+    unlink(fn);
+    free(fn);
+  }
+  if (!fp) {
+    fprintf(stderr, "mkworddic: cannot open temporary file\n");
+    rw->error = 1;
+    return ;
+  }
+  flush_records(rw, fp);
+  rw->chunks = realloc(rw->chunks, sizeof(FILE *) * (rw->nr_chunks + 1));
+  rw->chunks[rw->nr_chunks] = fp;
+  rw->nr_chunks ++;
+}
+
+static void
+push_record(struct run_writer *rw, int type, xstr *yomi,
+	    const char *wt, int freq, const char *word, int order)
+{
+  struct run_record *rr;
+  int i;
+  if (rw->error) {
+    return ;
+  }
+  if (rw->nr_recs == rw->array_size) {
+    rw->array_size = rw->array_size ? rw->array_size * 2 : 1024;
+    rw->recs = realloc(rw->recs,
+		       sizeof(struct run_record) * rw->array_size);
+  }
+  rr = &rw->recs[rw->nr_recs];
+  rw->nr_recs ++;
+  rr->type = type;
+  rr->seq = rw->seq;
+  rw->seq ++;
+  rr->freq = freq;
+  rr->order = order;
+  rr->yomi.len = yomi ? yomi->len : 0;
+  rr->yomi.str = malloc(sizeof(xchar) * (rr->yomi.len + 1));
+  for (i = 0; i < rr->yomi.len; i++) {
+    rr->yomi.str[i] = yomi->str[i];
+  }
+  rr->wt = wt ? strdup(wt) : NULL;
+  rr->word = word ? strdup(word) : NULL;
+  /**/
+  rw->mem += sizeof(struct run_record) + sizeof(xchar) * rr->yomi.len;
+  rw->mem += (wt ? strlen(wt) : 0) + (word ? strlen(word) : 0);
+  if (rw->mem > rw->limit) {
+    spill_records(rw);
+  }
+}
+
+/* 子プロセスから呼ばれる
+ * 読み込んだ読みを記録する */
+void
+run_add_yomi(struct run_writer *rw, xstr *yomi)
+{
+  if (rw->cur_yomi) {
+    anthy_free_xstr(rw->cur_yomi);
+  }
+  rw->cur_yomi = anthy_xstr_dup(yomi);
+  push_record(rw, RR_YOMI, yomi, NULL, 0, NULL, 0);
+}
+
+/* 子プロセスから呼ばれる
+ * 直前の読みに対する単語を記録する */
+void
+run_add_word(struct run_writer *rw, const char *wt_name, int freq,
+	     const char *word_utf8, int order)
+{
+  push_record(rw, RR_WORD, rw->cur_yomi, wt_name, freq, word_utf8, order);
+}
+
+/* 子プロセスから呼ばれる
+ * 頻度調整のコマンドを記録する。読みが空なので先頭に並ぶ */
+void
+run_add_adjust_command(struct run_writer *rw, const char *line)
+{
+  push_record(rw, RR_ADJUST, NULL, NULL, 0, line, 0);
+}
+
+/* 吐き出したランと残りのレコードをマージして出力する */
+static void
+finish_run(struct run_writer *rw, FILE *out)
+{
+  struct run_reader *rds;
+  struct run_reader *rd;
+  int i;
+  if (rw->nr_chunks == 0) {
+    flush_records(rw, out);
+    return ;
+  }
+  if (rw->nr_recs > 0) {
+    spill_records(rw);
+  }
+  rds = malloc(sizeof(struct run_reader) * rw->nr_chunks);
+  for (i = 0; i < rw->nr_chunks; i++) {
+    open_reader(&rds[i], rw->chunks[i]);
+  }
+  while ((rd = min_reader(rds, rw->nr_chunks))) {
+    write_record(out, &rd->rec);
+    advance_reader(rd);
+  }
+  check_write_error(rw, out);
+  for (i = 0; i < rw->nr_chunks; i++) {
+    fclose(rw->chunks[i]);
+  }
+  rw->nr_chunks = 0;
+  free(rds);
+}
+
+/* 子プロセスでファイルを読み込み、ランを書き出す */
+static int
+make_run(struct mkdic_stat *mds, struct word_source *src, long limit)
+{
+  struct run_writer rw;
+  int res = RUN_OK;
+  int i;
+  rw.recs = NULL;
+  rw.nr_recs = 0;
+  rw.array_size = 0;
+  rw.mem = 0;
+  rw.limit = limit;
+  rw.chunks = NULL;
+  rw.nr_chunks = 0;
+  rw.error = 0;
+  rw.seq = 0;
+  rw.cur_yomi = NULL;
+  /**/
+  mds->run = &rw;
+  if (parse_word_source(mds, src->fn, src->traditional)) {
+    res = RUN_NO_FILE;
+  }
+  if (!rw.error) {
+    finish_run(&rw, src->run_fp);
+  }
+  if (rw.error) {
+    res = RUN_WRITE_ERROR;
+    for (i = 0; i < rw.nr_recs; i++) {
+      free_record(&rw.recs[i]);
+    }
+    for (i = 0; i < rw.nr_chunks; i++) {
+      fclose(rw.chunks[i]);
+    }
+  }
+  mds->run = NULL;
+  /**/
+  if (rw.cur_yomi) {
+    anthy_free_xstr(rw.cur_yomi);
+  }
+  free(rw.recs);
+  free(rw.chunks);
+  return res;
+}
+
+/* 新しく作ったyomi_entryと、その読みが最初に現れた位置 */
+struct new_yomi {
+  struct yomi_entry *ye;
+  int src;
+  int seq;
+};
+
+static int
+compare_new_yomi(const void *p1, const void *p2)
+{
+  const struct new_yomi *n1 = p1;
+  const struct new_yomi *n2 = p2;
+  if (n1->src != n2->src) {
+    return n1->src - n2->src;
+  }
+  return n1->seq - n2->seq;
+}
+
+/* yomi_entryのリストを逐次に読み込んだ場合と同じ順に並べ直す
+ * (リストの先頭nr個がこのバッチで作られたもの) */
+static void
+relink_new_entries(struct yomi_entry_list *yl, struct new_yomi *ny, int nr)
+{
+  struct yomi_entry *rest;
+  int i;
+  rest = yl->head;
+  for (i = 0; i < nr; i++) {
+    rest = rest->next;
+  }
+  qsort(ny, nr, sizeof(struct new_yomi), compare_new_yomi);
+  for (i = 0; i < nr; i++) {
+    ny[i].ye->next = rest;
+    rest = ny[i].ye;
+  }
+  yl->head = rest;
+}
+
+/* 各ファイルのランをマージして単語を登録する */
+static void
+merge_runs(struct mkdic_stat *mds, struct word_source *srcs, int nr)
+{
+  struct run_reader *rds = malloc(sizeof(struct run_reader) * nr);
+  struct run_reader *rd;
+  struct yomi_entry *ye = NULL;
+  struct new_yomi *ny = NULL;
+  int nr_new = 0;
+  int i;
+
+  for (i = 0; i < nr; i++) {
+    open_reader(&rds[i], srcs[i].run_fp);
+  }
+  while ((rd = min_reader(rds, nr))) {
+    struct run_record *rr = &rd->rec;
+    if (rr->type == RR_ADJUST) {
+      read_adjust_command(mds, rr->word);
+    } else if (rr->type == RR_YOMI) {
+      int nr_entries = mds->yl.nr_entries;
+      if (!ye || anthy_xstrcmp(ye->index_xstr, &rr->yomi)) {
+	ye = find_yomi_entry(&mds->yl, &rr->yomi, 1);
+      }
+      if (mds->yl.nr_entries != nr_entries) {
+	/* 新しい読み */
+	ny = realloc(ny, sizeof(struct new_yomi) * (nr_new + 1));
+	ny[nr_new].ye = ye;
+	ny[nr_new].src = rd - rds;
+	ny[nr_new].seq = rr->seq;
+	nr_new ++;
+      }
+    } else if (ye) {
+      append_word_entry(ye, rr->wt, rr->freq, rr->word, rr->order);
+      /* 単語の文字列はyomi_entryに渡した */
+      rr->word = NULL;
+    }
+    advance_reader(rd);
+  }
+  relink_new_entries(&mds->yl, ny, nr_new);
+  free(ny);
+  free(rds);
+}
+
+/* 子プロセスを起動してファイルを読み込む */
+static void
+start_worker(struct mkdic_stat *mds, struct word_source *src, long limit)
+{
+  src->pid = fork();
+  if (src->pid == 0) {
+    _exit(make_run(mds, src, limit));
+  }
+  if (src->pid < 0) {
+    /* forkできなければ自分で読み込む */
+    src->status = make_run(mds, src, limit);
+  }
+}
+
+/* 子プロセスの終了を待つ */
+static void
+wait_worker(struct word_source *srcs, int nr)
+{
+  int status, i;
+  pid_t pid = wait(&status);
+  if (pid < 0) {
+    return ;
+  }
+  for (i = 0; i < nr; i++) {
+    if (srcs[i].pid == pid) {
+      if (WIFEXITED(status)) {
+	srcs[i].status = WEXITSTATUS(status);
+      } else {
+	srcs[i].status = 1;
+      }
+      srcs[i].pid = -1;
+      return ;
+    }
+  }
+}
+
+static int
+count_running_workers(struct word_source *srcs, int nr)
+{
+  int i, n = 0;
+  for (i = 0; i < nr; i++) {
+    if (srcs[i].pid > 0) {
+      n ++;
+    }
+  }
+  return n;
+}
+
+static void
+hash_bytes(unsigned long long *h, const void *p, int len)
+{
+  const unsigned char *c = p;
+  int i;
+  for (i = 0; i < len; i++) {
+    /* FNV-1a */
+    *h ^= c[i];
+    *h *= 1099511628211ULL;
+  }
+}
+
+static void
+hash_int(unsigned long long *h, int i)
+{
+  hash_bytes(h, &i, sizeof(int));
+}
+
+/* ファイルの内容をハッシュに加える、読めなければ-1を返す */
+static int
+hash_file(unsigned long long *h, const char *fn)
+{
+  char buf[BUFSIZ];
+  size_t nread;
+  FILE *fp = fopen(fn, "r");
+  if (!fp) {
+    return -1;
+  }
+  while ((nread = fread(buf, 1, sizeof(buf), fp)) > 0) {
+    hash_bytes(h, buf, nread);
+  }
+  fclose(fp);
+  return 0;
+}
+
+/* mkworddic自身のハッシュ
+ * 読み込みの処理や単語の形式を変えた場合にキャッシュを使わないように
+ * 実行ファイルの内容を使う。読めなければバージョンだけを使う */
+static unsigned long long
+tool_hash(void)
+{
+  static unsigned long long h;
+  static int done;
+  if (!done) {
+    h = 14695981039346656037ULL;
+    hash_bytes(&h, VERSION, strlen(VERSION));
+    hash_file(&h, "/proc/self/exe");
+    done = 1;
+  }
+  return h;
+}
+
+/* ソースファイルの内容と読み込みの設定からキャッシュのファイル名を作る */
+static char *
+make_cache_name(struct mkdic_stat *mds, struct word_source *src)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  unsigned long long th = tool_hash();
+  char *fn;
+  int i;
+  if (hash_file(&h, src->fn)) {
+    return NULL;
+  }
+  /**/
+  hash_bytes(&h, &th, sizeof(th));
+  hash_int(&h, RUN_FORMAT_VERSION);
+  hash_int(&h, src->traditional);
+  hash_int(&h, mds->input_encoding);
+  hash_int(&h, mds->freq_order);
+  for (i = 0; i < mds->nr_excluded; i++) {
+    hash_bytes(&h, mds->excluded_wtypes[i],
+	       strlen(mds->excluded_wtypes[i]) + 1);
+  }
+  /**/
+  fn = malloc(strlen(mds->cache_dir) + 32);
+  sprintf(fn, "%s/%016llx.run", mds->cache_dir, h);
+  return fn;
+}
+
+/* キャッシュにあるランを開く、無ければランを書き出すファイルを作る */
+static void
+open_run_file(struct mkdic_stat *mds, struct word_source *src)
+{
+  src->run_fn = NULL;
+  src->cache_fn = NULL;
+  src->cached = 0;
+  if (mds->cache_dir) {
+    src->cache_fn = make_cache_name(mds, src);
+  }
+  if (src->cache_fn) {
+    char *fn;
+    int fd;
+    src->run_fp = fopen(src->cache_fn, "r");
+    if (src->run_fp) {
+      src->cached = 1;
+      return ;
+    }
+    /* 書き終わったらrenameするので同じディレクトリに作る */
+    fn = malloc(strlen(src->cache_fn) + 8);
+    sprintf(fn, "%s.XXXXXX", src->cache_fn);
+    fd = mkstemp(fn);
+    if (fd != -1) {
+      src->run_fp = fdopen(fd, "w+");
+      src->run_fn = fn;
+      return ;
+    }
+    free(fn);
+    free(src->cache_fn);
+    src->cache_fn = NULL;
+  }
+  src->run_fp = mkdic_tmpfile(&src->run_fn);
+}
+
+/* 書き出したランをキャッシュに入れる */
+static void
+store_run_file(struct word_source *src)
+{
+  if (src->cached || !src->cache_fn || !src->run_fn ||
+      src->status != RUN_OK) {
+    return ;
+  }
+  if (!rename(src->run_fn, src->cache_fn)) {
+    free(src->run_fn);
+    src->run_fn = NULL;
+  }
+}
+
+/* ランのファイルを閉じて、キャッシュに入れなかったものは消す
+ * キャッシュにあるもののファイル名は後で古いものを消すために覚えておく */
+static void
+close_run_files(struct mkdic_stat *mds, struct word_source *srcs, int nr)
+{
+  int i;
+  for (i = 0; i < nr; i++) {
+    fclose(srcs[i].run_fp);
+    store_run_file(&srcs[i]);
+    if (srcs[i].run_fn) {
+      unlink(srcs[i].run_fn);
+      free(srcs[i].run_fn);
+      free(srcs[i].cache_fn);
+      continue;
+    }
+    if (srcs[i].cache_fn) {
+      mds->cached_runs = realloc(mds->cached_runs, sizeof(char *) *
+				 (mds->nr_cached_runs + 1));
+      mds->cached_runs[mds->nr_cached_runs] = srcs[i].cache_fn;
+      mds->nr_cached_runs ++;
+    }
+  }
+}
+
+static void
+read_sources_in_parallel(struct mkdic_stat *mds,
+			 struct word_source *srcs, int nr)
+{
+  long limit = mds->sort_memory / mds->nr_jobs;
+  int i;
+
+  /* 子プロセスで二重に出力されないようにする */
+  fflush(stdout);
+  fflush(stderr);
+  for (i = 0; i < nr; i++) {
+    open_run_file(mds, &srcs[i]);
+    srcs[i].pid = -1;
+    srcs[i].status = RUN_OK;
+  }
+  for (i = 0; i < nr; i++) {
+    if (srcs[i].cached) {
+      continue;
+    }
+    while (count_running_workers(srcs, nr) >= mds->nr_jobs) {
+      wait_worker(srcs, nr);
+    }
+    start_worker(mds, &srcs[i], limit);
+  }
+  while (count_running_workers(srcs, nr) > 0) {
+    wait_worker(srcs, nr);
+  }
+
+  for (i = 0; i < nr; i++) {
+    if (srcs[i].status == RUN_NO_FILE) {
+      printf("failed file = %s\n", srcs[i].fn);
+    } else if (srcs[i].status != RUN_OK) {
+      fprintf(stderr, "mkworddic: failed to read %s\n", srcs[i].fn);
+      close_run_files(mds, srcs, nr);
+      exit(1);
+    } else {
+      printf("file = %s%s%s\n", srcs[i].fn,
+	     srcs[i].traditional ? " (traditional)" : "",
+	     srcs[i].cached ? " (cached)" : "");
+    }
+  }
+  merge_runs(mds, srcs, nr);
+  close_run_files(mds, srcs, nr);
+}
+
+/* キャッシュのランもしくはその書きかけのファイルの名前か */
+static int
+is_run_file_name(const char *name)
+{
+  int i;
+  for (i = 0; i < 16; i++) {
+    if (!name[i] || !strchr("0123456789abcdef", name[i])) {
+      return 0;
+    }
+  }
+  return !strncmp(&name[16], ".run", 4) &&
+    (name[20] == 0 || name[20] == '.');
+}
+
+/** キャッシュのディレクトリから今回使わなかったランを消す
+ * 入力や設定が変わるたびにランが増えていかないようにする */
+void
+prune_run_cache(struct mkdic_stat *mds)
+{
+  DIR *dir;
+  struct dirent *de;
+  char *fn;
+  int i;
+  if (!mds->cache_dir) {
+    return ;
+  }
+  dir = opendir(mds->cache_dir);
+  if (!dir) {
+    return ;
+  }
+  fn = malloc(strlen(mds->cache_dir) + 256 + 2);
+  while ((de = readdir(dir))) {
+    if (strlen(de->d_name) > 256 || !is_run_file_name(de->d_name)) {
+      continue;
+    }
+    sprintf(fn, "%s/%s", mds->cache_dir, de->d_name);
+    for (i = 0; i < mds->nr_cached_runs; i++) {
+      if (!strcmp(fn, mds->cached_runs[i])) {
+	break;
+      }
+    }
+    if (i == mds->nr_cached_runs) {
+      unlink(fn);
+    }
+  }
+  closedir(dir);
+  free(fn);
+  for (i = 0; i < mds->nr_cached_runs; i++) {
+    free(mds->cached_runs[i]);
+  }
+  free(mds->cached_runs);
+  mds->cached_runs = NULL;
+  mds->nr_cached_runs = 0;
+}
+
+/** 読み込むファイルを登録しておく */
+void
+queue_word_source(struct mkdic_stat *mds, const char *fn, int traditional)
+{
+  struct word_source *src;
+  mds->sources = realloc(mds->sources,
+			 sizeof(struct word_source) * (mds->nr_sources + 1));
+  src = &mds->sources[mds->nr_sources];
+  src->fn = strdup(fn);
+  src->traditional = traditional;
+  src->run_fp = NULL;
+  src->run_fn = NULL;
+  mds->nr_sources ++;
+}
+
+/** 登録しておいたファイルを読み込む */
+void
+flush_word_sources(struct mkdic_stat *mds)
+{
+  int i;
+  if (mds->nr_sources <= 0) {
+    return ;
+  }
+  if (mds->cache_dir || (mds->nr_jobs > 1 && mds->nr_sources > 1)) {
+    read_sources_in_parallel(mds, mds->sources, mds->nr_sources);
+  } else {
+    for (i = 0; i < mds->nr_sources; i++) {
+      if (mds->sources[i].traditional) {
+	read_traditional_dict_file(mds, mds->sources[i].fn);
+      } else {
+	read_dict_file(mds, mds->sources[i].fn);
+      }
+    }
+  }
+  for (i = 0; i < mds->nr_sources; i++) {
+    free(mds->sources[i].fn);
+  }
+  free(mds->sources);
+  mds->sources = NULL;
+  mds->nr_sources = 0;
+}
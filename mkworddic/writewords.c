@@ -1,10 +1,10 @@
 /*
- * ɤߤñξǡ¤ե
- * Ϥ뤿Υ
+ * 読みから単語の情報を取得するデータ構造をファイル中に
+ * 出力するためのコード
  *
- * ǡ¤ѹ䤹뤿mkdic.cʬΥ(2005/7/8)
+ * データ構造を変更しやすくするためにmkdic.cから分離(2005/7/8)
  *
- * output_word_dict()ƤӽФ
+ * output_word_dict()が呼び出される
  *
  * Copyright (C) 2000-2006 TABATA Yusuke
  */
@@ -34,31 +34,43 @@
 extern FILE *page_out, *page_index_out;
 extern FILE *yomi_entry_index_out, *yomi_entry_out;
 
+/* 符号無しの可変長整数(7bitずつ、下位から)を出力する */
 static int
-write_word(struct word_entry *we)
+write_varint(unsigned int v)
 {
-  int count;
-  if (we->word_utf8[0] == '#' &&
-      we->word_utf8[0] == '_') {
-    /* ʣ */
-    count = fprintf(yomi_entry_out, "#%c%s",
-		    (unsigned char)WT_COMPOUND,
-		    &we->word_utf8[2]);
-  } else {
-    count = fprintf(yomi_entry_out, "%s", we->word_utf8);
+  int count = 0;
+  while (v >= 0x80) {
+    fputc((v & 0x7f) | 0x80, yomi_entry_out);
+    v >>= 7;
+    count ++;
   }
-  return count;
+  fputc(v, yomi_entry_out);
+  return count + 1;
 }
 
+/* 符号付きの整数を0に近い値が短くなるように出力する */
 static int
-write_freq(FILE *fp, struct word_entry *we)
+write_signed_varint(int v)
 {
-  int count = 0;
-  int freq = we->cost / 100;
-  if (freq != 1) {
-    count += fprintf(fp, "*%d", freq);
+  unsigned int u = ((unsigned int)v << 1) ^ (unsigned int)(v >> 31);
+  return write_varint(u);
+}
+
+/* 単語の文字列を長さ付きで出力する
+ * テキスト形式の'\\'によるエスケープはここで外しておく */
+static int
+write_word(const char *s)
+{
+  int i, len;
+  char *buf = alloca(strlen(s) + 1);
+  for (i = 0, len = 0; s[i]; i++) {
+    if (s[i] == '\\' && (s[i + 1] == ' ' || s[i + 1] == '\\')) {
+      i ++;
+    }
+    buf[len] = s[i];
+    len ++;
   }
-  return count;
+  return write_varint(len) + fwrite(buf, 1, len, yomi_entry_out);
 }
 
 static int
@@ -73,8 +85,12 @@ compare_word_entry(struct word_entry *prev_we,
   return 0;
 }
 
-/** ĤɤߤФñƤϤ
- * ֤ͤϽϤХȿ
+/** 一つの読みに対する単語の内容を出力する
+ * 返り値は出力したバイト数
+ *
+ * 各単語はタグ(WORD_ENTRY_TAG|フラグ)から始まり、品詞か頻度が前の単語と
+ * 異なる場合には品詞のidと頻度が続き、最後に長さ付きの文字列が続く。
+ * 0のバイトで終わる。
  */
 static int
 output_word_entry_for_a_yomi(struct yomi_entry *ye)
@@ -86,10 +102,13 @@ output_word_entry_for_a_yomi(struct yomi_entry *ye)
   if (!ye) {
     return 0;
   }
-  /* ñϤ */
+  /* 各単語を出力する */
   for (i = 0; i < ye->nr_entries; i++) {
     struct word_entry *we = &ye->entries[i];
     struct word_entry *prev_we = NULL;
+    const char *word = we->word_utf8;
+    int tag = WORD_ENTRY_TAG;
+    int header;
     if (i != 0) {
       prev_we = &ye->entries[i-1];
     }
@@ -97,26 +116,30 @@ output_word_entry_for_a_yomi(struct yomi_entry *ye)
     if (we->raw_freq == INVALID_FREQ) {
       continue;
     }
-    if (!first) {
-      /* ܰʹߤ϶򤫤Ϥޤ */
-      count += fprintf(yomi_entry_out, " ");
-    }
-    /* ʻ٤Ϥ */
-    if (first ||
-	compare_word_entry(prev_we, we)) {
-      /*count += fprintf(yomi_entry_out, "%s", we->wt_name);*/
-      count += fprintf(yomi_entry_out, "#%c",
-		       anthy_wtype_get_id(we->wt_name));
+    header = first || compare_word_entry(prev_we, we);
+    if (header) {
+      tag |= WORD_ENTRY_HEADER;
       if (we->feature != 0) {
-	count += fprintf(yomi_entry_out, ",");
+	tag |= WORD_ENTRY_FEATURE;
       }
-      count += write_freq(yomi_entry_out, we);
-      count += fprintf(yomi_entry_out, " ");
     }
-    /* ñϤ꤬ñid */
+    if (word[0] == '#' && word[1] == '_') {
+      /* 複合語は先頭の'#'を除いて"_4..."の形で格納する */
+      tag |= WORD_ENTRY_COMPOUND;
+      word ++;
+    }
+    /* 単語を出力する場所がこの単語のid */
     we->offset = count + ye->offset;
-    /* ñϤ */
-    count += write_word(we);
+    fputc(tag, yomi_entry_out);
+    count ++;
+    /* 品詞と頻度を出力する */
+    if (header) {
+      fputc(anthy_wtype_get_id(we->wt_name), yomi_entry_out);
+      count ++;
+      count += write_signed_varint(we->cost / 100);
+    }
+    /* 単語を出力する */
+    count += write_word(word);
     /**/
     first = 0;
   }
@@ -125,7 +148,7 @@ output_word_entry_for_a_yomi(struct yomi_entry *ye)
   return count + 1;
 }
 
-/* 2ĤʸζʬĹ */
+/* 2つの文字列の共通部分の長さを求める */
 static int
 common_len(xstr *s1, xstr *s2)
 {
@@ -147,10 +170,10 @@ common_len(xstr *s1, xstr *s2)
 }
 
 /*
- * 2ĤʸκʬϤ
- * AAA ABBB Ȥ2Ĥʸ򸫤ˤ
- * ABBBAAAΤ2ʸäBBBդΤȤ
- * \0x2BBBȽϤ롣
+ * 2つの文字列の差分を出力する
+ * AAA ABBB という2つの文字列を見た場合には
+ * ABBBはAAAのうしろ2文字を消してBBBを付けたものとして
+ * \0x2BBBと出力される。
  */
 static int
 output_diff(xstr *p, xstr *c)
@@ -183,8 +206,8 @@ output_entry_index(int i)
   write_nl(yomi_entry_index_out, i);
 }
 
-/* ɤߤʸ󤫤եΰ(offset)뤿Υơ֥
- * page_out, page_index_out, yomi_entry_index_out˽
+/* 読みの文字列からファイル中の位置(offset)を求めるためのテーブルを作る
+ * page_out, page_index_out, yomi_entry_index_outに出力
  */
 static void
 generate_yomi_to_offset_map(struct yomi_entry_list *yl)
@@ -193,21 +216,21 @@ generate_yomi_to_offset_map(struct yomi_entry_list *yl)
   struct yomi_entry *ye = NULL;
   xstr *prev = NULL;
   int page_index = 0;
-  /* ɤߤ(offset)׻ǡ¤ */
+  /* 読みから位置(offset)を計算するデータ構造を構成する */
 
-  /* ޤǽɤߤФ륨ȥΥǥå񤭽Ф */
+  /* まず、最初の読みに対するエントリのインデックスを書き出す */
   write_nl(page_index_out, page_index);
   /**/
   for (i = 0; i < yl->nr_valid_entries; i++) {
     ye = yl->ye_array[i];
-    /* ڡγ */
+    /* 新しいページの開始 */
     if ((i % WORDS_PER_PAGE) == 0 && (i != 0)) {
       page_index ++;
       prev = NULL;
       begin_new_page(page_index);
     }
 
-    /* ɤߤбϤ */
+    /* 読みに対応する情報を出力する */
     page_index += output_diff(prev, ye->index_xstr);
 
     output_entry_index(ye->offset);
@@ -216,26 +239,100 @@ generate_yomi_to_offset_map(struct yomi_entry_list *yl)
   }
 }
 
-/** ñ켭Ϥ
- * ޤΤȤ˼ΥեåȤ׻ */
-void
-output_word_dict(struct yomi_entry_list *yl)
+/* 順変換に使われる単語の中で最も高い頻度 */
+static int
+yomi_entry_hotness(struct yomi_entry *ye)
 {
-  int entry_index = 0;
   int i;
-  struct yomi_entry *ye = NULL;
+  int max = 0;
+  for (i = 0; i < ye->nr_entries; i++) {
+    int freq = ye->entries[i].raw_freq;
+    if (freq != INVALID_FREQ && freq > max) {
+      max = freq;
+    }
+  }
+  return max;
+}
 
-  /* ɤߤФ롼 */
+static int
+compare_hotness(const void *p1, const void *p2)
+{
+  const int *i1 = p1;
+  const int *i2 = p2;
+  /* 頻度の高い順、同じなら読みの順 */
+  if (i1[1] != i2[1]) {
+    return i2[1] - i1[1];
+  }
+  return i1[0] - i2[0];
+}
+
+/* 頻度の高いnr_hot個の読みに印を付けた配列を返す */
+static char *
+select_hot_entries(struct yomi_entry_list *yl, int nr_hot)
+{
+  int i;
+  int *order;
+  char *hot;
+  if (nr_hot <= 0) {
+    return NULL;
+  }
+  if (nr_hot > yl->nr_valid_entries) {
+    nr_hot = yl->nr_valid_entries;
+  }
+  /* (読みの番号, 頻度)の組を並べる */
+  order = malloc(sizeof(int) * 2 * yl->nr_valid_entries);
   for (i = 0; i < yl->nr_valid_entries; i++) {
-    /* ñϤơեΰ(offset)׻ */
-    ye = yl->ye_array[i];
-    ye->offset = entry_index;
-    entry_index += output_word_entry_for_a_yomi(ye);
+    order[i * 2] = i;
+    order[i * 2 + 1] = yomi_entry_hotness(yl->ye_array[i]);
+  }
+  qsort(order, yl->nr_valid_entries, sizeof(int) * 2, compare_hotness);
+  hot = calloc(yl->nr_valid_entries, 1);
+  for (i = 0; i < nr_hot; i++) {
+    hot[order[i * 2]] = 1;
   }
-  /* ɤߤʸ󤫤եΰ(offset)뤿Υơ֥ */
+  free(order);
+  return hot;
+}
+
+/** 単語辞書を出力する
+ * また、このときに辞書中のオフセットも計算する
+ * nr_hot個の頻度の高い読みのエントリは先頭にまとめて出力し、
+ * そのバイト数を返す */
+int
+output_word_dict(struct yomi_entry_list *yl, int nr_hot)
+{
+  int entry_index = 0;
+  int hot_size = 0;
+  int i, pass;
+  struct yomi_entry *ye = NULL;
+  char *hot = select_hot_entries(yl, nr_hot);
+
+  /* 頻度の高い読み、残りの読みの順に出力する */
+  for (pass = 0; pass < 2; pass++) {
+    /* 各読みに対するループ */
+    for (i = 0; i < yl->nr_valid_entries; i++) {
+      int is_hot = hot && hot[i];
+      if (is_hot != (pass == 0)) {
+	continue;
+      }
+      /* 単語を出力して、ファイル中の位置(offset)を計算する */
+      ye = yl->ye_array[i];
+      ye->offset = entry_index;
+      entry_index += output_word_entry_for_a_yomi(ye);
+    }
+    if (pass == 0) {
+      hot_size = entry_index;
+    }
+  }
+  free(hot);
+  /* 最後の読み */
+  if (yl->nr_valid_entries > 0) {
+    ye = yl->ye_array[yl->nr_valid_entries - 1];
+  }
+  /* 読みの文字列からファイル中の位置(offset)を求めるためのテーブルを作る */
   generate_yomi_to_offset_map(yl);
 
-  /* Ǹɤߤλ */
+  /* 最後の読みを終了 */
   entry_index += output_word_entry_for_a_yomi(ye);
   write_nl(yomi_entry_index_out, entry_index);
   write_nl(page_index_out, 0);
@@ -245,4 +342,8 @@ output_word_dict(struct yomi_entry_list *yl)
 	 yl->nr_valid_entries,
 	 yl->nr_words,
 	 yl->nr_valid_entries / WORDS_PER_PAGE + 1);
+  if (hot_size > 0) {
+    printf("%d bytes of frequent entries are placed first.\n", hot_size);
+  }
+  return hot_size;
 }
@@ -1,6 +1,6 @@
 /*
- * ¤Υ
- * Funded by IPA̤Ƨեȥ¤ 2001 8/15
+ * 構造体アロケータ
+ * Funded by IPA未踏ソフトウェア創造事業 2001 8/15
  *
  * $Id: alloc.c,v 1.12 2002/05/15 11:21:10 yusuke Exp $
  *
@@ -10,7 +10,7 @@
  *
  * dtor: destructor
  * 
- * ڡΥե꡼chunkñꥹȤ˷ѤƤ
+ * ページ中のフリーなchunkは単方向リストに継がれている
  *
  */
 /*
@@ -40,22 +40,22 @@
 #define PAGE_MAGIC 0x12345678
 #define PAGE_SIZE 2048
 
-/* ڡ̤ιסǥХåλѤ */
+/* ページ使用量の合計、デバッグの時等に用いる */
 static int nr_pages;
 
-/* pageΥ֥Ȥɽ֥ */
+/* page内のオブジェクトを表すオブジェクト */
 struct chunk {
   void *storage[1];
 };
 #define CHUNK_HEADER_SIZE ((size_t)&((struct chunk *)0)->storage)
-/* CPU⤷ϡOSμˤä׵ᤵ륢饤 */
+/* CPUもしくは、OSの種類によって要求されるアライメント */
 #define CHUNK_ALIGN (sizeof(double))
 
 /*
- * pagestorageˤ 
- * max_obj = (PAGE_SIZE - PAGE_HEADER_SIZE) / (size + CHUNK_HEADER_SIZE)Ĥ
- * åȤ롣Τuse_countĤΥåȤfree_listˤĤʤäƤ롢
- * ⤷ϻǤ롣
+ * pageのstorage中には 
+ * max_obj = (PAGE_SIZE - PAGE_HEADER_SIZE) / (size + CHUNK_HEADER_SIZE)個の
+ * スロットがある。そのうちuse_count個のスロットがfree_listにつながっている、
+ * もしくは使用中である。
  */
 struct page {
   int magic;
@@ -71,21 +71,23 @@ struct page {
 
 /**/
 struct allocator_priv {
-  /* ¤ΤΥ */
+  /* 構造体のサイズ */
   int size;
-  /* ڡ뤳ȤǤ륪֥Ȥο */
+  /* ページ内に入れることができるオブジェクトの数 */
   int max_num;
   /* 
-     ºݤΥǡǼϤΥեå 
-     ڡΤˤбΥǡȤƤ뤫ɤ0/1ɽ
-     ӥåȥޥåפ
+     実際のデータが格納され始める場所のオフセット 
+     ページ中のこれより手前には対応する場所のデータが使われているかどうかを0/1で表す
+     ビットマップがある
    */
   int storage_offset;
-  /* allocatorѤƤڡΥꥹ */
+  /* このallocatorが使用しているページのリスト */
   struct page page_list;
-  /* allocatorΥꥹ */
+  /* 空きを探し始めるページ */
+  struct page *hint;
+  /* allocatorのリスト */
   struct allocator_priv *next;
-  /* sfreeݤ˸ƤФ */
+  /* sfreeした際に呼ばれる */
   void (*dtor)(void *);
 };
 
@@ -94,7 +96,7 @@ static struct allocator_priv *allocator_list;
 static int bit_test(unsigned char* bits, int pos)
 {
   /*
-     bit_getȤۤƱbit != 0λ0ʳ֤Ȥݾڤʤ
+     bit_getとほぼ同じだがbit != 0の時に0以外を返すことしか保証しない
    */
   return bits[pos >> 3] & (1 << (7 - (pos & 0x7)));
 }
@@ -144,6 +146,11 @@ get_chunk_from_page(allocator a, struct page *p)
   unsigned char* avail = PAGE_AVAIL(p);
 
   for (i = 0; i < num; ++i) {
+    if (!(i & 7) && avail[i >> 3] == 0xff) {
+      /* 8個とも使用中 */
+      i += 7;
+      continue ;
+    }
     if (bit_test(avail, i) == 0) {
       bit_set(avail, i, 1);
       return PAGE_CHUNK(a, p, i);
@@ -165,8 +172,8 @@ static int
 calc_max_num(int size)
 {
   int area, bits;
-  /* ӥåȿǷ׻
-   * ̩ʺŬǤϤʤ
+  /* ビット数で計算
+   * 厳密な最適解ではない
    */
   area = (PAGE_SIZE - PAGE_HEADER_SIZE - CHUNK_ALIGN) * 8;
   bits = (size + CHUNK_HEADER_SIZE) * 8 + 1;
@@ -194,6 +201,7 @@ size=roundup_align(size);
   a->dtor = dtor;
   a->page_list.next = &a->page_list;
   a->page_list.prev = &a->page_list;
+  a->hint = &a->page_list;
   a->next = allocator_list;
   allocator_list = a;
   return a;
@@ -204,7 +212,7 @@ anthy_free_allocator_internal(allocator a)
 {
   struct page *p, *p_next;
 
-  /* ƥڡΥ */
+  /* 各ページのメモリを解放する */
   for (p = a->page_list.next; p != &a->page_list; p = p_next) {
     unsigned char* avail = PAGE_AVAIL(p);
     int i;
@@ -232,7 +240,7 @@ anthy_free_allocator(allocator a)
 {
   allocator a0, *a_prev_p;
 
-  /* ꥹȤaǤդ */
+  /* リストからaの前の要素を見付ける */
   a_prev_p = &allocator_list;
   for (a0 = allocator_list; a0; a0 = a0->next) {
     if (a == a0)
@@ -240,26 +248,60 @@ anthy_free_allocator(allocator a)
     else
       a_prev_p = &a0->next;
   }
-  /* aꥹȤ鳰 */
+  /* aをリストから外す */
   *a_prev_p = a->next;
 
   anthy_free_allocator_internal(a);
 }
 
+void
+anthy_reset_allocator(allocator a)
+{
+  struct page *p;
+
+  for (p = a->page_list.next; p != &a->page_list; p = p->next) {
+    unsigned char* avail = PAGE_AVAIL(p);
+    int i;
+
+    if (a->dtor) {
+      for (i = 0; i < a->max_num; i++) {
+	if (bit_test(avail, i)) {
+	  struct chunk *c;
+
+	  bit_set(avail, i, 0);
+	  c = PAGE_CHUNK(a, p, i);
+	  a->dtor(c->storage);
+	}
+      }
+    } else {
+      memset(avail, 0, (a->max_num >> 3) + 1);
+    }
+  }
+  a->hint = a->page_list.next;
+}
+
 void *
 anthy_smalloc(allocator a)
 {
   struct page *p;
   struct chunk *c;
 
-  /* Ƥڡ򤵤 */
-  for (p = a->page_list.next; p != &a->page_list; p = p->next) {
+  /* 空いてるページをhintから末尾、先頭からhintの順にさがす */
+  for (p = a->hint; p != &a->page_list; p = p->next) {
+    c = get_chunk_from_page(a, p);
+    if (c) {
+      a->hint = p;
+      return c->storage;
+    }
+  }
+  for (p = a->page_list.next; p != a->hint; p = p->next) {
     c = get_chunk_from_page(a, p);
     if (c) {
+      a->hint = p;
       return c->storage;
     }
   }
-  /* ڡäơ󥯤 */
+  /* ページを作って、リンクする */
   p = alloc_page(a);
   if (!p) {
     anthy_log(0, "Fatal error: Failed to allocate memory.\n");
@@ -271,7 +313,8 @@ anthy_smalloc(allocator a)
   p->prev = &a->page_list;
   a->page_list.next->prev = p;
   a->page_list.next = p;
-  /* ľ */
+  a->hint = p;
+  /* やり直す */
   return anthy_smalloc(a);
 }
 
@@ -281,7 +324,7 @@ anthy_sfree(allocator a, void *ptr)
   struct chunk *c = get_chunk_address(ptr);
   struct page *p;
   int index;
-  /* ݥ󥿤δޤޤڡõ */
+  /* ポインタの含まれるページを探す */
   for (p = a->page_list.next; p != &a->page_list; p = p->next) {
     if ((unsigned long)p < (unsigned long)c &&
 	(unsigned long)c < (unsigned long)p + PAGE_SIZE) {
@@ -295,12 +338,12 @@ anthy_sfree(allocator a, void *ptr)
     abort();
   }
 
-  /* ڡβܤΥ֥Ȥ */
+  /* ページ中の何番目のオブジェクトかを求める */
   index = ((unsigned long)c - (unsigned long)PAGE_STORAGE(a, p)) /
     (a->size + CHUNK_HEADER_SIZE);  
   bit_set(PAGE_AVAIL(p), index, 0);
 
-  /* ǥȥ饯Ƥ */
+  /* デストラクタを呼ぶ */
   if (a->dtor) {
     a->dtor(ptr);
   }
@@ -1,7 +1,7 @@
 /*
- * AnthyΥǡ١
- * conf_initꤵѿconf_overrideꤵ
- * ѿδط
+ * Anthyの設定のデータベース
+ * conf_initで設定される変数とconf_overrideで設定される
+ * 変数の関係に注意
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  */
@@ -34,18 +34,18 @@
 
 #include <config.h>
 
-/** ѿ */
+/** 設定の変数と値 */
 struct val_ent {
-  /** ѿ̾ */
+  /** 変数名 */
   const char *var;
-  /**  */
+  /** 値 */
   const char *val;
-  /** ꥹȤμ */
+  /** リストの次要素 */
   struct val_ent *next;
 };
 
 static struct val_ent *ent_list;
-/** Ѥߥե饰 */
+/** 初期化済みフラグ */
 static int confIsInit;
 static allocator val_ent_ator;
 
@@ -59,7 +59,7 @@ val_ent_dtor(void *p)
   }
 }
 
-/** ѿ̾бval_ent */
+/** 変数名に対応するval_entを取得する */
 static struct val_ent *
 find_val_ent(const char *v)
 {
@@ -80,7 +80,7 @@ find_val_ent(const char *v)
   return e;
 }
 
-/** ${ѿ̾}ηѿͤ
+/** ${変数名}の形の変数の値を取得する
  */
 static const char *
 get_subst(const char *s)
@@ -203,7 +203,7 @@ anthy_do_conf_override(const char *var, const char *val)
   }
 }
 
-/* ˡʥåIDݤ */
+/* ユニークなセッションIDを確保する */
 #define SID_FORMAT	"%s-%08x-%05d" /* HOST-TIME-PID */
 #define MAX_SID_LEN  	(MAX_HOSTNAME+8+5+2)
 #define MAX_HOSTNAME 	64
@@ -231,7 +231,7 @@ anthy_do_conf_init(void)
     const char *fn;
     struct passwd *pw;
     val_ent_ator = anthy_create_allocator(sizeof(struct val_ent), val_ent_dtor);
-    /*ǥեȤͤꤹ롣*/
+    /*デフォルトの値を設定する。*/
     add_val("VERSION", VERSION);
     fn = anthy_conf_get_str("CONFFILE");
     if (!fn){
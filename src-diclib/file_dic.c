@@ -9,7 +9,7 @@
 #include "diclib_inner.h"
 
 /**
-   ʣ󤬥󥯤줿
+   複数セクションがリンクされた辞書
  */
 struct file_dic
 {
@@ -21,22 +21,185 @@ static struct file_dic fdic;
 void*
 anthy_file_dic_get_section(const char* section_name)
 {
-  int i;
-  char* head = anthy_mmap_address(fdic.mapping);
-  int* p = (int*)head;
-  int entry_num = anthy_dic_ntohl(*p++);
-  
-  for (i = 0; i < entry_num; ++i) {
-    int hash_offset = anthy_dic_ntohl(*p++);
-    int key_len =  anthy_dic_ntohl(*p++);
-    int contents_offset = anthy_dic_ntohl(*p++);
-    if (strncmp(section_name, head + hash_offset, key_len) == 0) {
-      return (void*)(head + contents_offset);
+  return anthy_file_dic_image_get_section(fdic.mapping, section_name);
+}
+
+/* mapした辞書ファイル中のセクションの数、壊れていれば-1を返す */
+static int
+get_nr_sections(struct filemapping *m)
+{
+  int size = anthy_mmap_size(m);
+  int entry_num;
+
+  if (size < (int)sizeof(int)) {
+    return -1;
+  }
+  entry_num = anthy_dic_ntohl(*(int *)anthy_mmap_address(m));
+  if (entry_num < 0 || entry_num > (size / (int)sizeof(int) - 1) / 3) {
+    return -1;
+  }
+  return entry_num;
+}
+
+/** nth番目のセクションの名前と中身を得る
+ * セクションの中身は次のセクションの先頭かファイルの終わりまでとする
+ */
+static int
+get_nth_section(struct filemapping *m, int nth, int nr,
+		const char **name, int *name_len,
+		char **contents, int *len)
+{
+  char* head = anthy_mmap_address(m);
+  int size = anthy_mmap_size(m);
+  int* p = (int*)head + 1 + nth * 3;
+  int hash_offset = anthy_dic_ntohl(p[0]);
+  int key_len =  anthy_dic_ntohl(p[1]);
+  int contents_offset = anthy_dic_ntohl(p[2]);
+  int end = size;
+
+  if (hash_offset < 0 || key_len < 0 || hash_offset > size - key_len ||
+      contents_offset < 0 || contents_offset >= size) {
+    return -1;
+  }
+  if (nth + 1 < nr) {
+    end = anthy_dic_ntohl(p[5]);
+    if (end < contents_offset || end > size) {
+      return -1;
+    }
+  }
+  *name = head + hash_offset;
+  *name_len = key_len;
+  *contents = head + contents_offset;
+  *len = end - contents_offset;
+  return 0;
+}
+
+/* mapした辞書ファイルから名前がname_lenバイトのnameのセクションを探す */
+static char *
+find_section(struct filemapping *m, const char *name, int name_len,
+	     int *len)
+{
+  int i, nr = get_nr_sections(m);
+
+  for (i = 0; i < nr; ++i) {
+    const char *key;
+    int key_len;
+    char *contents;
+    if (get_nth_section(m, i, nr, &key, &key_len, &contents, len)) {
+      return NULL;
+    }
+    if (key_len == name_len && strncmp(name, key, key_len) == 0) {
+      return contents;
     }
   }
   return NULL;
 }
 
+/** mapした辞書ファイルからセクションを探す
+ * ファイルからはみ出すセクションは無いものとする
+ */
+void*
+anthy_file_dic_image_get_section(struct filemapping *m,
+				 const char* section_name)
+{
+  int len;
+  return find_section(m, section_name, strlen(section_name), &len);
+}
+
+/** mapした辞書ファイルのexcept以外のセクションが、
+ * 使用中のanthy.dicのものと同じ内容かを調べる、同じなら0を返す
+ */
+int
+anthy_file_dic_image_check_sections(struct filemapping *m,
+				    const char *except)
+{
+  int i, nr = get_nr_sections(fdic.mapping);
+
+  if (nr < 0 || nr != get_nr_sections(m)) {
+    return -1;
+  }
+  for (i = 0; i < nr; i++) {
+    const char *key;
+    int key_len, len, new_len;
+    char *contents, *new_contents;
+    if (get_nth_section(fdic.mapping, i, nr, &key, &key_len,
+			&contents, &len)) {
+      return -1;
+    }
+    if (key_len == (int)strlen(except) && !strncmp(except, key, key_len)) {
+      continue;
+    }
+    new_contents = find_section(m, key, key_len, &new_len);
+    if (!new_contents || new_len != len ||
+	memcmp(contents, new_contents, len)) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/** 辞書中のよく使われる部分を先読みする
+ * DIC_PREFETCHが"touch"なら各ページに触れ、"no"なら何もしない
+ */
+void
+anthy_file_dic_prefetch(void *addr, int len)
+{
+  anthy_file_dic_image_prefetch(fdic.mapping, addr, len);
+}
+
+/** mapした辞書ファイルの一部をDIC_PREFETCHに従って先読みする */
+void
+anthy_file_dic_image_prefetch(struct filemapping *m, void *addr, int len)
+{
+  const char *policy = anthy_conf_get_str("DIC_PREFETCH");
+  int touch = 0;
+  if (policy) {
+    if (!strcmp(policy, "no")) {
+      return ;
+    }
+    if (!strcmp(policy, "touch")) {
+      touch = 1;
+    }
+  }
+  anthy_mmap_prefetch(m, addr, len, touch);
+}
+
+static int
+conf_is_yes(const char *var)
+{
+  const char *val = anthy_conf_get_str(var);
+  if (val && (!strcmp(val, "yes") || !strcmp(val, "1"))) {
+    return 1;
+  }
+  return 0;
+}
+
+/* 設定から辞書をmapする際の方針を決める */
+static int
+get_mmap_policy(void)
+{
+  int policy = 0;
+  if (conf_is_yes("DIC_POPULATE")) {
+    policy |= ANTHY_MMAP_POPULATE;
+  }
+  if (conf_is_yes("DIC_HUGEPAGE")) {
+    policy |= ANTHY_MMAP_HUGEPAGE;
+  }
+  if (conf_is_yes("DIC_MLOCK")) {
+    policy |= ANTHY_MMAP_LOCK;
+  }
+  return policy;
+}
+
+/** 辞書ファイルを設定に従った方針でmapする
+ * anthy.dic以外の辞書ファイルもこれでmapする
+ */
+struct filemapping *
+anthy_file_dic_mmap(const char *fn)
+{
+  return anthy_mmap_with_policy(fn, 0, get_mmap_policy());
+}
+
 int
 anthy_init_file_dic(void)
 {
@@ -47,8 +210,8 @@ anthy_init_file_dic(void)
     return -1;
   }
 
-  /* map */
-  fdic.mapping = anthy_mmap(fn, 0);
+  /* 辞書をメモリ上にmapする */
+  fdic.mapping = anthy_file_dic_mmap(fn);
   if (!fdic.mapping) {
     anthy_log(0, "failed to init file dic.\n");
     return -1;
@@ -1,7 +1,7 @@
-/* mmapݲ
+/* mmapを抽象化する
  *
- * *UnixϤΥƥॳ򥽡˻餵ʤ
- * *ŪˤϰĤΥեʣŪmap뤳Ȥθ
+ * *Unix系のシステムコールをソース中に散らさないため
+ * *将来的には一つのファイルを複数の目的にmapすることも考慮
  *
  * Copyright (C) 2005 TABATA Yusuke
  *
@@ -24,24 +24,91 @@
 #include <sys/types.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <anthy/filemap.h>
 #include <anthy/logger.h>
 
 struct filemapping {
-  /* 񤭹ߥ⡼ */
+  /* 書き込みモード */
   int wr;
-  /* mmapɥ쥹 */
+  /* mmapしたアドレス */
   void *ptr;
-  /* mmapΰĹ */
+  /* mmapした領域の長さ */
   size_t size;
 };
 
+/* 経過時間をマイクロ秒で返す */
+static long
+elapsed_usec(struct timeval *from)
+{
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (now.tv_sec - from->tv_sec) * 1000000L +
+    (now.tv_usec - from->tv_usec);
+}
+
+/* 方針に従ってmapした領域を準備する、実際に適用した方針を返す */
+static int
+apply_policy(const char *fn, void *ptr, size_t size, int policy)
+{
+  int applied = policy & ANTHY_MMAP_POPULATE;
+  if (policy & ANTHY_MMAP_HUGEPAGE) {
+#ifdef MADV_HUGEPAGE
+    if (madvise(ptr, size, MADV_HUGEPAGE) == 0) {
+      applied |= ANTHY_MMAP_HUGEPAGE;
+    } else {
+      anthy_log(0, "Failed to use hugepages for (%s).\n", fn);
+    }
+#else
+    anthy_log(0, "Hugepages are not supported (%s).\n", fn);
+#endif
+  }
+  if (policy & ANTHY_MMAP_LOCK) {
+    if (mlock(ptr, size) == 0) {
+      applied |= ANTHY_MMAP_LOCK;
+    } else {
+      anthy_log(0, "Failed to mlock() (%s).\n", fn);
+    }
+  }
+  return applied;
+}
+
+/* 記録するために適用した方針を文字列にする、
+ * hugepageはmadviseで頼んだだけで使われるとは限らない */
+static void
+format_policy(char *buf, int policy)
+{
+  buf[0] = 0;
+  if (!policy) {
+    strcat(buf, ", plain");
+  }
+  if (policy & ANTHY_MMAP_POPULATE) {
+    strcat(buf, ", populate");
+  }
+  if (policy & ANTHY_MMAP_HUGEPAGE) {
+    strcat(buf, ", hugepage advised");
+  }
+  if (policy & ANTHY_MMAP_LOCK) {
+    strcat(buf, ", mlock");
+  }
+}
+
 struct filemapping *
 anthy_mmap(const char *fn, int wr)
+{
+  return anthy_mmap_with_policy(fn, wr, 0);
+}
+
+/** ファイルをmapする
+ * policyにはANTHY_MMAP_*の組み合わせを指定する
+ */
+struct filemapping *
+anthy_mmap_with_policy(const char *fn, int wr, int policy)
 {
   int fd;
   void *ptr;
@@ -50,7 +117,10 @@ anthy_mmap(const char *fn, int wr)
   struct stat st;
   int prot;
   int flags;
+  int map_flags = MAP_SHARED;
   mode_t mode;
+  struct timeval start;
+  char policy_buf[64];
 
   if (wr) {
     prot = PROT_READ | PROT_WRITE;
@@ -81,14 +151,27 @@ anthy_mmap(const char *fn, int wr)
     return NULL;
   }
 
-  ptr = mmap(NULL, st.st_size, prot, MAP_SHARED, fd, 0);
+  gettimeofday(&start, NULL);
+#ifdef MAP_POPULATE
+  if (policy & ANTHY_MMAP_POPULATE) {
+    map_flags |= MAP_POPULATE;
+  }
+#else
+  policy &= ~ANTHY_MMAP_POPULATE;
+#endif
+  ptr = mmap(NULL, st.st_size, prot, map_flags, fd, 0);
   close(fd);
   if (ptr == MAP_FAILED) {
     anthy_log(0, "Failed to mmap() (%s).\n", fn);
     return NULL;
   }
+  /* 方針が無くても実際に適用したものを記録する */
+  policy = apply_policy(fn, ptr, st.st_size, policy);
+  format_policy(policy_buf, policy);
+  anthy_log(2, "mapped %s (%ld bytes%s) in %ld usec.\n",
+	    fn, (long)st.st_size, policy_buf, elapsed_usec(&start));
 
-  /* mmapΤǾ֤ */
+  /* mmapに成功したので情報を返す */
   m = malloc(sizeof(struct filemapping));
   m->size = st.st_size;
   m->ptr = ptr;
@@ -124,6 +207,42 @@ anthy_mmap_is_writable(struct filemapping *m)
   return m->wr;
 }
 
+/** addrからlenバイトをページキャッシュに読み込んでおく
+ * touchが真ならば各ページに触れて実際にmapさせる
+ */
+void
+anthy_mmap_prefetch(struct filemapping *m, void *addr, int len, int touch)
+{
+  long pagesize = sysconf(_SC_PAGESIZE);
+  char *begin, *end;
+  if (!m || len <= 0) {
+    return ;
+  }
+  begin = (char *)addr;
+  end = begin + len;
+  if (begin < (char *)m->ptr) {
+    begin = m->ptr;
+  }
+  if (end > (char *)m->ptr + m->size) {
+    end = (char *)m->ptr + m->size;
+  }
+  /* madviseはページ境界から始める必要がある */
+  begin = (char *)m->ptr +
+    ((begin - (char *)m->ptr) / pagesize) * pagesize;
+  if (begin >= end) {
+    return ;
+  }
+  madvise(begin, end - begin, MADV_WILLNEED);
+  if (touch) {
+    volatile char c;
+    char *p;
+    for (p = begin; p < end; p += pagesize) {
+      c = *p;
+    }
+    (void)c;
+  }
+}
+
 void
 anthy_munmap(struct filemapping *m)
 {
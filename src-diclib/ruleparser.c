@@ -1,6 +1,6 @@
 /*
- * եʤɤΤ
- * ѤΥեɤ߹ߥ⥸塼
+ * 設定ファイルなどのための
+ * 汎用のファイル読み込みモジュール
  *
  * Copyright (C) 2000-2006 TABATA Yusuke
  *
@@ -29,9 +29,9 @@
 #include <anthy/ruleparser.h>
 #include <anthy/logger.h>
 
-/* ʸˡեΥѡѤ */
+/* 文法ファイルのパーザ用の定義 */
 #define MAX_TOKEN_LEN 256
-/* Υ󥯥롼ɤο */
+/* 最大のインクルードの深さ */
 #define MAX_INCLUDE_DEPTH 4
 
 #define PS_INIT 0
@@ -44,7 +44,7 @@ static const char *NL = "NL";
 static struct parser_stat {
   FILE *fp_stack[MAX_INCLUDE_DEPTH];
   FILE *fp;
-  int cur_fpp;/* åΥǥå */
+  int cur_fpp;/* スタックのインデックス */
   int line_num;
   char **tokens;
   int nr_token;
@@ -69,7 +69,7 @@ open_file_in_confdir(const char *fn)
 
   if (fn[0] == '/' ||
       (fn[0] == '.' && fn[1] == '/')) {
-    /* Хѥ⤷ϥȥǥ쥯ȥʤΤǤΤޤfopen */
+    /* 絶対パスもしくはカレントディレクトリなのでそのままfopen */
     return fopen(fn, "r");
   }
 
@@ -84,8 +84,8 @@ open_file_in_confdir(const char *fn)
   return fopen(full, "r");
 }
 
-/** Хååˤ륨פgetc
- * פ줿ʸʤ֤ͤ1ˤʤ롣
+/** バックスラッシュによるエスケープも処理するgetc
+ * エスケープされた文字ならば返り値は1になる。
  */
 static int
 mygetc (int *cc)
@@ -112,7 +112,7 @@ mygetc (int *cc)
 
 #define myisblank(c)	((c) == ' ' || (c) == '\t')
 
-/* Ԥ˰ʸɲä */
+/* 行に一文字追加する */
 static void
 pushchar(struct line_stat *ls, int cc)
 {
@@ -135,7 +135,7 @@ get_token_in(struct line_stat *ls)
   if (ls->stat == PS_RET) {
     return NL;
   }
-  /* ȡ󤬻ϤޤޤǶɤФ */
+  /* トークンが始まるまで空白を読み飛ばす */
   do {
     esc = mygetc(&cc);
   } while (cc > 0 && myisblank(cc) && esc == 0);
@@ -161,7 +161,7 @@ get_token_in(struct line_stat *ls)
       return ls->buf;
     }
     if (cc == '\n' && !esc) {
-      /*  */
+      /* 改行 */
       pushchar(ls, 0);
       ls->stat = PS_RET;
       return ls->buf;
@@ -178,7 +178,7 @@ get_token_in(struct line_stat *ls)
   return ls->buf;
 }
 
-/* ɤ */
+/* 一行読む */
 static int
 get_line_in(void)
 {
@@ -223,7 +223,7 @@ proc_include(void)
   g_ps.fp = fp;
 }
 
-/* 󥯥롼ɤΥͥȤ򲼤 */
+/* インクルードのネストを下げる */
 static void
 pop_file(void)
 {
@@ -243,7 +243,7 @@ get_line(void)
 
   r = get_line_in();
   if (r == -1){
-    /* EOFǤʾɤ */
+    /* EOF等でこれ以上読めん */
     if (g_ps.cur_fpp > 0) {
       pop_file();
       goto again;
@@ -290,7 +290,7 @@ anthy_open_file(const char *fn)
   if (!g_ps.fp_stack[0]) {
     return -1;
   }
-  /* ѡξ֤ */
+  /* パーザの状態を初期化する */
   g_ps.cur_fpp = 0;
   g_ps.fp = g_ps.fp_stack[0];
   g_ps.line_num = 0;
@@ -1,5 +1,5 @@
 /*
- * ʸ(xchar)Υפʤɤ򰷤
+ * 文字(xchar)のタイプなどを扱う
  *
  * Copyright (C) 2001-2006 TABATA Yusuke
  */
@@ -23,42 +23,42 @@ static struct xchar_ent {
   struct xchar_ent *next;/* hash chain */
 } xchar_tab[] =
 {
-  {0x309b, XCT_CLOSE, 0}, /*  */
-  {0xff08, XCT_OPEN, 0}, /* ʡ*/
-  {0xff09, XCT_CLOSE, 0}, /*  */
-  {0x3014, XCT_OPEN, 0},  /*  */
-  {0x3015, XCT_CLOSE, 0}, /*  */
-  {0xff3b, XCT_OPEN, 0}, /*  */
-  {0xff3d, XCT_CLOSE, 0}, /*  */
-  {0xff5b, XCT_OPEN, 0},  /*  */
-  {0xff5d, XCT_CLOSE, 0},  /* ѡ*/
-  {0x3008, XCT_OPEN, 0},  /* 㡡*/
-  {0x3009, XCT_CLOSE, 0},  /* 䡡*/
-  {0x300a, XCT_OPEN, 0},  /* ԡ*/
-  {0x300b, XCT_CLOSE, 0},  /* ա*/
-  {0x300c, XCT_OPEN, 0},  /* ֡*/
-  {0x300d, XCT_CLOSE, 0},  /* ס*/
-  {0x300e, XCT_OPEN, 0},  /* ء*/
-  {0x300f, XCT_CLOSE, 0},  /* ١*/
-  {0x3010, XCT_OPEN, 0},  /* ڡ*/
-  {0x3011, XCT_CLOSE, 0},  /* ۡ*/
-  {0x3001, XCT_PUNCTUATION, 0},  /* */
-  {0x3002, XCT_PUNCTUATION, 0},  /* */
-  {0xff0c, XCT_PUNCTUATION, 0},  /* */
-  {0xff0e, XCT_PUNCTUATION, 0},  /* */
-  {0xff1f, XCT_PUNCTUATION, 0},  /* */
-  {0xff01, XCT_PUNCTUATION, 0},  /* */
+  {0x309b, XCT_CLOSE, 0}, /* ” */
+  {0xff08, XCT_OPEN, 0}, /* （　*/
+  {0xff09, XCT_CLOSE, 0}, /* ） */
+  {0x3014, XCT_OPEN, 0},  /* 〔 */
+  {0x3015, XCT_CLOSE, 0}, /* 〕 */
+  {0xff3b, XCT_OPEN, 0}, /* ［ */
+  {0xff3d, XCT_CLOSE, 0}, /* ］ */
+  {0xff5b, XCT_OPEN, 0},  /* ｛ */
+  {0xff5d, XCT_CLOSE, 0},  /* ｝　*/
+  {0x3008, XCT_OPEN, 0},  /* ＜　*/
+  {0x3009, XCT_CLOSE, 0},  /* ＞　*/
+  {0x300a, XCT_OPEN, 0},  /* 《　*/
+  {0x300b, XCT_CLOSE, 0},  /* 》　*/
+  {0x300c, XCT_OPEN, 0},  /* 「　*/
+  {0x300d, XCT_CLOSE, 0},  /* 」　*/
+  {0x300e, XCT_OPEN, 0},  /* 『　*/
+  {0x300f, XCT_CLOSE, 0},  /* 』　*/
+  {0x3010, XCT_OPEN, 0},  /* 【　*/
+  {0x3011, XCT_CLOSE, 0},  /* 】　*/
+  {0x3001, XCT_PUNCTUATION, 0},  /* 、　*/
+  {0x3002, XCT_PUNCTUATION, 0},  /* 。　*/
+  {0xff0c, XCT_PUNCTUATION, 0},  /* ，　*/
+  {0xff0e, XCT_PUNCTUATION, 0},  /* ．　*/
+  {0xff1f, XCT_PUNCTUATION, 0},  /* ？　*/
+  {0xff01, XCT_PUNCTUATION, 0},  /* ！　*/
 
   {28, XCT_OPEN, 0}, /* ( */
   {133, XCT_OPEN, 0}, /* [ */
   {29, XCT_CLOSE, 0}, /* ) */
   {135, XCT_CLOSE, 0}, /* ] */
-  {HK_TO, XCT_DEP, 0},/*  */
-  {HK_HA, XCT_DEP, 0},/*  */
-  {HK_NO, XCT_DEP, 0},/*  */
-  {HK_NI, XCT_DEP, 0},/*  */
-  {HK_GA, XCT_DEP, 0},/*  */
-  {HK_WO, XCT_DEP, 0},/*  */
+  {HK_TO, XCT_DEP, 0},/* と */
+  {HK_HA, XCT_DEP, 0},/* は */
+  {HK_NO, XCT_DEP, 0},/* の */
+  {HK_NI, XCT_DEP, 0},/* に */
+  {HK_GA, XCT_DEP, 0},/* が */
+  {HK_WO, XCT_DEP, 0},/* を */
   {WIDE_0, XCT_WIDENUM, 0},
   {WIDE_1, XCT_WIDENUM, 0},
   {WIDE_2, XCT_WIDENUM, 0},
@@ -219,15 +219,15 @@ static const struct paren_ent {
 } paren_tab[] = {
   {'(', ')'},
   {'[', ']'},
-  {0xff08, 0xff09},/* ʡ */
-  {0x3014, 0x3015},/* ̡ */
-  {0xff3b, 0xff3d},/* Ρ*/
-  {0xff5b, 0xff5d},/* С */
-  {0x3008, 0x3009}, /*  */
-  {0x300a, 0x300b}, /*ԡ */
-  {0x300c, 0x300d}, /*֡ */
-  {0x300e, 0x300f}, /*ء */
-  {0x3010, 0x3011}, /*ڡ */
+  {0xff08, 0xff09},/* （） */
+  {0x3014, 0x3015},/* 〔〕 */
+  {0xff3b, 0xff3d},/* ［］*/
+  {0xff5b, 0xff5d},/* ｛｝ */
+  {0x3008, 0x3009}, /* ＜＞ */
+  {0x300a, 0x300b}, /*《》 */
+  {0x300c, 0x300d}, /*「」 */
+  {0x300e, 0x300f}, /*『』 */
+  {0x3010, 0x3011}, /*【】 */
   {0, 0},
 };
 
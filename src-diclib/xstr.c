@@ -1,14 +1,14 @@
 /*
- * AnthyǻȤʸν
+ * Anthy内部で使う文字列の処理
  *  typedef struct xstr_ {
  *    xstr *str; int len;
  *  } xstr;
  *
- * malloc(0);ΰ̣Ϲͤʤ0ʸʸ򰷤褦
- * ǥ󥰤򤹤롣free(0)ɤ
+ * malloc(0);の意味は考えないで0文字の文字列を扱えるような
+ * コーディングをする。free(0)は良い。
  *
- * ǥեȤǤ
- *  cstrC̤EUCʸ
+ * デフォルトの設定では
+ *  cstrはCの普通のEUC文字列
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  *
@@ -40,7 +40,7 @@
 #include <anthy/xchar.h>
 #include "diclib_inner.h"
 
-/* ̤˽ϤȤΥ󥳡ǥ */
+/* 画面に出力するときのエンコーディング */
 static int print_encoding;
 
 #define MAX_BYTES_PER_XCHAR 10
@@ -51,7 +51,7 @@ xc_isprint(xchar xc)
   return xc > 0;
 }
 
-/** CʸбxstrĹ׻
+/** Cの文字列に対応するxstrの長さを計算する
  */
 static int
 xlengthofcstr(const char *c)
@@ -168,7 +168,7 @@ ucs4_xstr_to_utf8(xstr *xs)
   return strdup(buf);
 }
 
-/** Cʸxstrѹ
+/** Cの文字列をxstrに変更する
  */
 xstr *
 anthy_cstr_to_xstr(const char *c, int encoding)
@@ -371,7 +371,7 @@ xstr*
 anthy_xstrcpy(xstr *dest, xstr *src)
 {
   int i;
-  /* ʸ򥳥ԡ */
+  /* 文字列をコピー */
   dest->len = src->len;
   for (i = 0; i < src->len; i++) {
     dest->str[i] = src->str[i];
@@ -379,7 +379,7 @@ anthy_xstrcpy(xstr *dest, xstr *src)
   
   return dest;
 }
-/* ֤ͤstrcmpƱ */
+/* 返り値の符号はstrcmpと同じ */
 int
 anthy_xstrcmp(xstr *x1, xstr *x2)
 {
@@ -406,7 +406,7 @@ anthy_xstrcmp(xstr *x1, xstr *x2)
   return 0;
 }
 
-/* ֤ͤstrncmpƱ */
+/* 返り値の符号はstrncmpと同じ */
 int
 anthy_xstrncmp(xstr *x1, xstr *x2, int n)
 {
@@ -469,7 +469,7 @@ anthy_xstrtoll(xstr *x)
 {
   xchar c;
   int i;
-  long long n = 0;/*  */
+  long long n = 0;/* 数 */
   if (!x->len || x->len > 16) {
     return -1;
   }
@@ -484,7 +484,7 @@ anthy_xstrtoll(xstr *x)
   return n;
 }
 
-/** ѤοȾѤˤ
+/** 全角の数字を半角にする
  */
 xstr *
 anthy_xstr_wide_num_to_num(xstr* src_xs)
@@ -498,7 +498,7 @@ anthy_xstr_wide_num_to_num(xstr* src_xs)
   return dst_xs;
 }
 
-/** ʿ̾򥫥ʤѴ
+/** 平仮名をカタカナに変換する
  */
 xstr *
 anthy_xstr_hira_to_kata(xstr *src_xs)
@@ -508,17 +508,17 @@ anthy_xstr_hira_to_kata(xstr *src_xs)
   dst_xs = anthy_xstr_dup(src_xs);
 
   for (i = 0 ,j = 0; i < dst_xs->len; i++, j++) {
-    /* ֤פΥå */
+    /* 「う゛」のチェック */
     if (i < dst_xs->len - 1 && dst_xs->str[i] == HK_U
 	&& dst_xs->str[i+1] == HK_DDOT) {
-      dst_xs->str[j] = KK_VU;/*  */
+      dst_xs->str[j] = KK_VU;/* ヴ */
       i++;
       continue ;
     }
     /**/
     dst_xs->str[j] = dst_xs->str[i];
     if ((anthy_ucs_to_euc(dst_xs->str[j]) & 0xff00) == 0xa400) {
-      /* Ҥ餬ʤä256­ */
+      /* ひらがなだったら256足す */
       dst_xs->str[j] = anthy_ucs_to_euc(dst_xs->str[j]);
       dst_xs->str[j] += 256;
       dst_xs->str[j] = anthy_euc_to_ucs(dst_xs->str[j]);
@@ -593,6 +593,29 @@ anthy_xstr_hash(xstr *xs)
   return h;
 }
 
+/** 一度の走査で独立な二つのhash値を計算する
+ * 一つ目を返し、二つ目をh2に格納する
+ */
+unsigned int
+anthy_xstr_hash_pair(xstr *xs, unsigned int *h2)
+{
+  unsigned int a = 2166136261U;
+  unsigned int b = 0x9e3779b9U;
+  int i;
+  for (i = 0; i < xs->len; i++) {
+    a ^= xs->str[i];
+    a *= 16777619U;
+    b += xs->str[i];
+    b *= 0x85ebca6bU;
+    b ^= b >> 13;
+  }
+  b ^= b >> 16;
+  b *= 0xc2b2ae35U;
+  b ^= b >> 16;
+  *h2 = b;
+  return a;
+}
+
 static char *
 conv_cstr(const char *s, int from, int to)
 {
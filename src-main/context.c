@@ -1,12 +1,12 @@
 /*
- * Ѵʸο̤ʤɤʹʸʤɤ
- * ޤȤѴƥȤȸƤ֡
- * AnthyΥƥȤФƤƤФ롣
- * ФѴѥץ饤ɬפʥ⥸塼˸ƤӤ
+ * 変換や文節の伸縮などの操作が進行中の文字列や候補などを
+ * まとめて変換コンテキストと呼ぶ。
+ * Anthyのコンテキストに対する操作は全てここから呼ばれる。
+ * 各操作に対して変換パイプラインの必要なモジュールを順に呼びだす。
  *
- * personalityδ⤹롣
+ * personalityの管理もする。
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 10/29
+ * Funded by IPA未踏ソフトウェア創造事業 2001 10/29
  * Copyright (C) 2000-2007 TABATA Yusuke
  *
  * $Id: context.c,v 1.26 2002/11/17 14:45:47 yusuke Exp $
@@ -36,6 +36,7 @@
 
 #include <anthy/anthy.h>
 #include <anthy/alloc.h>
+#include <anthy/conf.h>
 #include <anthy/record.h>
 #include <anthy/ordering.h>
 #include <anthy/splitter.h>
@@ -45,10 +46,20 @@
 /**/
 static allocator context_ator;
 
-/** ߤpersonality 
- * ̤: null
- * ̤ΤޤѴ򳫻Ϥ: "default"
- * anonymousξ: ""
+/** 解放されたコンテキストを作業領域ごと取っておくプール
+ * 大きさは設定項目CONTEXT_POOLで指定する
+ */
+static struct anthy_context **context_pool;
+static int context_pool_size;
+static int nr_pooled_contexts;
+static int context_pool_warmed;
+/* プールのコンテキストに前もって作業領域を確保しておく文字数 */
+#define CONTEXT_POOL_RESERVE_LEN 32
+
+/** 現在のpersonality 
+ * 未設定時: null
+ * 未設定のまま変換を開始した場合: "default"
+ * anonymousの場合: ""
  */
 static char *current_personality;
 
@@ -58,10 +69,16 @@ static char *current_personality;
 static void
 context_dtor(void *p)
 {
-  anthy_do_reset_context((struct anthy_context *)p);
+  struct anthy_context *ac = (struct anthy_context *)p;
+  if (ac->dic_session) {
+    anthy_dic_release_session(ac->dic_session);
+    ac->dic_session = NULL;
+  }
+  anthy_do_reset_context(ac);
+  anthy_free_split_context(&ac->split_info);
 }
 
-/** ߤpersonality֤ */
+/** 現在のpersonalityを返す */
 static char *
 get_personality(void)
 {
@@ -89,23 +106,34 @@ release_segment(struct seg_ent *s)
   
 }
 
-/** ʸꥹȤκǸǤ */
-static void
-pop_back_seg_ent(struct anthy_context *c)
+/** 文節リストの最後の要素をリストから外す */
+static struct seg_ent *
+unlink_back_seg_ent(struct segment_list *sl)
 {
   struct seg_ent *s;
-  s = c->seg_list.list_head.prev;
-  if (s == &c->seg_list.list_head) {
-    return ;
+  s = sl->list_head.prev;
+  if (s == &sl->list_head) {
+    return NULL;
   }
   s->prev->next = s->next;
   s->next->prev = s->prev;
-  release_segment(s);
-  c->seg_list.nr_segments --;
+  sl->nr_segments --;
+  return s;
+}
+
+/** 文節リストの最後の要素を削除する */
+static void
+pop_back_seg_ent(struct anthy_context *c)
+{
+  struct seg_ent *s;
+  s = unlink_back_seg_ent(&c->seg_list);
+  if (s) {
+    release_segment(s);
+  }
 }
 
 
-/** nܤʸʸindex */
+/** n番目の文節の文字のindexを求める */
 static int
 get_nth_segment_index(struct anthy_context *c, int n)
 {
@@ -121,8 +149,8 @@ get_nth_segment_index(struct anthy_context *c, int n)
   return -1;
 }
 
-/** nܤʸĹ롥
- * segment_listƤʤƤ׻Ǥ褦ˤ롥
+/** n番目の文節の長さを求める．
+ * segment_listが構成されていなくても計算できるようにする．
  */
 static int
 get_nth_segment_len(struct anthy_context *c, int sindex)
@@ -139,7 +167,7 @@ get_nth_segment_len(struct anthy_context *c, int sindex)
   return l;
 }
 
-/** metaword */
+/** metawordの配列を作る */
 static void
 make_metaword_array(struct anthy_context *ac,
 		    struct seg_ent *se)
@@ -148,10 +176,10 @@ make_metaword_array(struct anthy_context *ac,
   se->mw_array = NULL;
   for (i = se->len; i > 0; i--) {
     int j;
-    /* ǸȤĤƤľʸ */
+    /* 最後に濁点とかがついてたら直前の文字ごと落す */
     if (i < se->len &&
 	anthy_get_xchar_type(se->str.str[i]) & XCT_PART) {
-      /* FIXME Ȥꤨʤ¤Ӥ򤷤Ƥ */
+      /* FIXME 濁点とかがありえない並びをしてたら */
       i--;
       continue ;
     }
@@ -160,7 +188,7 @@ make_metaword_array(struct anthy_context *ac,
     if (!se->nr_metaword) {
       continue ;
     }
-    /* metaword˼ */
+    /* metawordを配列に取り込む */
     se->mw_array = malloc(sizeof(struct meta_word*) * se->nr_metaword);
     for (j = 0; j < se->nr_metaword; j++) {
       se->mw_array[j] = anthy_get_nth_metaword(&ac->split_info, se->from, i, j);
@@ -187,7 +215,7 @@ create_segment(struct anthy_context *ac, int from, int len,
   return s;
 }
 
-/** ѴƥȤʸɲä */
+/** 変換コンテキストに文節を追加する */
 static void
 push_back_segment(struct anthy_context *ac, struct seg_ent *se)
 {
@@ -199,15 +227,15 @@ push_back_segment(struct anthy_context *ac, struct seg_ent *se)
   se->committed = -1;
 }
 
-/** splitterˤäդ줿ʸᶭΥޡ顢
- * ʸΥꥹȤ
+/** splitterによって配列中に付けられた文節境界のマークから、
+ * 文節のリストを構成する
  */
 static void
 create_segment_list(struct anthy_context *ac, int from, int to)
 {
   int i, n;
   struct seg_ent *s;
-  /* from νޤǤˤĤʸ᤬뤫Ĵ٤ */
+  /* from の所までにいくつの文節があるか調べる */
   i = 0; n = 0;
   while (i < from) {
     i += get_nth_segment_len(ac, n);
@@ -225,16 +253,11 @@ create_segment_list(struct anthy_context *ac, int from, int to)
   }
 }
 
-/** ƥȤ */
-struct anthy_context *
-anthy_do_create_context(int encoding)
+/** コンテキストを作る */
+static struct anthy_context *
+alloc_context(void)
 {
   struct anthy_context *ac;
-  char *p = get_personality();
-
-  if (!p) {
-    return NULL;
-  }
 
   ac = (struct anthy_context *)anthy_smalloc(context_ator);
   ac->str.str = NULL;
@@ -244,30 +267,102 @@ anthy_do_create_context(int encoding)
   ac->seg_list.list_head.next = &ac->seg_list.list_head;
   ac->split_info.word_split_info = NULL;
   ac->split_info.ce = NULL;
+  ac->split_info.nr_reserved = 0;
   ac->ordering_info.oc = NULL;
   ac->dic_session = NULL;
   ac->prediction.str.str = NULL;
   ac->prediction.str.len = 0;
   ac->prediction.nr_prediction = 0;
   ac->prediction.predictions = NULL;
+
+  return ac;
+}
+
+/*
+ * プールを辞書セッションと作業領域を用意したコンテキストで満たす
+ * 辞書セッションがpersonalityを必要とするので最初のcreateの時に行う
+ */
+static void
+warm_context_pool(void)
+{
+  struct anthy_context *ac;
+
+  context_pool_warmed = 1;
+  while (nr_pooled_contexts < context_pool_size) {
+    ac = alloc_context();
+    ac->dic_session = anthy_dic_create_session();
+    anthy_reserve_split_context(&ac->split_info, CONTEXT_POOL_RESERVE_LEN);
+    context_pool[nr_pooled_contexts++] = ac;
+  }
+}
+
+struct anthy_context *
+anthy_do_create_context(int encoding)
+{
+  struct anthy_context *ac;
+  char *p = get_personality();
+
+  if (!p) {
+    return NULL;
+  }
+
+  if (!context_pool_warmed) {
+    warm_context_pool();
+  }
+  if (nr_pooled_contexts > 0) {
+    ac = context_pool[--nr_pooled_contexts];
+  } else {
+    ac = alloc_context();
+  }
   ac->encoding = encoding;
   ac->reconversion_mode = ANTHY_RECONVERT_AUTO;
 
   return ac;
 }
 
-/** ƥȤΥ */
+/** コンテキストのアロケータとプールを作る */
 void
 anthy_init_contexts(void)
 {
+  const char *val = anthy_conf_get_str("CONTEXT_POOL");
+
   context_ator = anthy_create_allocator(sizeof(struct anthy_context),
 					context_dtor);
+  context_pool_size = val ? atoi(val) : 0;
+  if (context_pool_size < 0) {
+    context_pool_size = 0;
+  }
+  context_pool = NULL;
+  if (context_pool_size) {
+    context_pool = malloc(sizeof(struct anthy_context *) * context_pool_size);
+  }
+  nr_pooled_contexts = 0;
+  context_pool_warmed = 0;
 }
 
 void
 anthy_quit_contexts(void)
 {
+  /* プール中のコンテキストもここで解放される */
   anthy_free_allocator(context_ator);
+  free(context_pool);
+  context_pool = NULL;
+  context_pool_size = 0;
+  nr_pooled_contexts = 0;
+}
+
+/** 辞書の再読み込みの後で、プール中のコンテキストの辞書セッションを
+ * 新しい単語辞書に付け替えて、古い辞書を解放できるようにする
+ */
+void
+anthy_rebind_pooled_contexts(void)
+{
+  int i;
+  for (i = 0; i < nr_pooled_contexts; i++) {
+    if (context_pool[i]->dic_session) {
+      anthy_dic_reset_session(context_pool[i]->dic_session);
+    }
+  }
 }
 
 static void
@@ -299,17 +394,18 @@ anthy_release_segment_list(struct anthy_context *ac)
   ac->seg_list.nr_segments = 0;
 }
 
-/* resetǤcontextΤ˳ݤ줿꥽Ʋ */
+/* resetではcontextのために確保されたリソースを解放する
+ * 辞書セッションとsplitterの作業領域は次の変換のために残しておく
+ */
 void
 anthy_do_reset_context(struct anthy_context *ac)
 {
-  /* ޤ񥻥å */
+  /* まず辞書セッションのキャッシュを空にする */
   if (ac->dic_session) {
-    anthy_dic_release_session(ac->dic_session);
-    ac->dic_session = NULL;
+    anthy_dic_reset_session(ac->dic_session);
   }
   if (!ac->str.str) {
-    /* ʸꤵƤʤв٤ʪϤ⤦̵ */
+    /* 文字列が設定されていなければ解放すべき物はもう無い */
     return ;
   }
   free(ac->str.str);
@@ -317,40 +413,107 @@ anthy_do_reset_context(struct anthy_context *ac)
   anthy_release_split_context(&ac->split_info);
   anthy_release_segment_list(ac);
 
-  /* ͽ¬줿ʸβ */
+  /* 予測された文字列の解放 */
   release_prediction(&ac->prediction);
 }
 
 void
 anthy_do_release_context(struct anthy_context *ac)
 {
+  if (nr_pooled_contexts < context_pool_size) {
+    /* 作業領域を残したままプールに戻す */
+    anthy_do_reset_context(ac);
+    context_pool[nr_pooled_contexts++] = ac;
+    return ;
+  }
   anthy_sfree(context_ator, ac);
 }
 
+/*
+ * 伸縮前の文節のうち、位置と構成と直前の文節のクラスが
+ * 変わらなかったものから候補を引き継ぐ
+ */
+static void
+take_over_candidates(struct anthy_context *ac, int nth,
+		     struct segment_list *old_list)
+{
+  struct seg_ent *s, *o;
+  enum seg_class pc, old_pc;
+
+  s = anthy_get_nth_segment(&ac->seg_list, nth);
+  if (!s) {
+    return ;
+  }
+  pc = (nth > 0) ? s->prev->best_seg_class : SEG_HEAD;
+  old_pc = pc;
+  o = old_list->list_head.next;
+  while (s != &ac->seg_list.list_head && o != &old_list->list_head) {
+    if (s->from < o->from) {
+      pc = s->best_seg_class;
+      s = s->next;
+      continue ;
+    }
+    if (o->from < s->from) {
+      old_pc = o->best_seg_class;
+      o = o->next;
+      continue ;
+    }
+    if (s->len == o->len && s->best_mw == o->best_mw &&
+	s->best_seg_class == o->best_seg_class && pc == old_pc) {
+      s->cands = o->cands;
+      s->nr_cands = o->nr_cands;
+      o->cands = NULL;
+      o->nr_cands = 0;
+    }
+    pc = s->best_seg_class;
+    s = s->next;
+    old_pc = o->best_seg_class;
+    o = o->next;
+  }
+}
+
+/*
+ * nth番目以降の文節を作って候補を並べる
+ * old_listがあれば、そこから変わらなかった文節の候補を引き継ぐ
+ */
 static void
-make_candidates(struct anthy_context *ac, int from, int from2, int is_reverse)
+make_candidates(struct anthy_context *ac, int from, int from2, int is_reverse,
+		int nth, struct segment_list *old_list)
 {
   int i;
   int len = ac->str.len;
 
-  /* ʸζ */
-  /* from  from2δ֤˶뤳Ȥػߤ */
+  /* 文節の境界を設定 */
+  /* from と from2の間に境界を作ることを禁止する */
   anthy_mark_border(&ac->split_info, from, from2, len);
   create_segment_list(ac, from, len);
   anthy_sort_metaword(&ac->seg_list);
+  if (old_list) {
+    take_over_candidates(ac, nth, old_list);
+  }
 
-  /*  */
-  for (i = 0; i < ac->seg_list.nr_segments; i++) {
-    anthy_do_make_candidates(&ac->split_info,
-			     anthy_get_nth_segment(&ac->seg_list, i),
-			     is_reverse);
+  /* 候補を列挙 */
+  for (i = nth; i < ac->seg_list.nr_segments; i++) {
+    struct seg_ent *seg = anthy_get_nth_segment(&ac->seg_list, i);
+    if (seg->cands) {
+      /* 伸縮前の文節から引き継いだ */
+      continue ;
+    }
+    anthy_do_make_candidates(&ac->split_info, seg, is_reverse);
   }
-  /* 򥽡 */
-  anthy_sort_candidate(&ac->seg_list, 0);
+  /* 候補をソート
+   * 用例による並び替えは前後2文節の先頭の候補を見るので、
+   * nthの前の2文節も並べ直す */
+  anthy_sort_candidate(&ac->seg_list, (nth > 2) ? nth - 2 : 0);
 }
 
-int
-anthy_do_context_set_str(struct anthy_context *ac, xstr *s, int is_reverse)
+/*
+ * 文字列を設定して変換する
+ * fixed_bordersで指定された位置は最初の文節分割の際にまたがない
+ */
+static int
+set_str(struct anthy_context *ac, xstr *s, int is_reverse,
+	int *fixed_borders, int nr_fixed_borders)
 {
   int i;
 
@@ -358,18 +521,26 @@ anthy_do_context_set_str(struct anthy_context *ac, xstr *s, int is_reverse)
     return -1;
   }
 
-  /* ʸ򥳥ԡ(ʸʬ;פˤ0򥻥å) */
+  /* 文字列をコピー(一文字分余計にして0をセット) */
   ac->str.str = (xchar *)malloc(sizeof(xchar)*(s->len+1));
   anthy_xstrcpy(&ac->str, s);
   ac->str.str[s->len] = 0;
 
-  /* splitterν*/
+  /* splitterの初期化*/
   anthy_init_split_context(&ac->str, &ac->split_info, is_reverse);
 
-  /* θ */
-  make_candidates(ac, 0, 0, is_reverse);
+  for (i = 0; i < nr_fixed_borders; i++) {
+    ac->split_info.ce[fixed_borders[i]].fixed_border = 1;
+  }
+
+  /* 解の候補を作成 */
+  make_candidates(ac, 0, 0, is_reverse, 0, NULL);
+  /* 文節の伸縮の際には元の境界をまたいでもよい */
+  for (i = 0; i < nr_fixed_borders; i++) {
+    ac->split_info.ce[fixed_borders[i]].fixed_border = 0;
+  }
   
-  /* ǽꤷʸᶭФƤ */
+  /* 最初に設定した文節境界を覚えておく */
   for (i = 0; i < ac->seg_list.nr_segments; i++) {
     struct seg_ent *s = anthy_get_nth_segment(&ac->seg_list, i);
     ac->split_info.ce[s->from].initial_seg_len = s->len;
@@ -378,14 +549,68 @@ anthy_do_context_set_str(struct anthy_context *ac, xstr *s, int is_reverse)
   return 0;
 }
 
+int
+anthy_do_context_set_str(struct anthy_context *ac, xstr *s, int is_reverse)
+{
+  return set_str(ac, s, is_reverse, NULL, 0);
+}
+
+/*
+ * 漢字やカタカナの混じった文字列を再変換する
+ * 逆変換の第一候補をつないだ読みを順方向に変換する際に、
+ * 元の文節の境界を最初の文節分割の制約として残す
+ */
+int
+anthy_do_context_set_reconvert_str(struct anthy_context *ac, xstr *s)
+{
+  xstr *yomi;
+  int *borders;
+  int i, nr, retval;
+
+  /* 与えられた文字列を逆変換する */
+  retval = set_str(ac, s, 1, NULL, 0);
+  if (retval || !ac->seg_list.nr_segments) {
+    return retval;
+  }
+
+  /* 各文節の第一候補から読みを得て、読みの上での文節の境界を覚えておく */
+  yomi = NULL;
+  borders = malloc(sizeof(int) * ac->seg_list.nr_segments);
+  nr = 0;
+  for (i = 0; i < ac->seg_list.nr_segments; i++) {
+    struct seg_ent *seg = anthy_get_nth_segment(&ac->seg_list, i);
+    yomi = anthy_xstrcat(yomi, &seg->cands[0]->str);
+    /* 最後の境界は末尾なので除く、
+     * 平仮名で始まる文節は送り仮名や付属語を切り離しただけのことが
+     * 多いので、その前の境界は順方向の変換にまかせる */
+    if (i + 1 < ac->seg_list.nr_segments &&
+	!(anthy_get_xchar_type(ac->str.str[seg->next->from]) & XCT_HIRA)) {
+      borders[nr++] = yomi->len;
+    }
+  }
+
+  /* 逆変換の結果を捨てて順方向に変換する */
+  anthy_release_segment_list(ac);
+  anthy_release_split_context(&ac->split_info);
+  free(ac->str.str);
+  ac->str.str = NULL;
+  retval = set_str(ac, yomi, 0, borders, nr);
+
+  free(borders);
+  anthy_free_xstr(yomi);
+  return retval;
+}
+
 void
 anthy_do_resize_segment(struct anthy_context *ac,
 			int nth, int resize)
 {
   int i;
   int index, len, sc;
+  struct segment_list old_list;
+  struct seg_ent *s;
 
-  /* resizeǽ */
+  /* resizeが可能か検査する */
   if (nth >= ac->seg_list.nr_segments) {
     return ;
   }
@@ -398,14 +623,22 @@ anthy_do_resize_segment(struct anthy_context *ac,
     return ;
   }
 
-  /* nthʹߤseg_ent */
+  /* nth以降のseg_entをリストから外しておく */
+  old_list.nr_segments = 0;
+  old_list.list_head.prev = &old_list.list_head;
+  old_list.list_head.next = &old_list.list_head;
   sc = ac->seg_list.nr_segments;
   for (i = nth; i < sc; i++) {
-    pop_back_seg_ent(ac);
+    s = unlink_back_seg_ent(&ac->seg_list);
+    s->next = old_list.list_head.next;
+    s->prev = &old_list.list_head;
+    old_list.list_head.next->prev = s;
+    old_list.list_head.next = s;
+    old_list.nr_segments ++;
   }
 
-  /* resizeseg_borderޡ */
-  /* ߤΥޡäƿޡĤ */
+  /* resizeしたseg_borderをマークする */
+  /* 現在のマークを消して新しいマークをつける */
   ac->split_info.ce[index+len].seg_border = 0;
   ac->split_info.ce[ac->str.len].seg_border = 1;
   for (i = index+len+resize+1; i < ac->str.len; i++) {
@@ -416,13 +649,19 @@ anthy_do_resize_segment(struct anthy_context *ac,
     ac->split_info.ce[i].best_mw = NULL;
   }
 
-  /* θ */
-  make_candidates(ac, index,
-		  index + len + resize, 0);
+  /* 解の候補を作成
+   * 逆変換のコンテキストでは元の文節と候補の作り方が違うので引き継がない */
+  make_candidates(ac, index, index + len + resize, 0, nth,
+		  ac->split_info.is_reverse ? NULL : &old_list);
+
+  /* 引き継がなかった文節を解放する */
+  while ((s = unlink_back_seg_ent(&old_list))) {
+    release_segment(s);
+  }
 }
 
 /*
- * n֤ʸ롢̵ˤNULL֤
+ * n番めの文節を取得する、無い場合にはNULLを返す
  */
 struct seg_ent *
 anthy_get_nth_segment(struct segment_list *sl, int n)
@@ -443,15 +682,14 @@ anthy_do_set_prediction_str(struct anthy_context *ac, xstr* xs)
   struct prediction_cache* prediction = &ac->prediction;
   int nr_prediction;
 
-  /* ޤ񥻥å */
+  /* まず辞書セッションのキャッシュを空にする */
   if (ac->dic_session) {
-    anthy_dic_release_session(ac->dic_session);
-    ac->dic_session = NULL;
+    anthy_dic_reset_session(ac->dic_session);
   }
-  /* ͽ¬줿ʸβ */
+  /* 予測された文字列の解放 */
   release_prediction(&ac->prediction);
 
-  /* 񥻥åγ */
+  /* 辞書セッションの開始 */
   if (!ac->dic_session) {
     ac->dic_session = anthy_dic_create_session();
     if (!ac->dic_session) {
@@ -505,7 +743,7 @@ static void
 write_history(FILE *fp, struct anthy_context *ac)
 {
   int i;
-  /* ɤ */
+  /* 読み */
   fprintf(fp, "|");
   for (i = 0; i < ac->seg_list.nr_segments; i++) {
     struct seg_ent *s = anthy_get_nth_segment(&ac->seg_list, i);
@@ -514,7 +752,7 @@ write_history(FILE *fp, struct anthy_context *ac)
     free(c);
   }
   fprintf(fp, " |");
-  /*  */
+  /* 結果 */
   for (i = 0; i < ac->seg_list.nr_segments; i++) {
     struct seg_ent *s = anthy_get_nth_segment(&ac->seg_list, i);
     char *c;
@@ -557,7 +795,7 @@ anthy_save_history(const char *fn, struct anthy_context *ac)
   chmod(fn, S_IREAD | S_IWRITE);
 }
 
-/** ɽ */
+/** 候補を表示する */
 void
 anthy_print_candidate(struct cand_ent *ce)
 {
@@ -607,7 +845,7 @@ anthy_print_candidate(struct cand_ent *ce)
   }
 }
 
-/** ʸɽ */
+/** 文節を表示する */
 static void
 print_segment(struct seg_ent *e)
 {
@@ -622,7 +860,7 @@ print_segment(struct seg_ent *e)
   printf("):(best=%s)\n", anthy_seg_class_sym(e->best_seg_class));
 }
 
-/** ƥȤɽ */
+/** コンテキストを表示する */
 void
 anthy_do_print_context(struct anthy_context *ac, int encoding)
 {
@@ -630,12 +868,13 @@ anthy_do_print_context(struct anthy_context *ac, int encoding)
   struct char_ent *ce;
   anthy_xstr_set_print_encoding(encoding);
 
+  /* ceは変換していなくても使い回しのために残っている */
   ce = ac->split_info.ce;
-  if (!ce) {
+  if (!ce || !ac->str.str) {
     printf("(invalid)\n");
     return ;
   }
-  /* ʸɽ */
+  /* 各文字を表示する */
   for (i = 0, ce = ac->split_info.ce; i < ac->str.len; i++, ce++) {
     if (ce->seg_border) {
       printf("|");
@@ -643,7 +882,7 @@ anthy_do_print_context(struct anthy_context *ac, int encoding)
     anthy_putxchar(*(ce->c));
   }
   printf("\n");
-  /* ʸɽ */
+  /* 各文節を表示する */
   for (i = 0; i < ac->seg_list.nr_segments; i++) {
     print_segment(anthy_get_nth_segment(&ac->seg_list, i));
   }
@@ -666,7 +905,7 @@ int
 anthy_do_set_personality(const char *id)
 {
   if (current_personality) {
-    /* ǤꤵƤ */
+    /* すでに設定されてる */
     return -1;
   }
   if (!id || strchr(id, '/')) {
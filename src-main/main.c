@@ -4,10 +4,10 @@
  * (many Japanese gramatical terms will appear.)
  *
  * Kana-Kanji conversion engine Anthy.
- * ̾Ѵ󥸥Anthy(󥷡)
+ * 仮名漢字変換エンジンAnthy(アンシー)
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 9/22
- * Funded by IPA̤Ƨեȥ¤ 2005
+ * Funded by IPA未踏ソフトウェア創造事業 2001 9/22
+ * Funded by IPA未踏ソフトウェア創造事業 2005
  * Copyright (C) 2000-2007 TABATA Yusuke, UGAWA Tomoharu
  * Copyright (C) 2004-2006 YOSHIDA Yuichi
  * Copyright (C) 2000-2007 KMC(Kyoto University Micro Computer Club)
@@ -30,17 +30,17 @@
   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
  */
 /*
- * AnthyѴǽϥ饤֥ȤƹƤꡢ
- * եˤϥ饤֥󶡤ؿ(API)ҤƤޤ
+ * Anthyの変換機能はライブラリとして構成されており、この
+ * ファイルにはライブラリの提供する関数(API)が記述されています。
  *
- * 饤֥󶡤ؿϲΤ褦ʤΤޤ
- * (1)饤֥Τνλ
- * (2)ѴƥȤκ
- * (3)ѴƥȤФʸꡢʸĹѹμ
+ * ライブラリの提供する関数は下記のようなものがあります
+ * (1)ライブラリ全体の初期化、終了、設定
+ * (2)変換コンテキストの作成、解放
+ * (3)変換コンテキストに対する文字列の設定、文節長の変更、候補の取得等
  *
- * 󥿡ե˴ؤƤ doc/LIB򻲾ȤƤ
- * AnthyΥɤ򤷤褦Ȥ
- * doc/GLOSSARY Ѹİ뤳Ȥ򴫤ޤ
+ * インターフェイスに関しては doc/LIBを参照してください
+ * Anthyのコードを理解しようとする場合は
+ * doc/GLOSSARY で用語を把握することを勧めます
  */
 #include <string.h>
 #include <stdlib.h>
@@ -59,24 +59,24 @@
 #include "config.h"
 
 
-/** AnthyνλɤΥե饰 */
+/** Anthyの初期化が完了したかどうかのフラグ */
 static int is_init_ok;
-/** ƥΥ󥳡ǥ */
+/** コンテキスト生成時のエンコーディング */
 static int default_encoding;
 /***/
 static char *history_file;
 
-/** (API) Τν */
+/** (API) 全体の初期化 */
 int
 anthy_init(void)
 {
   char *hfn;
   if (is_init_ok) {
-    /* 2ٽʤ褦 */
+    /* 2度初期化しないように */
     return 0;
   }
 
-  /* ƥ֥ƥ˽ */
+  /* 各サブシステムを順に初期化する */
   if (anthy_init_dic()) {
     anthy_log(0, "Failed to initialize dictionary.\n");
     return -1;
@@ -111,7 +111,7 @@ int anthy_init_utf8() {
   return r;
 }
 
-/** (API) ǡβ */
+/** (API) 全データの解放 */
 void
 anthy_quit(void)
 {
@@ -121,7 +121,7 @@ anthy_quit(void)
   anthy_quit_contexts();
   anthy_quit_personality();
   anthy_quit_splitter();
-  /* ¿Υǡ¤ϤallocatorˤäƲ */
+  /* 多くのデータ構造はここでallocatorによって解放される */
   anthy_quit_dic();
 
   is_init_ok = 0;
@@ -132,21 +132,50 @@ anthy_quit(void)
   history_file = NULL;
 }
 
-/** (API) ܤξ */
+/** (API) 設定項目の上書き */
 void
 anthy_conf_override(const char *var, const char *val)
 {
   anthy_do_conf_override(var, val);
 }
 
-/** (API) personality */
+/** (API) personalityの設定 */
 int
 anthy_set_personality(const char *id)
 {
   return anthy_do_set_personality(id);
 }
 
-/** (API) Ѵcontextκ */
+/** (API) 単語辞書の再読み込み
+ * fnがNULLならば設定のDIC_FILEを読み込む
+ */
+int
+anthy_reload_dic(const char *fn)
+{
+  if (!is_init_ok) {
+    return -1;
+  }
+  if (anthy_dic_reload(fn)) {
+    return -1;
+  }
+  /* プール中のコンテキストが古い辞書を使い続けないようにする */
+  anthy_rebind_pooled_contexts();
+  return 0;
+}
+
+/** (API) 入力待ちの間の処理
+ * 学習データの差分ファイルが大きくなっていれば基本ファイルにまとめる
+ */
+void
+anthy_idle(void)
+{
+  if (!is_init_ok) {
+    return ;
+  }
+  anthy_compact_record();
+}
+
+/** (API) 変換contextの作成 */
 struct anthy_context *
 anthy_create_context(void)
 {
@@ -156,14 +185,14 @@ anthy_create_context(void)
   return anthy_do_create_context(default_encoding);
 }
 
-/** (API) ѴcontextΥꥻå */
+/** (API) 変換contextのリセット */
 void
 anthy_reset_context(struct anthy_context *ac)
 {
   anthy_do_reset_context(ac);
 }
 
-/** (API) Ѵcontextβ */
+/** (API) 変換contextの解放 */
 void
 anthy_release_context(struct anthy_context *ac)
 {
@@ -171,7 +200,7 @@ anthy_release_context(struct anthy_context *ac)
 }
 
 /** 
- * ѴɬפɤȽ
+ * 再変換が必要かどうかの判定
  */
 static int
 need_reconvert(struct anthy_context *ac, xstr *xs)
@@ -189,9 +218,9 @@ need_reconvert(struct anthy_context *ac, xstr *xs)
     xchar xc = xs->str[i];
     int type = anthy_get_xchar_type(xc);
 
-    /* ʸξϵѴ
-     * ֥פϥեȥɤʿ̾⡼ɤʸȤäƤΤǡ
-     * ѴоݤȤϤʤ
+    /* これらの文字種の場合は逆変換する
+     * 「ヴ」はフロントエンドが平仮名モードの文字列として送ってくるので、
+     * 逆変換の対象とはしない
      */
     if (!(type & (XCT_HIRA | XCT_SYMBOL | XCT_NUM |
 		  XCT_WIDENUM | XCT_OPEN | XCT_CLOSE |
@@ -204,7 +233,7 @@ need_reconvert(struct anthy_context *ac, xstr *xs)
 }
 
 
-/** (API) Ѵʸ */
+/** (API) 変換文字列の設定 */
 int
 anthy_set_string(struct anthy_context *ac, const char *s)
 {
@@ -215,10 +244,10 @@ anthy_set_string(struct anthy_context *ac, const char *s)
     return -1;
   }
 
-  /**/
+  /*初期化*/
   anthy_do_reset_context(ac);
 
-  /* 񥻥åγ */
+  /* 辞書セッションの開始 */
   if (!ac->dic_session) {
     ac->dic_session = anthy_dic_create_session();
     if (!ac->dic_session) {
@@ -227,41 +256,24 @@ anthy_set_string(struct anthy_context *ac, const char *s)
   }
 
   anthy_dic_activate_session(ac->dic_session);
-  /* Ѵ򳫻Ϥ˸Ŀͼreload */
+  /* 変換を開始する前に個人辞書をreloadする */
   anthy_reload_record();
 
   xs = anthy_cstr_to_xstr(s, ac->encoding);
   /**/
   if (!need_reconvert(ac, xs)) {
-    /* ̤Ѵ */
+    /* 普通に変換する */
     retval = anthy_do_context_set_str(ac, xs, 0);
   } else {
-    /* 䥫ʤäƤѴƤߤ */
-    struct anthy_conv_stat stat;
-    struct seg_ent *seg;
-    int i;
-    xstr* hira_xs;
-    /* Ϳ줿ʸѴ򤫤 */
-    retval = anthy_do_context_set_str(ac, xs, 1);
-
-    /* ʸʿ̾ */
-    anthy_get_stat(ac, &stat);
-    hira_xs = NULL;
-    for (i = 0; i < stat.nr_segment; ++i) {
-      seg = anthy_get_nth_segment(&ac->seg_list, i);
-      hira_xs = anthy_xstrcat(hira_xs, &seg->cands[0]->str);
-    }
-    /* ѴԤʤ */
-    anthy_release_segment_list(ac);
-    retval = anthy_do_context_set_str(ac, hira_xs, 0);
-    anthy_free_xstr(hira_xs);
+    /* 漢字やカタカナが混じっていたら読みを求めて再変換する */
+    retval = anthy_do_context_set_reconvert_str(ac, xs);
   }
 
   anthy_free_xstr(xs);
   return retval;
 }
 
-/** (API) ʸĹѹ */
+/** (API) 文節長の変更 */
 void
 anthy_resize_segment(struct anthy_context *ac, int nth, int resize)
 {
@@ -269,7 +281,7 @@ anthy_resize_segment(struct anthy_context *ac, int nth, int resize)
   anthy_do_resize_segment(ac, nth, resize);
 }
 
-/** (API) Ѵξ֤μ */
+/** (API) 変換の状態の取得 */
 int
 anthy_get_stat(struct anthy_context *ac, struct anthy_conv_stat *s)
 {
@@ -277,7 +289,7 @@ anthy_get_stat(struct anthy_context *ac, struct anthy_conv_stat *s)
   return 0;
 }
 
-/** (API) ʸξ֤μ */
+/** (API) 文節の状態の取得 */
 int
 anthy_get_segment_stat(struct anthy_context *ac, int n,
 		       struct anthy_segment_stat *s)
@@ -323,7 +335,7 @@ get_special_candidate_index(int nth, struct seg_ent *seg)
   return NTH_UNCONVERTED_CANDIDATE;
 }
 
-/** (API) ʸμ */
+/** (API) 文節の取得 */
 int
 anthy_get_segment(struct anthy_context *ac, int nth_seg,
 		  int nth_cand, char *buf, int buflen)
@@ -332,13 +344,13 @@ anthy_get_segment(struct anthy_context *ac, int nth_seg,
   char *p;
   int len;
 
-  /* ʸФ */
+  /* 文節を取り出す */
   if (nth_seg < 0 || nth_seg >= ac->seg_list.nr_segments) {
     return -1;
   }
   seg = anthy_get_nth_segment(&ac->seg_list, nth_seg);
 
-  /* ʸᤫФ */
+  /* 文節から候補を取り出す */
   p = NULL;
   if (nth_cand < 0) {
     nth_cand = get_special_candidate_index(nth_cand, seg);
@@ -348,7 +360,7 @@ anthy_get_segment(struct anthy_context *ac, int nth_seg,
     p = anthy_xstr_to_cstr(xs, ac->encoding);
     anthy_free_xstr(xs);
   } else if (nth_cand == NTH_UNCONVERTED_CANDIDATE) {
-    /* Ѵʸ */
+    /* 変換前の文字列を取得する */
     p = anthy_xstr_to_cstr(&seg->str, ac->encoding);
   } else if (nth_cand >= 0 && nth_cand < seg->nr_cands) {
     p = anthy_xstr_to_cstr(&seg->cands[nth_cand]->str, ac->encoding);
@@ -357,14 +369,14 @@ anthy_get_segment(struct anthy_context *ac, int nth_seg,
     return -1;
   }
 
-  /* Хåե˽񤭹 */
+  /* バッファに書き込む */
   len = strlen(p);
   if (!buf) {
     free(p);
     return len;
   }
   if (len + 1 > buflen) {
-    /* Хåե­ޤ */
+    /* バッファが足りません */
     free(p);
     return -1;
   }
@@ -373,7 +385,7 @@ anthy_get_segment(struct anthy_context *ac, int nth_seg,
   return len;
 }
 
-/* ٤Ƥʸ᤬ߥåȤ줿check */
+/* すべての文節がコミットされたかcheckする */
 static int
 commit_all_segment_p(struct anthy_context *ac)
 {
@@ -388,7 +400,7 @@ commit_all_segment_p(struct anthy_context *ac)
   return 1;
 }
 
-/** (API) ʸγ */
+/** (API) 文節の確定 */
 int
 anthy_commit_segment(struct anthy_context *ac, int s, int c)
 {
@@ -400,7 +412,7 @@ anthy_commit_segment(struct anthy_context *ac, int s, int c)
     return -1;
   }
   if (commit_all_segment_p(ac)) {
-    /* ǤƤΥȤߥåȤƤ */
+    /* すでに全てのセグメントがコミットされている */
     return -1;
   }
 
@@ -411,7 +423,7 @@ anthy_commit_segment(struct anthy_context *ac, int s, int c)
   }
   if (c == NTH_UNCONVERTED_CANDIDATE) {
     /*
-     * Ѵʸ󤬥ߥåȤ줿Τǡбֹõ
+     * 変換前の文字列がコミットされたので，それに対応する候補の番号を探す
      */
     int i;
     for (i = 0; i < seg->nr_cands; i++) {
@@ -426,7 +438,7 @@ anthy_commit_segment(struct anthy_context *ac, int s, int c)
   seg->committed = c;
 
   if (commit_all_segment_p(ac)) {
-    /* ٤ƤΥȤߥåȤ줿 */
+    /* 今、すべてのセグメントがコミットされた */
     anthy_proc_commit(&ac->seg_list, &ac->split_info);
     /**/
     anthy_save_history(history_file, ac);
@@ -434,7 +446,7 @@ anthy_commit_segment(struct anthy_context *ac, int s, int c)
   return 0;
 }
 
-/** (API) ͽ¬Ƥۤʸ */
+/** (API) 予測してほしい文字列の設定 */
 int
 anthy_set_prediction_string(struct anthy_context *ac, const char* s)
 {
@@ -442,7 +454,7 @@ anthy_set_prediction_string(struct anthy_context *ac, const char* s)
   xstr *xs;
 
   anthy_dic_activate_session(ac->dic_session);
-  /* ͽ¬򳫻Ϥ˸Ŀͼreload */
+  /* 予測を開始する前に個人辞書をreloadする */
   anthy_reload_record();
 
 
@@ -455,7 +467,7 @@ anthy_set_prediction_string(struct anthy_context *ac, const char* s)
   return retval;
 }
 
-/** (API) ͽ¬Ѵξ֤μ */
+/** (API) 予測変換の状態の取得 */
 int 
 anthy_get_prediction_stat(struct anthy_context *ac, struct anthy_prediction_stat * ps)
 {
@@ -463,7 +475,7 @@ anthy_get_prediction_stat(struct anthy_context *ac, struct anthy_prediction_stat
   return 0;
 }
 
-/** (API) ͽ¬Ѵθμ */
+/** (API) 予測変換の候補の取得 */
 int
 anthy_get_prediction(struct anthy_context *ac, int nth, char* buf, int buflen)
 {
@@ -478,7 +490,7 @@ anthy_get_prediction(struct anthy_context *ac, int nth, char* buf, int buflen)
 
   p = anthy_xstr_to_cstr(prediction->predictions[nth].str, ac->encoding);
 
-  /* Хåե˽񤭹 */
+  /* バッファに書き込む */
   len = strlen(p);
   if (!buf) {
     free(p);
@@ -494,7 +506,7 @@ anthy_get_prediction(struct anthy_context *ac, int nth, char* buf, int buflen)
   }
 }
 
-/** (API) ͽ¬η̤ꤹ
+/** (API) 予測の結果を確定する
  */
 int
 anthy_commit_prediction(struct anthy_context *ac, int nth)
@@ -508,15 +520,15 @@ anthy_commit_prediction(struct anthy_context *ac, int nth)
   return 0;
 }
 
-/** (API) ȯ */
+/** (API) 開発用 */
 void
 anthy_print_context(struct anthy_context *ac)
 {
   anthy_do_print_context(ac, default_encoding);
 }
 
-/** (API) Anthy 饤֥ΥСɽʸ֤
- * ͭ饤֥ǤϳѿΥݡȤϹޤʤΤǴؿˤƤ
+/** (API) Anthy ライブラリのバージョンを表す文字列を返す
+ * 共有ライブラリでは外部変数のエクスポートは好ましくないので関数にしてある
  */
 const char *
 anthy_get_version_string (void)
@@ -9,36 +9,36 @@
 #include <anthy/prediction.h>
 
 /* 
-   ͽ¬ѴθΥå
+   予測変換の候補のキャッシュ
  */
 struct prediction_cache {
-  /* ͽ¬ʸ */
+  /* 予測元の文字列 */
   xstr str;
-  /* ͽ¬줿ο */
+  /* 予測された候補の数 */
   int nr_prediction;
-  /* ͽ¬줿 */
+  /* 予測された候補 */
   struct prediction_t* predictions;
 };
 
-/** AnthyѴƥ
- * ѴʸʤɤäƤ
+/** Anthyの変換コンテキスト
+ * 変換中の文字列などが入っている
  */
 struct anthy_context {
-  /** ƥȤλʸ */
+  /** コンテキストの持つ文字列 */
   xstr str;
-  /** ʸΥꥹ */
+  /** 文節のリスト */
   struct segment_list seg_list;
-  /** 񥻥å */
+  /** 辞書セッション */
   dic_session_t dic_session;
-  /** splitterξ */
+  /** splitterの情報 */
   struct splitter_context split_info;
-  /** ¤ؤ */
+  /** 候補の並び替え情報 */
   struct ordering_context_wrapper ordering_info;
-  /** ͽ¬ */
+  /** 予測候補 */
   struct prediction_cache prediction;
-  /** 󥳡ǥ */
+  /** エンコーディング */
   int encoding;
-  /** ѴΥ⡼ */
+  /** 再変換のモード */
   int reconversion_mode;
 };
 
@@ -46,11 +46,13 @@ struct anthy_context {
 /* context.c */
 void anthy_init_contexts(void);
 void anthy_quit_contexts(void);
+void anthy_rebind_pooled_contexts(void);
 void anthy_init_personality(void);
 void anthy_quit_personality(void);
 int anthy_do_set_personality(const char *id);
 struct anthy_context *anthy_do_create_context(int);
 int anthy_do_context_set_str(struct anthy_context *c, xstr *x, int is_reverse);
+int anthy_do_context_set_reconvert_str(struct anthy_context *c, xstr *x);
 void anthy_do_reset_context(struct anthy_context *c);
 void anthy_do_release_context(struct anthy_context *c);
 
@@ -65,4 +67,4 @@ void anthy_do_print_context(struct anthy_context *c, int encoding);
 
 
 #endif
-/* ʤ٤ؤեåȤˤ */
+/* なるべく階層をフラットにするよろし */
@@ -1,14 +1,15 @@
 /*
- * Ф
+ * 候補の履歴を覚える
  *
  *
- * ɤߤ A B A A A
- * ǤäȤ褦ʾȤ˸Υ롣
+ * ある読みの履歴が 候補A 候補B 候補A 候補A 候補A
+ * であったというような情報をもとに候補のスコアを加点する。
  *
  * Copyright (C) 2006-2007 TABATA Yusuke
  *
  */
 #include <stdlib.h>
+#include <string.h>
 
 #include <anthy/segment.h>
 #include <anthy/record.h>
@@ -16,8 +17,17 @@
 
 #define HISTORY_DEPTH 8
 #define MAX_HISTORY_ENTRY 500
+/* HISTORY_DEPTHの倍以上の2の冪 */
+#define WEIGHT_TAB_SIZE 16
 
-/** ʸΥߥåȤɲä */
+/* 履歴中の文字列ごとの重み */
+struct history_weight {
+  xstr *xs;
+  int hash;
+  int weight;
+};
+
+/** 文節のコミットを履歴に追加する */
 static void
 learn_cand_history(struct seg_ent *seg)
 {
@@ -29,7 +39,7 @@ learn_cand_history(struct seg_ent *seg)
   if (anthy_select_row(&seg->str, 1)) {
     return ;
   }
-  /* եȤ */
+  /* シフトする */
   nr = anthy_get_nr_values();
   nr ++;
   if (nr > HISTORY_DEPTH) {
@@ -39,7 +49,7 @@ learn_cand_history(struct seg_ent *seg)
     xstr *xs = anthy_get_nth_xstr(i - 1);
     anthy_set_nth_xstr(i, xs);
   }
-  /* 0ܤ */
+  /* 0番目に設定 */
   anthy_set_nth_xstr(0, &seg->cands[seg->committed]->str);
   anthy_mark_row_used();
 }
@@ -72,8 +82,8 @@ learn_suffix_history(struct seg_ent *seg)
   }
 }
 
-/** ƤФؿ 
- * ɲä */
+/** 外から呼ばれる関数 
+ * 履歴に追加する */
 void
 anthy_learn_cand_history(struct segment_list *sl)
 {
@@ -86,7 +96,7 @@ anthy_learn_cand_history(struct segment_list *sl)
     }
     if (anthy_select_row(xs, 0)) {
       if (seg->committed == 0) {
-	/* Υȥ̵꤬ơߥåȤ줿ƬΤΤǤХѥ */
+	/* 候補のエントリが無くて、コミットされた候補も先頭のものであればパス */
 	continue;
       }
     }
@@ -105,32 +115,67 @@ anthy_learn_cand_history(struct segment_list *sl)
   }
 }
 
-/* ߤƸνŤߤ׻ */
+/*
+ * 選択中の行の履歴から、文字列をhash値で引く重みの表を作る
+ * 表に入った文字列の数を返す
+ */
 static int
-get_history_weight(xstr *xs)
+make_history_weight_tab(struct history_weight *tab)
 {
   int i, nr = anthy_get_nr_values();
-  int w = 0;
+  int nr_ent = 0;
+  memset(tab, 0, sizeof(struct history_weight) * WEIGHT_TAB_SIZE);
+  if (nr > HISTORY_DEPTH) {
+    /* 学習ではHISTORY_DEPTH個までしか記録しないので、表はあふれない */
+    nr = HISTORY_DEPTH;
+  }
   for (i = 0; i < nr; i++) {
     xstr *h = anthy_get_nth_xstr(i);
+    int hash, j;
     if (!h) {
       continue;
     }
-    if (!anthy_xstrcmp(xs, h)) {
-      w++;
-      if (i == 0) {
-	/* ľ˳ꤵ줿ΤˤϹ⤤*/
-	w += (HISTORY_DEPTH / 2);
+    hash = anthy_xstr_hash(h);
+    for (j = hash & (WEIGHT_TAB_SIZE - 1); tab[j].xs;
+	 j = (j + 1) & (WEIGHT_TAB_SIZE - 1)) {
+      if (tab[j].hash == hash && !anthy_xstrcmp(tab[j].xs, h)) {
+	break;
       }
     }
+    if (!tab[j].xs) {
+      tab[j].xs = h;
+      tab[j].hash = hash;
+      nr_ent ++;
+    }
+    tab[j].weight ++;
+    if (i == 0) {
+      /* 直前に確定されたものには高いスコア*/
+      tab[j].weight += (HISTORY_DEPTH / 2);
+    }
   }
-  return w;
+  return nr_ent;
+}
+
+/* 履歴をみて候補の重みを計算する */
+static int
+get_history_weight(struct history_weight *tab, xstr *xs)
+{
+  int hash = anthy_xstr_hash(xs);
+  int j;
+  for (j = hash & (WEIGHT_TAB_SIZE - 1); tab[j].xs;
+       j = (j + 1) & (WEIGHT_TAB_SIZE - 1)) {
+    if (tab[j].hash == hash && !anthy_xstrcmp(tab[j].xs, xs)) {
+      return tab[j].weight;
+    }
+  }
+  return 0;
 }
 
 static void
 reorder_by_candidate(struct seg_ent *se)
 {
   int i, primary_score;
+  struct history_weight tab[WEIGHT_TAB_SIZE];
   /**/
   if (anthy_select_section("CAND_HISTORY", 1)) {
     return ;
@@ -138,18 +183,20 @@ reorder_by_candidate(struct seg_ent *se)
   if (anthy_select_row(&se->str, 0)) {
     return ;
   }
-  /* Ǥɾι⤤ */
+  /* 最も評価の高い候補 */
   primary_score = se->cands[0]->score;
   /**/
-  for (i = 0; i < se->nr_cands; i++) {
-    struct cand_ent *ce = se->cands[i];
-    int weight = get_history_weight(&ce->str);
-    ce->score += primary_score / (HISTORY_DEPTH /2) * weight;
+  if (make_history_weight_tab(tab)) {
+    for (i = 0; i < se->nr_cands; i++) {
+      struct cand_ent *ce = se->cands[i];
+      int weight = get_history_weight(tab, &ce->str);
+      ce->score += primary_score / (HISTORY_DEPTH /2) * weight;
+    }
   }
   anthy_mark_row_used();
 }
 
-/* γؽŬѤ */
+/* 接尾辞の学習を適用する */
 static void
 reorder_by_suffix(struct seg_ent *se)
 {
@@ -159,10 +206,10 @@ reorder_by_suffix(struct seg_ent *se)
   if (anthy_select_section("SUFFIX_HISTORY", 0)) {
     return ;
   }
-  /* Ƹ */
+  /* 各候補 */
   for (i = 0; i < se->nr_cands; i++) {
     struct cand_ent *ce = se->cands[i];
-    /* ñ */
+    /* 候補を構成する各単語 */
     for (j = 0; j < ce->nr_words; j++) {
       struct cand_elm *elm = &ce->elm[j];
       xstr xs;
@@ -172,15 +219,15 @@ reorder_by_suffix(struct seg_ent *se)
       if (anthy_wtype_get_pos(elm->wt) != POS_SUC) {
 	continue;
       }
-      /* Ѵʸ򥭡˸ */
+      /* 変換元の文字列をキーに検索 */
       if (anthy_select_row(&elm->str, 0)) {
 	continue;
       }
-      /* Ѵʸ */
+      /* 変換後の文字列を取得 */
       if (anthy_get_nth_dic_ent_str(elm->se, &elm->str, elm->nth, &xs)) {
 	continue;
       }
-      /* ʸӤ */
+      /* 履歴中の文字列と比較する */
       if (anthy_xstrcmp(&xs, anthy_get_nth_xstr(0))) {
 	free(xs.str);
 	continue;
@@ -198,7 +245,7 @@ reorder_by_suffix(struct seg_ent *se)
   }
 }
 
-/* ǲ */
+/* 履歴で加点する */
 void
 anthy_reorder_candidates_by_history(struct seg_ent *se)
 {
@@ -1,9 +1,9 @@
 /*
- * ʸФ򥽡Ȥ롣
- * Ūˤ϶ܤʸ⸫ơñηˤɾ򤹤롣
- * ֤äκ⤹롣
+ * 文節に対する候補をソートする。
+ * 将来的には近接する文節も見て、単語の結合による評価をする。
+ * ダブった候補の削除もする。
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 9/22
+ * Funded by IPA未踏ソフトウェア創造事業 2001 9/22
  * Copyright (C) 2000-2006 TABATA Yusuke
  * Copyright (C) 2001 UGAWA Tomoharu
  *
@@ -35,24 +35,24 @@
 #include <anthy/xchar.h>
 #include "sorter.h"
 
-/* ؽˤ */
+/* お茶入れ学習による候補 */
 #define OCHAIRE_BASE OCHAIRE_SCORE
-/* metawordʬ̵ȤΡҤ餬ʥʤΥ */
+/* metawordが十分無理矢理くさいときの、ひらがなカタカナのスコア */
 #define NOCONV_WITH_BIAS 900000
-/* ̤θ */
+/* 普通の候補 */
 #define NORMAL_BASE 100
-/* ñ */
+/* 単漢字 */
 #define SINGLEWORD_BASE 10
-/* ʣ */
+/* 複合語 */
 #define COMPOUND_BASE (OCHAIRE_SCORE / 2)
-/* ʣΰʬʸˤ */
+/* 複合語の一部分を一文節にしたもの */
 #define COMPOUND_PART_BASE 2
-/* °Τ */
+/* 付属語のみ */
 #define DEPWORD_BASE (OCHAIRE_SCORE / 2)
-/* Ҥ餬ʥʤΥǥեȤΥ */
+/* ひらがなカタカナのデフォルトのスコア */
 #define NOCONV_BASE 1
 
-/* ̵äݤƤȽǤ */
+/* 無理っぽい候補割り当てか判断する */
 static int
 uncertain_segment_p(struct seg_ent *se)
 {
@@ -63,7 +63,7 @@ uncertain_segment_p(struct seg_ent *se)
 
   mw = se->mw_array[0];
 
-  /* Ĺ6 */
+  /* 長さの6割 */
   if (se->len * 3 >= mw->len * 5) {
     return 1;
   }
@@ -74,9 +74,9 @@ static void
 release_redundant_candidate(struct seg_ent *se)
 {
   int i, j;
-  /* ϥȤƤΤscore0θ䤬¤Ǥ */
+  /* 配列はソートされているのでscoreが0の候補が後ろに並んでいる */
   for (i = 0; i < se->nr_cands && se->cands[i]->score; i++);
-  /* iθ */
+  /* iから後ろの候補を解放 */
   if (i < se->nr_cands) {
     for (j = i; j < se->nr_cands; j++) {
       anthy_release_cand_ent(se->cands[j]);
@@ -85,7 +85,7 @@ release_redundant_candidate(struct seg_ent *se)
   }
 }
 
-/* qsortѤθӴؿ */
+/* qsort用の候補比較関数 */
 static int
 candidate_compare_func(const void *p1, const void *p2)
 {
@@ -137,7 +137,7 @@ fixup_parenthesis_order(struct segment_list *sl, int nth)
 	if (target_seg->cands[k]->str.str[0] == xc) {
 	  if (target_seg->cands[k]->score <
 	      seg->cands[0]->score) {
-	    /* θΥͿ */
+	    /* 元の候補のスコアを与える */
 	    target_seg->cands[k]->score = seg->cands[0]->score;
 	  }
 	  target_seg->cands[k]->score += 100;
@@ -156,42 +156,62 @@ trim_kana_candidate(struct seg_ent *se)
   }
   for (i = 1; i < se->nr_cands; i++) {
     if (se->cands[i]->flag & CEF_KATAKANA) {
-      /* ޤǲ */
+      /* 最低点まで下げる */
       se->cands[i]->score = NOCONV_BASE;
     }
   }
 }
 
+/*
+ * 同じ文字列の候補のうち先頭のもの以外に0点を付ける
+ * 候補の文字列のハッシュ表で先頭のものを探す
+ */
 static void
 check_dupl_candidate(struct seg_ent *se)
 {
-  int i,j;
-  for (i = 0; i < se->nr_cands - 1; i++) {
-    for (j = i + 1; j < se->nr_cands; j++) {
-      if (!anthy_xstrcmp(&se->cands[i]->str, &se->cands[j]->str)) {
-	/* 롼ɤޥåΤ֤Ȥ٤ */
-	se->cands[j]->score = 0;
-	se->cands[i]->flag |= se->cands[j]->flag;
+  int i, size;
+  int *tab;
+
+  for (size = 16; size < se->nr_cands * 2; size *= 2);
+  tab = malloc(sizeof(int) * size);
+  for (i = 0; i < size; i++) {
+    tab[i] = -1;
+  }
+  for (i = 0; i < se->nr_cands; i++) {
+    struct cand_ent *ce = se->cands[i];
+    int h = anthy_xstr_hash(&ce->str) & (size - 1);
+    for (; tab[h] >= 0; h = (h + 1) & (size - 1)) {
+      struct cand_ent *first = se->cands[tab[h]];
+      if (!anthy_xstrcmp(&first->str, &ce->str)) {
+	/* ルールに良くマッチしたものの方を選ぶとかすべき */
+	ce->score = 0;
+	first->dupl_flag |= ce->flag & ~first->flag;
+	first->flag |= ce->flag;
+	break;
       }
     }
+    if (tab[h] < 0) {
+      tab[h] = i;
+    }
   }
+  free(tab);
 }
 
-/* ʻƤˤä줿ɾ */
+/* 品詞割り当てによって生成された候補を評価する */
 static void
 eval_candidate_by_metaword(struct cand_ent *ce)
 {
   int i;
   int score = 1;
 
-  /* ޤñ٤ˤscoreû */
+  /* まず、単語の頻度によるscoreを加算 */
   for (i = 0; i < ce->nr_words; i++) {
     struct cand_elm *elm = &ce->elm[i];
     int pos, div = 1;
     int freq;
 
     if (elm->nth < 0) {
-      /* ƤоݳʤΤǥå */
+      /* 候補割り当ての対象外なのでスキップ */
       continue;
     }
     pos = anthy_wtype_get_pos(elm->wt);
@@ -210,38 +230,40 @@ eval_candidate_by_metaword(struct cand_ent *ce)
   ce->score = score;
 }
 
-/* ɾ */
+/* 候補を評価する */
 static void
 eval_candidate(struct cand_ent *ce, int uncertain)
 {
-  if ((ce->flag &
+  /* 重複した候補から引き継いだフラグは評価に使わない */
+  unsigned int flag = ce->flag & ~ce->dupl_flag;
+  if ((flag &
        (CEF_OCHAIRE | CEF_SINGLEWORD | CEF_HIRAGANA |
 	CEF_KATAKANA | CEF_GUESS | CEF_COMPOUND | CEF_COMPOUND_PART |
 	CEF_BEST)) == 0) {
-    /* splitterξ(metaword)ˤä줿 */
+    /* splitterからの情報(metaword)によって生成された候補 */
     eval_candidate_by_metaword(ce);
-  } else if (ce->flag & CEF_OCHAIRE) {
+  } else if (flag & CEF_OCHAIRE) {
     ce->score = OCHAIRE_BASE;
-  } else if (ce->flag & CEF_SINGLEWORD) {
+  } else if (flag & CEF_SINGLEWORD) {
     ce->score = SINGLEWORD_BASE;
-  } else if (ce->flag & CEF_COMPOUND) {
+  } else if (flag & CEF_COMPOUND) {
     ce->score = COMPOUND_BASE;
-  } else if (ce->flag & CEF_COMPOUND_PART) {
+  } else if (flag & CEF_COMPOUND_PART) {
     ce->score = COMPOUND_PART_BASE;
-  } else if (ce->flag & CEF_BEST) {
+  } else if (flag & CEF_BEST) {
     ce->score = OCHAIRE_BASE;
-  } else if (ce->flag & (CEF_HIRAGANA | CEF_KATAKANA |
-			 CEF_GUESS)) {
+  } else if (flag & (CEF_HIRAGANA | CEF_KATAKANA |
+		    CEF_GUESS)) {
     if (uncertain) {
       /*
-       * ʸϳʤɤΤ褦ʤΤǡ
-       * Ҥ餬ʥʤθФ褤
+       * この文節は外来語などのようなので、生成した候補よりも
+       * ひらがなカタカナの候補を出した方がよい
        */
       ce->score = NOCONV_WITH_BIAS;
-      if (CEF_KATAKANA & ce->flag) {
+      if (CEF_KATAKANA & flag) {
 	ce->score ++;
       }
-      if (CEF_GUESS & ce->flag) {
+      if (CEF_GUESS & flag) {
 	ce->score += 2;
       }
     } else {
@@ -251,40 +273,69 @@ eval_candidate(struct cand_ent *ce, int uncertain)
   ce->score += 1;
 }
 
+static int
+candidate_order_compare_func(const void *p1, const void *p2)
+{
+  const struct cand_ent *const *c1 = p1, *const *c2 = p2;
+  return (*c1)->gen_order - (*c2)->gen_order;
+}
+
+/*
+ * 文節の伸縮で作り直さなかった文節は前回並べ替えた状態になっているので、
+ * 生成された順番に戻して並べ替えで付けたフラグを落とす
+ */
+static void
+restore_segment(struct seg_ent *se)
+{
+  int i;
+  for (i = 0; i < se->nr_cands; i++) {
+    se->cands[i]->flag &= ~(CEF_USEDICT | CEF_CONTEXT);
+  }
+  for (i = 1; i < se->nr_cands; i++) {
+    if (se->cands[i - 1]->gen_order > se->cands[i]->gen_order) {
+      qsort(se->cands, se->nr_cands,
+	    sizeof(struct cand_ent *),
+	    candidate_order_compare_func);
+      return ;
+    }
+  }
+}
+
 static void
 eval_segment(struct seg_ent *se)
 {
   int i;
   int uncertain = uncertain_segment_p(se);
+  restore_segment(se);
   for (i = 0; i < se->nr_cands; i++) {
     eval_candidate(se->cands[i], uncertain);
   }
 }
 
-/* ؽƤǽ̤Ĵ */
+/* 学習履歴の内容で順位を調整する */
 static void
 apply_learning(struct segment_list *sl, int nth)
 {
   int i;
 
   /*
-   * ̤ͥ㤤ΤŬѤ
+   * 優先順位の低いものから順に適用する
    */
 
-  /* 㼭ˤѹ */
+  /* 用例辞書による順序の変更 */
   anthy_reorder_candidates_by_relation(sl, nth);
-  /* θ */
+  /* 候補の交換 */
   for (i = nth; i < sl->nr_segments; i++) {
     struct seg_ent *seg = anthy_get_nth_segment(sl, i);
-    /* θ */
+    /* 候補の交換 */
     anthy_proc_swap_candidate(seg);
-    /* ˤѹ */
+    /* 履歴による順序の変更 */
     anthy_reorder_candidates_by_history(anthy_get_nth_segment(sl, i));
   }
 }
 
-/** ƤФ륨ȥݥ
- * @nthʹߤʸоݤȤ
+/** 外から呼ばれるエントリポイント
+ * @nth以降の文節を対象とする
  */
 void
 anthy_sort_candidate(struct segment_list *sl, int nth)
@@ -292,31 +343,31 @@ anthy_sort_candidate(struct segment_list *sl, int nth)
   int i;
   for (i = nth; i < sl->nr_segments; i++) {
     struct seg_ent *seg = anthy_get_nth_segment(sl, i);
-    /* ޤɾ */
+    /* まず評価する */
     eval_segment(seg);
-    /* Ĥ˥Ȥ */
+    /* つぎにソートする */
     sort_segment(seg);
-    /* ֤äȥ㤤0դ */
+    /* ダブったエントリの点の低い方に0点を付ける */
     check_dupl_candidate(seg);
-    /* ⤦ɥȤ */
+    /* もういちどソートする */
     sort_segment(seg);
-    /* ɾ0θ */
+    /* 評価0の候補を解放 */
     release_redundant_candidate(seg);
   }
 
-  /* ؽŬѤ */
+  /* 学習の履歴を適用する */
   apply_learning(sl, nth);
-  /* ޤȤ */
+  /* またソートする */
   sort_all_segments(sl, nth);
 
-  /* åĤȳбդ */
+  /* カッコ閉じと開きの対応を付ける */
   fixup_parenthesis_order(sl, nth);
   sort_all_segments(sl, nth);
 
-  /* ʤθ䤬ƬǤʤкǸ˲ */
+  /* カタカナの候補が先頭でなければ最後に回す */
   for (i = nth; i < sl->nr_segments; i++) {
     trim_kana_candidate(anthy_get_nth_segment(sl, i));
   }
-  /* ޤȤ */
+  /* またソートする */
   sort_all_segments(sl, nth);
 }
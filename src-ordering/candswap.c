@@ -1,12 +1,12 @@
 /*
- * θ򴹤Υҥȥ롣
+ * 候補の交換のヒストリを管理する。
  *
- * anthy_swap_cand_ent() ǳؽ
- * anthy_proc_swap_candidate() ǳؽ̤Ѥ
+ * anthy_swap_cand_ent() で学習する
+ * anthy_proc_swap_candidate() で学習結果を用いる
  *
- *  üפȤȥåפ˽ФơȪפǳꤵ줿
- *  Ω:ü->Ȫ
- *    ĤΥȥɲä
+ *  「田端が」という候補をトップに出して「田畑が」で確定された場合は
+ *  自立語部:「田端」->「田畑」
+ *    の二つのエントリを追加する
  *
  */
 #include <stdlib.h>
@@ -19,7 +19,7 @@
 
 #define MAX_INDEP_PAIR_ENTRY 500
 
-/* μΩؽ */
+/* 候補の自立語部を学習する */
 static void
 learn_swap_cand_indep(struct cand_ent *o, struct cand_ent *n)
 {
@@ -28,7 +28,7 @@ learn_swap_cand_indep(struct cand_ent *o, struct cand_ent *n)
   int o_idx = o->core_elm_index;
   int n_idx = n->core_elm_index;
 
-  /* Ωޤʸᤷؽʤ */
+  /* 自立語部を含む文節しか学習しない */
   if (o_idx < 0 || n_idx < 0) {
     return ;
   }
@@ -59,28 +59,28 @@ learn_swap_cand_indep(struct cand_ent *o, struct cand_ent *n)
 }
 
 /*
- * o Фn ߥåȤ줿Τ
- * o -> n record˥åȤ
+ * 候補o を出したらn がコミットされたので
+ * o -> n をrecordにセットする
  */
 void
 anthy_swap_cand_ent(struct cand_ent *o, struct cand_ent *n)
 {
   if (o == n) {
-    /* Ʊ */
+    /* 同じ候補 */
     return ;
   }
   if (n->flag & CEF_USEDICT) {
-    /* 㼭񤫤ФƤ */
+    /* 用例辞書から出てきた候補 */
     return ;
   }
-  /* Ω */
+  /* 自立語部 */
   learn_swap_cand_indep(o, n);
 }
 
 
 /*
- * Ѵ¤٤֤Ǻͥθ
- * 롼פνʤɤԤ
+ * 変換時に生成した候補を並べた状態で最優先の候補を決める
+ * ループの除去なども行う
  */
 static xstr *
 prepare_swap_candidate(xstr *target)
@@ -93,10 +93,10 @@ prepare_swap_candidate(xstr *target)
   if (!xs) {
     return NULL;
   }
-  /*  -> xs ȤʤΤȯ */
+  /* 第一候補 -> xs となるのを発見 */
   anthy_mark_row_used();
   if (anthy_select_row(xs, 0) != 0){
-    /* xs ->  */
+    /* xs -> ⊥ */
     return xs;
   }
   /* xs -> n */
@@ -106,16 +106,16 @@ prepare_swap_candidate(xstr *target)
   }
 
   if (!anthy_xstrcmp(target, n)) {
-    /*  -> xs -> n  n = Υ롼 */
+    /* 第一候補 -> xs -> n で n = 第一候補のループ */
     anthy_select_row(target, 0);
     anthy_release_row();
     anthy_select_row(xs, 0);
     anthy_release_row();
-    /*  -> xs äơ򴹤ɬפ̵ */
+    /* 第一候補 -> xs を消して、交換の必要は無し */
     return NULL;
   }
-  /*  -> xs -> n  n != ʤΤ
-   *  -> n
+  /* 第一候補 -> xs -> n で n != 第一候補なので
+   * 第一候補 -> nを設定
    */
   if (anthy_select_row(target, 0) == 0){
     anthy_set_nth_xstr(0, n);
@@ -126,7 +126,7 @@ prepare_swap_candidate(xstr *target)
 #include <src-worddic/dic_ent.h>
 
 /*
- * ΩΤ
+ * 自立語のみ
  */
 static void
 proc_swap_candidate_indep(struct seg_ent *se)
@@ -143,7 +143,7 @@ proc_swap_candidate_indep(struct seg_ent *se)
     return ;
   }
 
-  /* 0ܤθʸФ */
+  /* 0番目の候補の文字列を取り出す */
   core_elm = &se->cands[0]->elm[core_elm_idx];
   if (core_elm->nth < 0) {
     return ;
@@ -164,7 +164,7 @@ proc_swap_candidate_indep(struct seg_ent *se)
     return ;
   }
 
-  /*  -> xs ʤΤ xsθõ */
+  /* 第一候補 -> xs なので xsの候補を探す */
   for (i = 1; i < se->nr_cands; i++) {
     if (se->cands[i]->nr_words == se->cands[0]->nr_words &&
 	se->cands[i]->core_elm_index == core_elm_idx) {
@@ -176,7 +176,7 @@ proc_swap_candidate_indep(struct seg_ent *se)
       if (res == 0 &&
 	  !anthy_xstrcmp(&cand, xs)) {
 	free(cand.str);
-	/* ߤĤΤǤθΥ򥢥å */
+	/* みつけたのでその候補のスコアをアップ */
 	se->cands[i]->score = se->cands[0]->score + 1;
 	return ;
       }
@@ -186,14 +186,14 @@ proc_swap_candidate_indep(struct seg_ent *se)
 }
 
 /*
- * Ѵ¤٤֤Ǻͥθ
+ * 変換時に生成した候補を並べた状態で最優先の候補を決める
  */
 void
 anthy_proc_swap_candidate(struct seg_ent *seg)
 {
 
   if (seg->cands[0]->score >= OCHAIRE_SCORE) {
-    /* cands[0] ̤äƤ */
+    /* cands[0] は特別な点数を持っている */
     return ;
   }
   if (seg->cands[0]->flag & CEF_USEDICT) {
@@ -203,7 +203,7 @@ anthy_proc_swap_candidate(struct seg_ent *seg)
   proc_swap_candidate_indep(seg);
 }
 
-/* 򴹤θŤȥä */
+/* 候補交換の古いエントリを消す */
 void
 anthy_cand_swap_ageup(void)
 {
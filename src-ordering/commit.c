@@ -1,8 +1,8 @@
 /*
- * (ߥå)ν򤹤롣
- * ƼγؽƤӽФ
+ * 確定(コミット)後の処理をする。
+ * 各種の学習処理を呼び出す
  *
- * anthy_proc_commit() ƤФ
+ * anthy_proc_commit() が外部から呼ばれる
  */
 #include <stdlib.h>
 #include <time.h>
@@ -19,7 +19,7 @@
 
 #define MAX_UNKNOWN_WORD 500
 
-/* 򴹤줿õ */
+/* 交換された候補を探す */
 static void
 learn_swapped_candidates(struct segment_list *sl)
 {
@@ -28,7 +28,7 @@ learn_swapped_candidates(struct segment_list *sl)
   for (i = 0; i < sl->nr_segments; i++) {
     seg = anthy_get_nth_segment(sl, i);
     if (seg->committed != 0) {
-      /* ǽθ(0)Ǥʤ(seg->committed)ߥåȤ줿 */
+      /* 最初の候補(0番目)でない候補(seg->committed番目)がコミットされた */
       anthy_swap_cand_ent(seg->cands[0],
 			  seg->cands[seg->committed]);
     }
@@ -36,7 +36,7 @@ learn_swapped_candidates(struct segment_list *sl)
   anthy_cand_swap_ageup();
 }
 
-/* ĹѤäʸѹФ */
+/* 長さが変わった文節の変更後に対して */
 static void
 learn_resized_segment(struct splitter_context *sc,
 		      struct segment_list *sl)
@@ -48,7 +48,7 @@ learn_resized_segment(struct splitter_context *sc,
   int *len_array
     = alloca(sizeof(int) * sl->nr_segments);
 
-  /* ʸĹmeta_wordѰդ */
+  /* 各文節の長さの配列とmeta_wordの配列を用意する */
   for (i = 0; i < sl->nr_segments; i++) {
     struct seg_ent *se = anthy_get_nth_segment(sl, i);
     mw[i] = se->cands[se->committed]->mw;
@@ -58,7 +58,7 @@ learn_resized_segment(struct splitter_context *sc,
   anthy_commit_border(sc, sl->nr_segments, mw, len_array);
 }
 
-/* ĹѤäʸѹФ */
+/* 長さが変わった文節の変更前に対して */
 static void
 clear_resized_segment(struct splitter_context *sc,
 		      struct segment_list *sl)
@@ -69,7 +69,7 @@ clear_resized_segment(struct splitter_context *sc,
   for (i = 0; i < sc->char_count; i++) {
     mark[i] = 0;
   }
-  /* ºݤ˳ꤵ줿ʸĹޡ */
+  /* 実際に確定された文節の長さをマークする */
   from = 0;
   for (i = 0; i < sl->nr_segments; i++) {
     seg = anthy_get_nth_segment(sl, i);
@@ -78,8 +78,8 @@ clear_resized_segment(struct splitter_context *sc,
   }
   for (i = 0; i < sc->char_count; i++) {
     int len = sc->ce[i].initial_seg_len;
-    /* ǽĹȳꤵ줿ĹۤʤС
-       Ȥʤä̤θβǽ */
+    /* 最初の長さと確定された長さが異なれば、
+       使われなかった未知語の可能性がある */
     if (len && len != mark[i]) {
       xstr xs;
       xs.str = sc->ce[i].c;
@@ -92,7 +92,7 @@ clear_resized_segment(struct splitter_context *sc,
   }
 }
 
-/* recordˤؽη̤񤭹 */
+/* recordにお茶入れ学習の結果を書き込む */
 static void
 commit_ochaire(struct seg_ent *seg, int count, xstr* xs)
 {
@@ -111,8 +111,8 @@ commit_ochaire(struct seg_ent *seg, int count, xstr* xs)
   anthy_truncate_row(i * 2 + 1);
 }
 
-/* recordΰ󤹤뤿ˡؽΥͥƥ֤
-   ȥä(̷⤷ʤΤϻĤΤݤʤΤä) */
+/* recordの領域を節約するために、お茶入れ学習のネガティブな
+   エントリを消す(矛盾しないものは残すのは面倒なので全部消す) */
 static void
 release_negative_ochaire(struct splitter_context *sc,
 			 struct segment_list *sl)
@@ -120,11 +120,11 @@ release_negative_ochaire(struct splitter_context *sc,
   int start, len;
   xstr xs;
   (void)sl;
-  /* ѴΤҤ餬ʸ */
+  /* 変換前のひらがな文字列 */
   xs.len = sc->char_count;
   xs.str = sc->ce[0].c;
 
-  /* xsʬʸФ */
+  /* xsの部分文字列に対して */
   for (start = 0; start < xs.len; start ++) {
     for (len = 1; len <= xs.len - start && len < MAX_OCHAIRE_LEN; len ++) {
       xstr part;
@@ -148,12 +148,12 @@ learn_ochaire_partial(struct splitter_context *sc,
     return ;
   }
 
-  /* ؽΥͥƥ֤ʥȥä */
+  /* お茶入れ学習のネガティブなエントリを消す */
   release_negative_ochaire(sc, sl);
 
-  /* ؽ򤹤 */
+  /* お茶入れ学習をする */
   for (count = 2; count <= sl->nr_segments && count < 5; count++) {
-    /* 2ʸʾĹʸФ */
+    /* 2文節以上の長さの文節列に対して */
 
     for (i = 0; i <= sl->nr_segments - count; i++) {
       struct seg_ent *head = anthy_get_nth_segment(sl, i);
@@ -162,11 +162,11 @@ learn_ochaire_partial(struct splitter_context *sc,
       int j;
       xs = head->str;
       if (xs.len < 2 && count < 3) {
-	/* ڤʸؽ뤳Ȥ򤱤롢
-	 * øheuristics */
+	/* 細切れの文節を学習することを避ける、
+	 * いい加減なheuristics */
 	continue;
       }
-      /* ʸʸ */
+      /* 文節列を構成する文字列を作る */
       for (j = 1, s = head->next; j < count; j++, s = s->next) {
 	xs.len += s->str.len;
       }
@@ -212,7 +212,7 @@ learn_prediction_str(xstr *idx, xstr *xs)
   }
   nr_predictions = anthy_get_nr_values();
 
-  /* ˤϥॹפ */
+  /* 既に履歴にある場合はタイムスタンプだけ更新 */
   for (i = 0; i < nr_predictions; i += 2) {
     xstr *log = anthy_get_nth_xstr(i + 1);
     if (!log) {
@@ -224,7 +224,7 @@ learn_prediction_str(xstr *idx, xstr *xs)
     }
   }
 
-  /* ʤɲ */
+  /* ない場合は末尾に追加 */
   if (i == nr_predictions) {
     anthy_set_nth_value(nr_predictions, t);
     anthy_set_nth_xstr(nr_predictions + 1, xs);      
@@ -285,15 +285,19 @@ void
 anthy_proc_commit(struct segment_list *sl,
 		  struct splitter_context *sc)
 {
-  /* ƼγؽԤ */
+  /* 学習による更新は最後にまとめて書き出す */
+  anthy_begin_record_batch();
+  /* 各種の学習を行う */
   learn_swapped_candidates(sl);
   learn_resized_segment(sc, sl);
   clear_resized_segment(sc, sl);
-  /* ʬʸФ */
+  /* 部分文節列に対して */
   learn_ochaire_partial(sc, sl);
-  /* ϤФ */
+  /* 全入力に対して */
   learn_ochaire_full(sc, sl);
   learn_prediction(sl);
   learn_unknown(sl);
   anthy_learn_cand_history(sl);
+  /* 変換中に参照した履歴のLRUの更新と共に書き出す */
+  anthy_sync_record();
 }
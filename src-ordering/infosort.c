@@ -1,7 +1,7 @@
 /*
- * ʸι¤metaword򥽡Ȥ
+ * 文節の構造metawordをソートする
  *
- * ʸФʣι¤θ򥽡Ȥ
+ * 文節に対する複数の構造の候補をソートする
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  *
@@ -36,13 +36,8 @@ static void *cand_info_array;
 static double
 calc_probability(struct feature_list *fl)
 {
-  struct feature_freq *res, arg;
-  res = anthy_find_feature_freq(cand_info_array,
-				fl, &arg);
-  if (res) {
-    double pos = (double)res->f[15];
-    double neg = (double)res->f[14];
-    double prob = pos / (pos + neg);
+  double prob;
+  if (anthy_find_feature_prob(cand_info_array, fl, &prob)) {
     prob = prob * prob;
     /**/
     return prob;
@@ -64,7 +59,7 @@ mw_eval(struct seg_ent *prev_seg, struct seg_ent *seg,
   anthy_feature_list_set_dep_word(&fl, mw->dep_word_hash);
   anthy_feature_list_set_dep_class(&fl, mw->dep_class);
   anthy_feature_list_set_mw_features(&fl, mw->mw_features);
-  /* ʸ */
+  /* 前の文節の素性 */
   if (prev_seg) {
     pc = prev_seg->best_seg_class;
   } else {
@@ -72,7 +67,7 @@ mw_eval(struct seg_ent *prev_seg, struct seg_ent *seg,
   }
   anthy_feature_list_set_class_trans(&fl, pc, mw->seg_class);
   anthy_feature_list_sort(&fl);
-  /* ׻ */
+  /* 計算する */
   prob = 0.1 + calc_probability(&fl);
   if (prob < 0) {
     prob = (double)1 / (double)1000;
@@ -1,5 +1,5 @@
 /*
- * ʸδط
+ * 文節の関係を処理する
  * Copyright (C) 2006 Higashiyama Masahiko (thanks google summer of code program)
  * Copyright (C) 2002-2007 TABATA Yusuke
  *
@@ -24,6 +24,7 @@
 
 #include <arpa/inet.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <anthy/segclass.h>
 #include <anthy/segment.h>
@@ -39,7 +40,7 @@
 #define MAX_NEIGHBOR 10
 
 
-/* ʸѤΥѥ */
+/* 全文検索用のコーパス */
 static struct corpus_ {
   /* header */
   void *corpus_bucket;
@@ -52,12 +53,12 @@ static struct corpus_ {
   int array_size;
 } corpus_info;
 
-/* Ѥiterator */
+/* 検索用のiterator */
 struct iterator {
-  /* Υȸߤξ */
+  /* 検索のキーと現在の場所 */
   int key;
   int idx;
-  /* ξ */
+  /* 検索回数の上限 */
   int limit;
 };
 
@@ -66,8 +67,32 @@ struct neighbor {
   int id[MAX_NEIGHBOR];
 };
 
-/** ʸ@seg@from_word_idñȶطˤ
- *  䤬뤫ɤõХ夲롣
+/* 例文中の一つの出現場所の周辺の単語(左右に2つずつ、idの昇順) */
+#define MAX_SAMPLE_NEIGHBOR 4
+struct corpus_sample {
+  int nr;
+  int id[MAX_SAMPLE_NEIGHBOR];
+};
+
+/* 単語のidから周辺の単語の組の列を引くための索引
+ * 初期化時にコーパスの各単語の出現場所(SEARCH_LIMIT個まで)を辿って作る
+ */
+static struct context_index {
+  /* open addressingのハッシュ、sizeは2の冪 */
+  int size;
+  struct context_key {
+    int key;
+    /* samples中の位置と数、nrが0なら空き */
+    int first;
+    int nr;
+  } *keys;
+  int nr_samples;
+  int max_samples;
+  struct corpus_sample *samples;
+} context_index;
+
+/** 文節@segの中に@from_word_idの単語と共起関係にある
+ *  候補があるかどうかを探し、あればスコアを上げる。
  */
 static void
 reorder_candidate(int from_word_id, struct seg_ent *seg)
@@ -77,7 +102,7 @@ reorder_candidate(int from_word_id, struct seg_ent *seg)
   if (ce->core_elm_index == -1) {
     return ;
   }
-  /* 0ܤθʻ */
+  /* 0番目の候補の品詞 */
   pos = anthy_wtype_get_pos(ce->elm[ce->core_elm_index].wt);
 
   for (i = 0; i < seg->nr_cands; i++) {
@@ -89,7 +114,7 @@ reorder_candidate(int from_word_id, struct seg_ent *seg)
     word_id = ce->elm[ce->core_elm_index].id;
     if (anthy_dic_check_word_relation(from_word_id, word_id) &&
 	anthy_wtype_get_pos(ce->elm[ce->core_elm_index].wt) == pos) {
-      /* ˥ޥåΤǡΥ򹹿 */
+      /* 用例にマッチしたので、候補のスコアを更新 */
       ce->flag |= CEF_USEDICT;
       ce->score *= 10;
     }
@@ -101,17 +126,18 @@ get_indep_word_id(struct seg_ent *seg, int nth)
 {
   struct cand_ent *ce;
   if (seg->cands[nth]->core_elm_index == -1) {
-    /* ܤθ䤬seq_ent줿ǤϤʤ */
+    /* 一番目の候補がseq_entから作られた候補ではない */
     return -1;
   }
   ce = seg->cands[nth];
-  /* ΩidФ */
+  /* 自立語のidを取り出す */
   return ce->elm[ce->core_elm_index].id;
 }
 
-/* 㼭Ȥä¤ؤ򤹤 */
+/* 用例辞書を使って並び替えをする
+ * from番目より前の文節は並べ直さないので変更しない */
 static void
-reorder_by_use_dict(struct segment_list *sl, int nth)
+reorder_by_use_dict(struct segment_list *sl, int nth, int from)
 {
   int i;
   struct seg_ent *cur_seg;
@@ -123,13 +149,13 @@ reorder_by_use_dict(struct segment_list *sl, int nth)
     /**/
     return ;
   }
-  /* ʸ˸Ƥ */
+  /* 近所の文節を順に見ていく */
   for (i = nth - 2; i < nth + 2 && i < sl->nr_segments; i++) {
     struct seg_ent *target_seg;
-    if (i < 0 || i == nth) {
+    if (i < from || i == nth) {
       continue ;
     }
-    /* iܤʸjܤʸФ */
+    /* i番目の文節と前後のj番目の文節に対して */
     target_seg = anthy_get_nth_segment(sl, i);
     reorder_candidate(word_id, target_seg);
   }
@@ -203,7 +229,7 @@ collect_word_context(struct neighbor *ctx, int idx)
   push_id(ctx, id);
 }
 
-/* ʸǼդξ */
+/* 例文中で周辺の情報を取得する */
 static void
 collect_corpus_context(struct neighbor *ctx,
 		       struct iterator *it)
@@ -214,7 +240,7 @@ collect_corpus_context(struct neighbor *ctx,
   this_idx = find_border_of_this_word(it->idx);
 
   /*printf(" key=%d\n", it->key);*/
-  /* إ */
+  /* 左へスキャン */
   idx = this_idx;
   for (i = 0; i < 2; i++) {
     idx = find_left_word_border(idx);
@@ -223,7 +249,7 @@ collect_corpus_context(struct neighbor *ctx,
     }
     collect_word_context(ctx, idx);
   }
-  /* إ */
+  /* 右へスキャン */
   idx = this_idx;
   for (i = 0; i < 2; i++) {
     idx = find_right_word_border(idx);
@@ -234,7 +260,7 @@ collect_corpus_context(struct neighbor *ctx,
   }
 }
 
-/* Ѵоݤʸμդξ */
+/* 変換対象の文字列の周辺の情報を取得する */
 static void
 collect_user_context(struct neighbor *ctx,
 		     struct segment_list *sl, int nth)
@@ -255,47 +281,57 @@ collect_user_context(struct neighbor *ctx,
   }
 }
 
-/* ʸξӤ */
-static int 
-do_compare_context(struct neighbor *n1,
-		   struct neighbor *n2)
+static int
+compare_int(const void *p1, const void *p2)
 {
-  int i, j;
+  return *(const int *)p1 - *(const int *)p2;
+}
+
+/* 隣接文節の情報を比較する
+ * 両方ともidの昇順に並んでいるので、一致する組の数を一度の走査で数える
+ */
+static int
+do_compare_context(const struct neighbor *user,
+		   const struct corpus_sample *sample)
+{
+  int i = 0, j = 0;
   int m = 0;
-  for (i = 0; i < n1->nr; i++) {
-    for (j = 0; j < n2->nr; j++) {
-      if (n1->id[i] == n2->id[j]) {
-	m++;
+  while (i < user->nr && j < sample->nr) {
+    if (user->id[i] < sample->id[j]) {
+      i++;
+    } else if (user->id[i] > sample->id[j]) {
+      j++;
+    } else {
+      /* 同じidが続く数の積 */
+      int id = user->id[i], nu = 0, ns = 0;
+      for (; i < user->nr && user->id[i] == id; i++) {
+	nu++;
       }
+      for (; j < sample->nr && sample->id[j] == id; j++) {
+	ns++;
+      }
+      m += nu * ns;
     }
   }
   return m;
 }
 
-/* ʸξӤ */
+/* 隣接文節の情報を比較する */
 static int
-compare_context(struct neighbor *user,
-		struct iterator *it)
+compare_context(const struct neighbor *user,
+		const struct corpus_sample *sample)
 {
-  struct neighbor sample;
   int nr;
-  /**/
-  sample.nr = 0;
-  /* ʸμվ򽸤 */
-  collect_corpus_context(&sample, it);
-  if (sample.nr == 0) {
-    return 0;
-  }
-  /* Ӥ */
-  nr = do_compare_context(user, &sample);
-  if (nr >= sample.nr / 2) {
+  /* 比較する */
+  nr = do_compare_context(user, sample);
+  if (nr >= sample->nr / 2) {
     return nr;
   }
   return 0;
 }
 
-/* keyκǽνи򸫤Ĥ
- * Ĥʤä-1֤
+/* keyの最初の出現場所を見つける
+ * 見つからなかったら-1を返す
  */
 static int
 find_first_pos(int key)
@@ -310,8 +346,8 @@ find_first_pos(int key)
   return -1;
 }
 
-/* keyκǽνиiterator
- * Ĥʤä-1֤
+/* keyの最初の出現場所でiteratorを初期化する
+ * 見つからなかったら-1を返す
  */
 static int
 find_first_from_corpus(int key, struct iterator *it, int limit)
@@ -323,7 +359,7 @@ find_first_from_corpus(int key, struct iterator *it, int limit)
   return it->idx;
 }
 
-/* keyμνиiteratorꤹ
+/* keyの次の出現場所のiteratorを設定する
  */
 static int
 find_next_from_corpus(struct iterator *it)
@@ -342,25 +378,110 @@ find_next_from_corpus(struct iterator *it)
   return it->idx;
 }
 
+static struct context_key *
+find_context_key(int key, int create)
+{
+  struct context_index *ci = &context_index;
+  unsigned int h;
+  if (!ci->keys) {
+    return NULL;
+  }
+  h = ((unsigned int)key * 2654435761U) & (ci->size - 1);
+  while (ci->keys[h].nr) {
+    if (ci->keys[h].key == key) {
+      return &ci->keys[h];
+    }
+    h = (h + 1) & (ci->size - 1);
+  }
+  return create ? &ci->keys[h] : NULL;
+}
+
+/* keyの各出現場所の周辺の単語を索引に加える */
+static void
+add_context_samples(int key)
+{
+  struct context_index *ci = &context_index;
+  struct context_key *ck;
+  struct iterator it;
+  int first = ci->nr_samples;
+
+  ck = find_context_key(key, 1);
+  if (!ck || ck->nr) {
+    /* 既にある */
+    return ;
+  }
+  find_first_from_corpus(key, &it, SEARCH_LIMIT);
+  while (it.idx > -1) {
+    struct neighbor sample;
+    sample.nr = 0;
+    /* 例文中の周辺情報を集める */
+    collect_corpus_context(&sample, &it);
+    if (sample.nr > 0 && ci->nr_samples < ci->max_samples) {
+      struct corpus_sample *cs = &ci->samples[ci->nr_samples];
+      cs->nr = sample.nr;
+      memcpy(cs->id, sample.id, sizeof(int) * sample.nr);
+      qsort(cs->id, cs->nr, sizeof(int), compare_int);
+      ci->nr_samples ++;
+    }
+    find_next_from_corpus(&it);
+  }
+  if (ci->nr_samples > first) {
+    ck->key = key;
+    ck->first = first;
+    ck->nr = ci->nr_samples - first;
+  }
+}
+
+/* コーパスの全ての単語について索引を作る */
+static void
+build_context_index(void)
+{
+  struct context_index *ci = &context_index;
+  int i;
+
+  free(ci->keys);
+  free(ci->samples);
+  /* 各出現場所は一つの単語の列にしか属さない */
+  ci->max_samples = corpus_info.array_size + 1;
+  ci->samples = malloc(sizeof(struct corpus_sample) * ci->max_samples);
+  ci->nr_samples = 0;
+  for (ci->size = 1; ci->size < corpus_info.bucket_size * 2; ci->size *= 2);
+  ci->keys = calloc(ci->size, sizeof(struct context_key));
+  if (!ci->samples || !ci->keys) {
+    free(ci->samples);
+    free(ci->keys);
+    ci->samples = NULL;
+    ci->keys = NULL;
+    return ;
+  }
+  for (i = 0; i < corpus_info.bucket_size; i++) {
+    int key = ntohl(corpus_info.bucket[i * 2]) & CORPUS_KEY_MASK;
+    if (find_first_pos(key) > -1) {
+      add_context_samples(key);
+    }
+  }
+}
+
 static void
 check_candidate_context(struct seg_ent *cur_seg,
 			int i,
 			struct neighbor *user)
 {
-  struct iterator it;
+  struct context_key *ck;
   int nr = 0;
   int word_id;
+  int j;
   word_id = get_indep_word_id(cur_seg, i);
   if (word_id == -1) {
     return ;
   }
-  /* ƽи򥹥󤹤 */
-  find_first_from_corpus(word_id, &it, SEARCH_LIMIT);
-  /*printf("word_id=%d %d\n", word_id, it.idx);*/
-  while (it.idx > -1) {
-    nr += compare_context(user, &it);
-    /**/
-    find_next_from_corpus(&it);
+  /* 各出現場所の周辺の単語と比較する */
+  ck = find_context_key(word_id & CORPUS_KEY_MASK, 0);
+  if (!ck) {
+    return ;
+  }
+  for (j = 0; j < ck->nr; j++) {
+    nr += compare_context(user, &context_index.samples[ck->first + j]);
   }
   /**/
   if (nr > 0) {
@@ -368,29 +489,30 @@ check_candidate_context(struct seg_ent *cur_seg,
   }
 }
 
-/* ʸǸ¤ؤ */
+/* 全文検索で候補を並び替える */
 static void
 reorder_by_corpus(struct segment_list *sl, int nth)
 {
   struct seg_ent *cur_seg;
   struct neighbor user;
   int i;
-  /* ʸμվ򽸤 */
+  /* 文節の周辺情報を集める */
   collect_user_context(&user, sl, nth);
   if (user.nr == 0) {
     return ;
   }
+  qsort(user.id, user.nr, sizeof(int), compare_int);
   cur_seg = anthy_get_nth_segment(sl, nth);
-  /* ƸˤĤ */
+  /* 各候補について */
   for (i = 0; i < cur_seg->nr_cands; i++) {
     check_candidate_context(cur_seg, i, &user);
   }
-  /* ȥåפθ㤬С¾θϸʤ */
+  /* トップの候補に用例があれば、他の候補は見ない */
   if (cur_seg->cands[0]->flag & CEF_CONTEXT) {
     cur_seg->cands[0]->flag &= ~CEF_CONTEXT;
     return ;
   }
-  /* ˤ륹û */
+  /* 用例によるスコア加算 */
   for (i = 1; i < cur_seg->nr_cands; i++) {
     if (cur_seg->cands[i]->flag & CEF_CONTEXT) {
       cur_seg->cands[i]->score *= 2;
@@ -399,16 +521,19 @@ reorder_by_corpus(struct segment_list *sl, int nth)
 }
 
 /*
- * ѤƸ¤ؤ
- *  @nthܰʹߤʸоݤȤ
+ * 用例を用いて候補を並び替える
+ *  @nth番目以降の文節を対象とする
+ *  nth-1番目の文節の用例辞書はnth番目の文節に効くので、そこから見る
  */
 void
 anthy_reorder_candidates_by_relation(struct segment_list *sl, int nth)
 {
   int i;
-  for (i = nth; i < sl->nr_segments; i++) {
-    reorder_by_use_dict(sl, i);
-    reorder_by_corpus(sl, i);
+  for (i = (nth > 0) ? nth - 1 : 0; i < sl->nr_segments; i++) {
+    reorder_by_use_dict(sl, i, nth);
+    if (i >= nth) {
+      reorder_by_corpus(sl, i);
+    }
   }
 }
 
@@ -425,6 +550,7 @@ anthy_relation_init(void)
   corpus_info.bucket_size = ntohl(((int *)corpus_info.corpus_bucket)[1]);
   corpus_info.array = &(((int *)corpus_info.corpus_array)[16]);
   corpus_info.bucket = &(((int *)corpus_info.corpus_bucket)[16]);
+  build_context_index();
   /*
   {
     int i;
@@ -2,11 +2,11 @@
 #define _sorter_h_included_
 
 /* candswap.c */
-/* ̤ȤƽФǤϤʤ䤬ߥåȤ줿 */
+/* 一位として出した候補ではない候補がコミットされた */
 void anthy_swap_cand_ent(struct cand_ent *old_one, struct cand_ent *new_one);
 /**/
 void anthy_proc_swap_candidate(struct seg_ent *se);
-/* ߥåȻcandswapεϿaging */
+/* コミット時にcandswapの記録をagingする */
 void anthy_cand_swap_ageup(void);
 
 /**/
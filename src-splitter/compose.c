@@ -1,15 +1,15 @@
 /*
- * ʸФƸΥꥹȤ롣
- * make_candidates()contextƤФ롣
+ * 文節に対して候補のリストを生成する。
+ * make_candidates()がcontext管理部から呼ばれる。
  *
- * ϼˡǹԤ
- * (1)splitterƤʻФproc_splitter_info()
- *    
- * (2)Ҥ餬ʤΤߤȥʤΤߤθ
- * (3)ǸʸȲᤷ̵
+ * 候補の生成は次の方法で行う
+ * (1)splitterが割り当てた品詞に対してproc_splitter_info()
+ *    から候補を生成する
+ * (2)ひらがなのみとカタカナのみの候補を生成する
+ * (3)最後の文字を助詞と解釈して無理矢理候補を生成する
  */
 /*
- * Funded by IPA̤Ƨեȥ¤ 2001 9/30
+ * Funded by IPA未踏ソフトウェア創造事業 2001 9/30
  * Copyright (C) 2000-2005 TABATA Yusuke
  * Copyright (C) 2004-2005 YOSHIDA Yuichi
  * Copyright (C) 2002 UGAWA Tomoharu
@@ -51,11 +51,13 @@ alloc_cand_ent(void)
   ce->mw = NULL;
   ce->core_elm_index = -1;
   ce->dep_word_hash = 0;
+  ce->dupl_flag = 0;
+  ce->gen_order = 0;
   return ce;
 }
 
 /*
- * ʣ
+ * 候補を複製する
  */
 static struct cand_ent *
 dup_candidate(struct cand_ent *ce)
@@ -79,15 +81,16 @@ dup_candidate(struct cand_ent *ce)
   return ce_new;
 }
 
-/** ʸ˸ɲä */
+/** 文節に候補を追加する */
 static void
 push_back_candidate(struct seg_ent *seg, struct cand_ent *ce)
 {
-  /* seg_ent˸ceɲ */
+  /* seg_entに候補ceを追加 */
   seg->nr_cands++;
   seg->cands = (struct cand_ent **)
     realloc(seg->cands, sizeof(struct cand_ent *) * seg->nr_cands);
   seg->cands[seg->nr_cands - 1] = ce;
+  ce->gen_order = seg->nr_cands - 1;
   /**/
   if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_CAND) {
     anthy_print_candidate(ce);
@@ -104,12 +107,12 @@ push_back_guessed_candidate(struct seg_ent *seg)
   if (seg->str.len < 2) {
     return ;
   }
-  /* ǸʸϽ줫 */
+  /* 最後の文字は助詞か？ */
   xc = seg->str.str[seg->str.len - 1];
   if (!(anthy_get_xchar_type(xc) & XCT_DEP)) {
     return ;
   }
-  /* Ǹʸʳ򥫥ʤˤƤߤ */
+  /* 最後の文字以外をカタカナにしてみる */
   ce = alloc_cand_ent();
   xs = anthy_xstr_hira_to_kata(&seg->str);
   xs->str[xs->len-1] = xc;
@@ -120,7 +123,7 @@ push_back_guessed_candidate(struct seg_ent *seg)
   push_back_candidate(seg, ce);
 }
 
-/** Ƶ1ñ줺ĸƤƤ */
+/** 再帰で1単語ずつ候補を割当てていく */
 static int
 enum_candidates(struct seg_ent *seg,
 		struct cand_ent *ce,
@@ -132,8 +135,8 @@ enum_candidates(struct seg_ent *seg,
   int pos;
 
   if (n == ce->mw->nr_parts) {
-    /*  */
-    /* ʸβϤʤäʬʸɲ */
+    /* 完成形 */
+    /* 文節後部の解析しなかった部分を候補文字列に追加 */
     xstr tail;
     tail.len = seg->len - from;
     tail.str = &seg->str.str[from];
@@ -144,7 +147,7 @@ enum_candidates(struct seg_ent *seg,
 
   p = anthy_get_nr_dic_ents(ce->elm[n].se, &ce->elm[n].str);
 
-  /* ʻ줬ƤƤΤǡʻ˥ޥåΤƤ */
+  /* 品詞が割当てられているので、その品詞にマッチするものを割当てる */
   for (i = 0; i < p; i++) {
     wtype_t wt;
     if (anthy_get_nth_dic_ent_is_compound(ce->elm[n].se, i)) {
@@ -164,10 +167,10 @@ enum_candidates(struct seg_ent *seg,
       cand->elm[n].nth = i;
       cand->elm[n].id = anthy_xstr_hash(&word);
 
-      /* ñ */
+      /* 単語の本体 */
       anthy_xstrcat(&cand->str, &word);
       free(word.str);
-      /* ʬƵƤӽФ³Ƥ */
+      /* 自分を再帰呼び出しして続きを割り当てる */
       nr_cands += enum_candidates(seg, cand, 
 				  from + yomi.len,
 				  n+1);
@@ -175,7 +178,7 @@ enum_candidates(struct seg_ent *seg,
     }
   }
 
-  /* ʻξˤ̤ѴǼñعԤ */
+  /* 品詞不定の場合には未変換で次の単語へ行く */
   pos = anthy_wtype_get_pos(ce->elm[n].wt);
   if (nr_cands == 0 || pos == POS_INVAL || pos == POS_NONE) {
     xstr xs;
@@ -196,7 +199,7 @@ enum_candidates(struct seg_ent *seg,
 }
 
 /**
- * ʸΤޤñ(ñޤ)θ
+ * 文節全体を含む一単語(単漢字を含む)の候補を生成する
  */
 static void
 push_back_singleword_candidate(struct seg_ent *seg,
@@ -210,16 +213,16 @@ push_back_singleword_candidate(struct seg_ent *seg,
 
   se = anthy_get_seq_ent_from_xstr(&seg->str, is_reverse);
   n = anthy_get_nr_dic_ents(se, &seg->str);
-  /* γƥȥФ */
+  /* 辞書の各エントリに対して */
   for (i = 0; i < n; i++) {
     int ct;
     if (anthy_get_nth_dic_ent_is_compound(se, i)) {
       continue;
     }
-    /* ʻФ */
+    /* 品詞を取り出して */
     anthy_get_nth_dic_ent_wtype(se, &seg->str, i, &wt);
     ct = anthy_wtype_get_ct(wt);
-    /* ߷ѤʤΤθʤ */
+    /* 終止形か活用しないものの原形なら */
     if (ct == CT_SYUSI || ct == CT_NONE) {
       ce = alloc_cand_ent();
       anthy_get_nth_dic_ent_str(se,&seg->str, i, &xs);
@@ -234,18 +237,18 @@ push_back_singleword_candidate(struct seg_ent *seg,
 static void
 push_back_noconv_candidate(struct seg_ent *seg)
 {
-  /* ̵ѴҲ̾ˤʤʿ̾Τߤˤʤɲ */
+  /* 無変換で片仮名になる候補と平仮名のみになる候補を追加 */
   struct cand_ent *ce;
   xstr *xs;
 
-  /* Ҥ餬ʤΤ */
+  /* ひらがなのみ */
   ce = alloc_cand_ent();
   ce->str.str = anthy_xstr_dup_str(&seg->str);
   ce->str.len = seg->str.len;
   ce->flag = CEF_HIRAGANA;
   push_back_candidate(seg, ce);
 
-  /* ˥ */
+  /* 次にカタカナ */
   ce = alloc_cand_ent();
   xs = anthy_xstr_hira_to_kata(&seg->str);
   ce->str.str = anthy_xstr_dup_str(xs);
@@ -254,7 +257,7 @@ push_back_noconv_candidate(struct seg_ent *seg)
   anthy_free_xstr(xs);
   push_back_candidate(seg, ce);
 
-  /* Τߤʸ */
+  /* 記号のみの文節 */
   xs = anthy_conv_half_wide(&seg->str);
   if (xs) {
     ce = alloc_cand_ent();
@@ -266,7 +269,7 @@ push_back_noconv_candidate(struct seg_ent *seg)
   }
 }
 
-/* word_listpart_info󤫤cand_elm */
+/* word_listの要素part_infoの配列からcand_elmの配列を作る */
 static void
 make_cand_elem_from_word_list(struct seg_ent *se,
 			      struct cand_ent *ce,
@@ -281,7 +284,7 @@ make_cand_elem_from_word_list(struct seg_ent *se,
     struct part_info *part = &wl->part[i];
     xstr core_xs;
     if (part->len == 0) {
-      /* Ĺ̵part̵뤹 */
+      /* 長さの無いpartは無視する */
       continue;
     }
     if (i == PART_CORE) {
@@ -301,7 +304,7 @@ make_cand_elem_from_word_list(struct seg_ent *se,
 }
 
 
-/** ޤwordlistmetawordmeta_wordФ */
+/** まずwordlistを持つmetawordからmeta_wordを取り出す */
 static void
 make_candidate_from_simple_metaword(struct seg_ent *se,
 				    struct meta_word *mw,
@@ -309,11 +312,11 @@ make_candidate_from_simple_metaword(struct seg_ent *se,
 				    int is_reverse)
 {
   /*
-   * ñʻ줬ꤵ줿֤ǥߥåȤ롣
+   * 各単語の品詞が決定された状態でコミットされる。
    */
   struct cand_ent *ce;
 
-  /* ʣ(1ޤ)ñǹʸñƤƤ */
+  /* 複数(1も含む)の単語で構成される文節に単語を割当てていく */
   ce = alloc_cand_ent();
   ce->nr_words = mw->nr_parts;
   ce->str.str = NULL;
@@ -322,10 +325,10 @@ make_candidate_from_simple_metaword(struct seg_ent *se,
   ce->mw = mw;
   ce->score = 0;
 
-  /* Ƭ, Ω, , ° */
+  /* 接頭辞, 自立語部, 接尾辞, 付属語 */
   make_cand_elem_from_word_list(se, ce, mw->wl, 0, is_reverse);
 
-  /* WRAPƤGUESSƱˤ򲼤 */
+  /* WRAPされていたらGUESSと同じ扱いにして点数を下げる */
   if (anthy_metaword_type_tab[top_mw->type].status != MW_STATUS_WRAPPED) {
     ce->flag = (se->best_mw == mw) ? CEF_BEST : CEF_NONE;
   } else {
@@ -336,7 +339,7 @@ make_candidate_from_simple_metaword(struct seg_ent *se,
   anthy_release_cand_ent(ce);
 }
 
-/** combinedmetawordĤθΤưĤθȤƽФ */
+/** combinedなmetawordは二つの語を合体して一つの語として出す */
 static void
 make_candidate_from_combined_metaword(struct seg_ent *se,
 				      struct meta_word *mw,
@@ -344,11 +347,11 @@ make_candidate_from_combined_metaword(struct seg_ent *se,
 				      int is_reverse)
 {
   /*
-   * ñʻ줬ꤵ줿֤ǥߥåȤ롣
+   * 各単語の品詞が決定された状態でコミットされる。
    */
   struct cand_ent *ce;
 
-  /* ʣ(1ޤ)ñǹʸñƤƤ */
+  /* 複数(1も含む)の単語で構成される文節に単語を割当てていく */
   ce = alloc_cand_ent();
   ce->nr_words = mw->nr_parts;
   ce->score = 0;
@@ -357,13 +360,13 @@ make_candidate_from_combined_metaword(struct seg_ent *se,
   ce->elm = calloc(sizeof(struct cand_elm),ce->nr_words);
   ce->mw = top_mw;
 
-  /* Ƭ, Ω, , ° */
+  /* 接頭辞, 自立語部, 接尾辞, 付属語 */
   make_cand_elem_from_word_list(se, ce, mw->mw1->wl, 0, is_reverse);
   if (mw->mw2) {
     make_cand_elem_from_word_list(se, ce, mw->mw2->mw1->wl, NR_PARTS, is_reverse);
   }
 
-  /* WRAPƤGUESSƱˤ򲼤 */
+  /* WRAPされていたらGUESSと同じ扱いにして点数を下げる */
   if (anthy_metaword_type_tab[top_mw->type].status != MW_STATUS_WRAPPED) {
     ce->flag = (se->best_mw == mw) ? CEF_BEST : CEF_NONE;
   } else {
@@ -375,19 +378,19 @@ make_candidate_from_combined_metaword(struct seg_ent *se,
 }
 
 
-/** splitterξѤƸ
+/** splitterの情報を利用して候補を生成する
  */
 static void
 proc_splitter_info(struct seg_ent *se,
 		   struct meta_word *mw,
-		   /* topȤtreeΥȥå */
+		   /* topとはtreeのトップ */
 		   struct meta_word *top_mw,
 		   int is_reverse)
 {
   enum mw_status st;
   if (!mw) return;
 
-  /* ޤwordlistmetawordξ */
+  /* まずwordlistを持つmetawordの場合 */
   if (mw->wl && mw->wl->len) {
     make_candidate_from_simple_metaword(se, mw, top_mw, is_reverse);
     return;
@@ -396,14 +399,14 @@ proc_splitter_info(struct seg_ent *se,
   st = anthy_metaword_type_tab[mw->type].status;
   switch (st) {
   case MW_STATUS_WRAPPED:
-    /* wrap줿ΤξФ */
+    /* wrapされたものの情報を取り出す */
     proc_splitter_info(se, mw->mw1, top_mw, is_reverse);
     break;
   case MW_STATUS_COMBINED:
     make_candidate_from_combined_metaword(se, mw, top_mw, is_reverse);
     break;
   case MW_STATUS_COMPOUND:
-    /* Ϣʸ */
+    /* 連文節の葉 */
     {
       struct cand_ent *ce;
       ce = alloc_cand_ent();
@@ -415,12 +418,12 @@ proc_splitter_info(struct seg_ent *se,
     }
     break;
   case MW_STATUS_COMPOUND_PART:
-    /* Ϣʸθġʸ礷ưĤʸȤƤߤ */
+    /* 連文節の個々の文節を結合して一つの文節としてみたもの */
     /* BREAK THROUGH */
   case MW_STATUS_OCHAIRE:
     {
-    /* metawordʤʸ
-       ľܤ˻ꤵ줿 */
+    /* metawordを持たない候補文字列が
+       直接に指定された */
       struct cand_ent *ce;
       ce = alloc_cand_ent();
       ce->str.str = anthy_xstr_dup_str(&mw->cand_hint);
@@ -429,7 +432,7 @@ proc_splitter_info(struct seg_ent *se,
       ce->flag = (st == MW_STATUS_OCHAIRE) ? CEF_OCHAIRE : CEF_COMPOUND_PART;
 
       if (mw->len < se->len) {
-	/* metawordǥСƤʤΰʸդ */
+	/* metawordでカバーされてない領域の文字列を付ける */
 	xstr xs;
 	xs.str = &se->str.str[mw->len];
 	xs.len = se->len - mw->len;
@@ -445,8 +448,8 @@ proc_splitter_info(struct seg_ent *se,
   }
 }
 
-/** context.cƽФäȤʪ
- * İʾθɬ
+/** context.cから呼出されるもっとも大物
+ * 一つ以上の候補を必ず生成する
  */
 void
 anthy_do_make_candidates(struct splitter_context *sc,
@@ -454,7 +457,7 @@ anthy_do_make_candidates(struct splitter_context *sc,
 {
   int i;
 
-  /* metaword */
+  /* metawordから候補を生成する */
   for (i = 0; i < seg->nr_metaword; i++) {
     struct meta_word *mw = seg->mw_array[i];
     if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_CAND) {
@@ -465,12 +468,12 @@ anthy_do_make_candidates(struct splitter_context *sc,
   if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_CAND) {
     printf("#done\n");
   }
-  /* ñʤɤθ */
+  /* 単漢字などの候補 */
   push_back_singleword_candidate(seg, is_reverse);
 
-  /* Ҥ餬ʡʤ̵Ѵȥ */
+  /* ひらがな、カタカナの無変換エントリを作る */
   push_back_noconv_candidate(seg);
 
-  /* 䤬Ĥ̵ȤϺǸ夬ǻĤ꤬ʿ̾θ뤫 */
+  /* 候補が二つしか無いときは最後が助詞で残りが平仮名の候補を作れるか試す */
   push_back_guessed_candidate(seg);
 }
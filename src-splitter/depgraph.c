@@ -1,7 +1,7 @@
 /*
- * ʸμΩ(Ƭޤ)³
- * 졢ưʤɤ°Υѥ򤿤ɤ롣
- * ѥϥդȤեѰդ롣
+ * 文節の自立語部(接頭辞、接尾辞含む)に続く
+ * 助詞、助動詞などの付属語のパターンをたどる。
+ * パターンはグラフとして設定ファイルに用意する。
  *
  *
  *  +------+
@@ -37,60 +37,24 @@
 #include <anthy/diclib.h>
 #include "wordborder.h"
 
-/* ntohlθƤӽФ¿ΤǡntohlľܸƤ֤Ȥˤ */
+/* ntohlの呼び出しが多いので、本来のntohlを直接呼ぶことにする */
 #include <arpa/inet.h>
 #define anthy_ntohl ntohl
 
-/* ܥ */
+/* 遷移グラフ */
 static struct dep_dic ddic;
 
 
 static void
-match_branch(struct splitter_context *sc,
-	     struct word_list *tmpl,
+match_branch(struct dep_scan *scan,
+	     struct dep_outcome *tmpl,
 	     xstr *xs, struct dep_branch *db);
 static void
-match_nodes(struct splitter_context *sc,
-	    struct word_list *wl,
+match_nodes(struct dep_scan *scan,
+	    struct dep_outcome *st,
 	    xstr follow_str, int node);
 
 
-static int
-anthy_xstrcmp_with_ondisk(xstr *xs,
-			  ondisk_xstr *dxs)
-{
-  int *d = (int *)dxs;
-  int len = anthy_dic_ntohl(d[0]);
-  int i;
-  xchar c;
-  if (len != xs->len) {
-    return 1;
-  }
-  d++;
-  for (i = 0; i < len; i++) {
-    c = anthy_dic_ntohl(d[i]);
-    if (xs->str[i] != c) {
-      return 1;
-    }
-  }
-  return 0;
-}
-
-static ondisk_xstr *
-anthy_next_ondisk_xstr(ondisk_xstr *dxs)
-{
-  int *d = (int *)dxs;
-  int len = anthy_dic_ntohl(d[0]);
-  return &d[len+1];
-}
-
-static int
-anthy_ondisk_xstr_len(ondisk_xstr *dxs)
-{
-  int *d = (int *)dxs;
-  return anthy_dic_ntohl(d[0]);
-}
-
 static int
 check_follow(xstr *follow_str, int mask)
 {
@@ -106,136 +70,218 @@ check_follow(xstr *follow_str, int mask)
   return 0;
 }
 
+/* 受理した遷移条件 */
+struct dep_match {
+  int rank;
+  int branch;
+  int len;
+};
+
+/* 状態dsから文字cで遷移する先の状態、無ければ-1 */
+static int
+next_state(struct dep_state *ds, xchar c)
+{
+  struct dep_edge *e = &ddic.edges[ds->first_edge];
+  int lo = 0, hi = ds->nr_edges;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (e[mid].c == c) {
+      return e[mid].next_state;
+    }
+    if (e[mid].c < c) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return -1;
+}
+
 /*
- * ƥΡɤˤܾƥȤ
+ * 各ノードにおける遷移条件をテストする
+ * 後続の文字列でトライを一度たどり、受理した遷移条件を
+ * branchと遷移条件の順に並べてから遷移する
  *
- * wl Ωword_list
- * follow_str Ωʹߤʸ
- * node 롼ֹ
+ * scan 結果を格納する
+ * st ここまでの付属語部の状態
+ * follow_str 自立語部以降の文字列
+ * node ルールの番号
  */
 static void
-match_nodes(struct splitter_context *sc,
-	    struct word_list *wl,
+match_nodes(struct dep_scan *scan,
+	    struct dep_outcome *st,
 	    xstr follow_str, int node)
 {
   struct dep_node *dn = &ddic.nodes[node];
-  struct dep_branch *db;
-  int i,j;
+  struct dep_match m[DEP_MAX_MATCHES];
+  int nr = 0;
+  int s, i, j, k;
 
   if (!check_follow(&follow_str, dn->follow_mask)) {
     return ;
   }
 
-  /* ƥ롼 */
-  for (i = 0; i < dn->nr_branch; i++) {
-    ondisk_xstr *dep_xs;
-
-    db = &dn->branch[i];
-    dep_xs = db->xstrs;
-
-    /* ܾ */
-    for (j = 0; j < db->nr_cond_strs;
-	 j++, dep_xs = anthy_next_ondisk_xstr(dep_xs)) {
-      xstr cond_xs;
-      /* °ܾĹȤɬ */
-      if (follow_str.len < anthy_ondisk_xstr_len(dep_xs)) {
-	continue;
-      }
-      /* ܾʬڤФ */
-      cond_xs.str = follow_str.str;
-      cond_xs.len = anthy_ondisk_xstr_len(dep_xs);
-
-      /* ܾӤ */
-      if (!anthy_xstrcmp_with_ondisk(&cond_xs, dep_xs)) {
-	/* ܾmatch */
-	struct word_list new_wl = *wl;
-	struct part_info *part = &new_wl.part[PART_DEPWORD];
-	xstr new_follow;
-
-	part->len += cond_xs.len;
-	new_follow.str = &follow_str.str[cond_xs.len];
-	new_follow.len = follow_str.len - cond_xs.len;
-	/* ܤƤߤ */
-	match_branch(sc, &new_wl, &new_follow, db);
+  s = dn->root_state;
+  for (i = 0; ; i++) {
+    struct dep_state *ds = &ddic.states[s];
+    /* 長さiの遷移条件を受理した */
+    for (j = 0; j < ds->nr_accepts; j++) {
+      struct dep_accept *da = &ddic.accepts[ds->first_accept + j];
+      for (k = nr; k > 0 && m[k - 1].rank > da->rank; k--) {
+	m[k] = m[k - 1];
       }
+      m[k].rank = da->rank;
+      m[k].branch = da->branch;
+      m[k].len = i;
+      nr++;
+    }
+    if (i == follow_str.len) {
+      break;
     }
+    s = next_state(ds, follow_str.str[i]);
+    if (s < 0) {
+      break;
+    }
+  }
+
+  for (i = 0; i < nr; i++) {
+    struct dep_outcome new_st = *st;
+    xstr new_follow;
+
+    new_st.len += m[i].len;
+    new_follow.str = &follow_str.str[m[i].len];
+    new_follow.len = follow_str.len - m[i].len;
+    /* 遷移してみる */
+    match_branch(scan, &new_st, &new_follow, &dn->branch[m[i].branch]);
+  }
+}
+
+/* 終端に到達したので結果に追加する */
+static void
+push_outcome(struct dep_scan *scan, struct dep_outcome *st)
+{
+  if (!(scan->nr_outcomes & (scan->nr_outcomes - 1))) {
+    /* 2のべき乗の個数になったら倍に広げる */
+    int size = scan->nr_outcomes ? scan->nr_outcomes * 2 : 1;
+    scan->outcomes = realloc(scan->outcomes,
+			     sizeof(struct dep_outcome) * size);
   }
+  scan->outcomes[scan->nr_outcomes] = *st;
+  scan->nr_outcomes++;
 }
 
 /*
- * ܤ¹ԤƤߤ
+ * 各遷移を実行してみる
  *
- * tmpl ޤǤ˹word_list
- * xs Ĥʸ
- * db Ĵbranch
+ * tmpl ここまでの付属語部の状態
+ * xs 残りの文字列
+ * db 現在調査中のbranch
  */
 static void
-match_branch(struct splitter_context *sc,
-	     struct word_list *tmpl,
+match_branch(struct dep_scan *scan,
+	     struct dep_outcome *tmpl,
 	     xstr *xs, struct dep_branch *db)
 {
-  struct part_info *part = &tmpl->part[PART_DEPWORD];
   int i;
 
-  /* ˥ȥ饤 */
+  /* 遷移先を順にトライする */
   for (i = 0; i < db->nr_transitions; i++) {
-    /**/
-    int head_pos = tmpl->head_pos; /* ʻξ */
-    int features = tmpl->mw_features;
-    enum dep_class dc = part->dc;
-    /**/
+    struct dep_outcome st = *tmpl;
     struct dep_transition *transition = &db->transitions[i];
 
-    tmpl->tail_ct = anthy_dic_ntohl(transition->ct);
-    /* ܤγѷʻ */
-    if (anthy_dic_ntohl(transition->dc) != DEP_NONE) {
-      part->dc = anthy_dic_ntohl(transition->dc);
+    st.ct = transition->ct;
+    /* 遷移の活用形と品詞 */
+    if (transition->dc != DEP_NONE) {
+      st.dc = transition->dc;
     }
-    /* ̾첽ưʻ̾ */
-    if (anthy_dic_ntohl(transition->head_pos) != POS_NONE) {
-      tmpl->head_pos = anthy_dic_ntohl(transition->head_pos);
+    /* 名詞化する動詞等で品詞名を上書き */
+    if (transition->head_pos != POS_NONE) {
+      st.head_pos = transition->head_pos;
     }
     if (transition->weak) {
-      tmpl->mw_features |= MW_FEATURE_WEAK_CONN;
+      st.weak = 1;
     }
 
-    /* ܤü */
-    if (anthy_dic_ntohl(transition->next_node)) {
-      /*  */
-      match_nodes(sc, tmpl, *xs, anthy_dic_ntohl(transition->next_node));
+    /* 遷移か終端か */
+    if (transition->next_node) {
+      /* 遷移 */
+      match_nodes(scan, &st, *xs, transition->next_node);
     } else {
-      struct word_list *wl;
-
-      /* 
-       * üΡɤãΤǡ
-       * word_listȤƥߥå
-       */
-      wl = anthy_alloc_word_list(sc);
-      *wl = *tmpl;
-      wl->len += part->len;
-
-      /**/
-      anthy_commit_word_list(sc, wl);
+      push_outcome(scan, &st);
+    }
+  }
+}
+
+/*
+ * 位置posからnodeを検索した結果を返す
+ * 同じ位置で終わる自立語が同じノードに続くことは多いので、
+ * 結果はword_split_infoにキャッシュする
+ */
+static struct dep_scan *
+get_dep_scan(struct splitter_context *sc, int pos,
+	     xstr *follow, int node)
+{
+  struct word_split_info_cache *info = sc->word_split_info;
+  struct dep_scan *scan;
+  struct dep_outcome st;
+
+  for (scan = info->dep_scan[pos]; scan; scan = scan->next) {
+    if (scan->node == node) {
+      return scan;
     }
-    /* ᤷ */
-    part->dc = dc;
-    tmpl->head_pos = head_pos;
-    tmpl->mw_features = features;
   }
+
+  scan = anthy_smalloc(info->DepAllocator);
+  scan->node = node;
+  scan->nr_outcomes = 0;
+  scan->outcomes = NULL;
+  scan->next = info->dep_scan[pos];
+  info->dep_scan[pos] = scan;
+
+  /* 付属語の付いていない状態から検索を開始する */
+  st.len = 0;
+  st.dc = DEP_NONE;
+  st.head_pos = POS_NONE;
+  st.ct = CT_NONE;
+  st.weak = 0;
+  match_nodes(scan, &st, *follow, node);
+  return scan;
 }
 
-/** 
+/** 検索開始
+ * 自立語部に付属語部を付けたword_listをコミットする
  */
 void
 anthy_scan_node(struct splitter_context *sc,
 		struct word_list *tmpl,
 		xstr *follow, int node)
 {
-  /* °դƤʤ֤鸡򳫻Ϥ */
-  match_nodes(sc, tmpl, *follow, node);
-}
+  struct dep_scan *scan;
+  int i;
 
+  scan = get_dep_scan(sc, tmpl->from + tmpl->len, follow, node);
+  for (i = 0; i < scan->nr_outcomes; i++) {
+    struct dep_outcome *o = &scan->outcomes[i];
+    struct word_list *wl = anthy_alloc_word_list(sc);
+    struct part_info *part = &wl->part[PART_DEPWORD];
 
+    *wl = *tmpl;
+    part->len += o->len;
+    if (o->dc != DEP_NONE) {
+      part->dc = o->dc;
+    }
+    if (o->head_pos != POS_NONE) {
+      wl->head_pos = o->head_pos;
+    }
+    wl->tail_ct = o->ct;
+    if (o->weak) {
+      wl->mw_features |= MW_FEATURE_WEAK_CONN;
+    }
+    wl->len += part->len;
+
+    anthy_commit_word_list(sc, wl);
+  }
+}
 
 
 static void
@@ -246,25 +292,42 @@ read_xstr(struct dep_dic* ddic, int* offset)
   *offset += sizeof(xchar) * len;
 }
 
+static int
+read_int(struct dep_dic* ddic, int* offset)
+{
+  int v = anthy_dic_ntohl(*(int*)&ddic->file_ptr[*offset]);
+  *offset += sizeof(int);
+  return v;
+}
+
 static void
 read_branch(struct dep_dic* ddic, struct dep_branch* branch, int* offset)
 {
   int i;
 
-  /* ܾοɤ */
+  /* 遷移条件の数を読む */
   branch->nr_cond_strs = anthy_dic_ntohl(*(int*)&ddic->file_ptr[*offset]);
   *offset += sizeof(int);
-  /* ܾʸɤ߼ */
+  /* 遷移条件の文字列を読み取る */
   branch->xstrs = (ondisk_xstr *)&ddic->file_ptr[*offset];
 
   for (i = 0; i < branch->nr_cond_strs; ++i) {
     read_xstr(ddic, offset);
   }
 
-  branch->nr_transitions = anthy_dic_ntohl(*(int*)&ddic->file_ptr[*offset]);
-  *offset += sizeof(int);
-  branch->transitions = (struct dep_transition*)&ddic->file_ptr[*offset];
-  *offset += sizeof(struct dep_transition) * branch->nr_transitions;
+  /* 遷移はホストのバイトオーダーに変換しておく */
+  branch->nr_transitions = read_int(ddic, offset);
+  branch->transitions = malloc(sizeof(struct dep_transition) *
+			       branch->nr_transitions);
+  for (i = 0; i < branch->nr_transitions; ++i) {
+    struct dep_transition *tr = &branch->transitions[i];
+    tr->next_node = read_int(ddic, offset);
+    tr->pos = read_int(ddic, offset);
+    tr->ct = read_int(ddic, offset);
+    tr->dc = read_int(ddic, offset);
+    tr->head_pos = read_int(ddic, offset);
+    tr->weak = read_int(ddic, offset);
+  }
 }
 
 static void
@@ -282,7 +345,44 @@ read_node(struct dep_dic* ddic, struct dep_node* node, int* offset)
   }
 }
 
-static void
+/* 遷移条件のオートマトンを読み込む */
+static int
+read_automaton(struct dep_dic* ddic, int* offset)
+{
+  int i, nr_edges, nr_accepts;
+
+  if (read_int(ddic, offset) != DEP_AUTOMATON_MAGIC) {
+    return -1;
+  }
+  ddic->nrStates = read_int(ddic, offset);
+  nr_edges = read_int(ddic, offset);
+  nr_accepts = read_int(ddic, offset);
+  for (i = 0; i < ddic->nrNodes; i++) {
+    ddic->nodes[i].root_state = read_int(ddic, offset);
+  }
+
+  ddic->states = malloc(sizeof(struct dep_state) * ddic->nrStates);
+  for (i = 0; i < ddic->nrStates; i++) {
+    struct dep_state *ds = &ddic->states[i];
+    ds->first_edge = read_int(ddic, offset);
+    ds->nr_edges = read_int(ddic, offset);
+    ds->first_accept = read_int(ddic, offset);
+    ds->nr_accepts = read_int(ddic, offset);
+  }
+  ddic->edges = malloc(sizeof(struct dep_edge) * nr_edges);
+  for (i = 0; i < nr_edges; i++) {
+    ddic->edges[i].c = read_int(ddic, offset);
+    ddic->edges[i].next_state = read_int(ddic, offset);
+  }
+  ddic->accepts = malloc(sizeof(struct dep_accept) * nr_accepts);
+  for (i = 0; i < nr_accepts; i++) {
+    ddic->accepts[i].rank = read_int(ddic, offset);
+    ddic->accepts[i].branch = read_int(ddic, offset);
+  }
+  return 0;
+}
+
+static int
 read_file(void)
 {
   int i;
@@ -291,22 +391,24 @@ read_file(void)
 
   ddic.file_ptr = anthy_file_dic_get_section("dep_dic");
 
-  /* ǽ˥롼ο */
+  /* 最初にルールの数 */
   ddic.nrRules = anthy_dic_ntohl(*(int*)&ddic.file_ptr[offset]);
   offset += sizeof(int);
 
-  /* ƥ롼 */
+  /* 各ルールの定義 */
   ddic.rules = (struct ondisk_wordseq_rule*)&ddic.file_ptr[offset];
   offset += sizeof(struct ondisk_wordseq_rule) * ddic.nrRules;
-  /* Ρɤο */
+  /* ノードの数 */
   ddic.nrNodes = anthy_dic_ntohl(*(int*)&ddic.file_ptr[offset]);
   offset += sizeof(int);
 
-  /* ƥΡɤɤ߹ */
+  /* 各ノードを読み込む */
   ddic.nodes = malloc(sizeof(struct dep_node) * ddic.nrNodes);
   for (i = 0; i < ddic.nrNodes; ++i) {
     read_node(&ddic, &ddic.nodes[i], &offset);
   }
+
+  return read_automaton(&ddic, &offset);
 }
 
 int
@@ -318,7 +420,7 @@ anthy_get_nr_dep_rule()
 void
 anthy_get_nth_dep_rule(int index, struct wordseq_rule *rule)
 {
-  /* եξ󤫤ǡФ */
+  /* ファイル上の情報からデータを取り出す */
   struct ondisk_wordseq_rule *r = &ddic.rules[index];
   rule->wt = anthy_get_wtype(r->wt[0], r->wt[1], r->wt[2],
 			     r->wt[3], r->wt[4], r->wt[5]);
@@ -328,7 +430,10 @@ anthy_get_nth_dep_rule(int index, struct wordseq_rule *rule)
 int
 anthy_init_depword_tab()
 {
-  read_file();
+  if (read_file()) {
+    anthy_log(0, "Dependent word graph has no automaton.\n");
+    return -1;
+  }
   return 0;
 }
 
@@ -338,7 +443,14 @@ anthy_quit_depword_tab(void)
   int i;
   for (i = 0; i < ddic.nrNodes; i++) {
     struct dep_node* node = &ddic.nodes[i];
+    int j;
+    for (j = 0; j < node->nr_branch; j++) {
+      free(node->branch[j].transitions);
+    }
     free(node->branch);
   }
   free(ddic.nodes);
+  free(ddic.states);
+  free(ddic.edges);
+  free(ddic.accepts);
 }
@@ -1,11 +1,11 @@
 /*
- * ʸζ򸡽Ф롣
+ * 文節の境界を検出する。
  *
- * metawordˤϥӥӥ르ꥺȤ
+ * metawordの選択にはビタビアルゴリズムを使う
  *
- * anthy_eval_border() ǻꤵ줿ΰʸʬ䤹
+ * anthy_eval_border() で指定された領域を文節に分割する
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 10/29
+ * Funded by IPA未踏ソフトウェア創造事業 2001 10/29
  * Copyright (C) 2000-2003 TABATA Yusuke, UGAWA Tomoharu
  */
 #include <stdio.h>
@@ -21,20 +21,20 @@ border_check(struct meta_word* mw,
 	     int border)
 {
   if (mw->from < border) {
-    /* Ƭʸ椫ϤޤmwʸڤˤԤäꤢäƤʤȥ */
+    /* 先頭の文節の中から始まるmwは文節区切りにぴったりあっていないとダメ */
     if (mw->from == from && mw->from + mw->len == border) {
       return 1;
     } else {
       return 0;
     }
   } else {
-    /* ʸ̵˻Ѳǽ */
+    /* 後ろの文節は無条件に使用可能 */
     return 1;
   }
 }
 
 /*
- * ƵŪmetawordѲǽå
+ * 再帰的にmetawordが使用可能かチェックする
  */
 static void
 metaword_constraint_check(struct splitter_context *sc,
@@ -72,7 +72,7 @@ metaword_constraint_check(struct splitter_context *sc,
       struct meta_word* itr = mw;
       mw->can_use = ok;
       
-      /* ġʸΰĤǤʸڤޤäƤСʣϻȤʤ */
+      /* 個々の文節の一つでも文節区切りをまたがっていれば、この複合語は使えない */
       for (; itr && itr->type == MW_NUMBER; itr = itr->mw2) {
 	struct meta_word* mw1 = itr->mw1;
 	if (!border_check(mw1, from, border)) {
@@ -87,7 +87,7 @@ metaword_constraint_check(struct splitter_context *sc,
       struct meta_word* itr = mw;
       mw->can_use = ok;
       
-      /* ġʸΰĤǤʸڤޤäƤСʣϻȤʤ */
+      /* 個々の文節の一つでも文節区切りをまたがっていれば、この複合語は使えない */
       for (; itr && (itr->type == MW_COMPOUND_HEAD || itr->type == MW_COMPOUND); itr = itr->mw2) {
 	struct meta_word* mw1 = itr->mw1;
 	if (!border_check(mw1, from, border)) {
@@ -119,7 +119,7 @@ metaword_constraint_check(struct splitter_context *sc,
 }
 
 /*
- * ƤmetawordˤĤƻѤǤ뤫ɤå
+ * 全てのmetawordについて使用できるかどうかをチェックする
  */
 static void
 metaword_constraint_check_all(struct splitter_context *sc,
@@ -130,7 +130,7 @@ metaword_constraint_check_all(struct splitter_context *sc,
   struct word_split_info_cache *info;
   info = sc->word_split_info;
 
-  /* ޤuncheckedˤ */
+  /* まずuncheckedにする */
   for (i = from; i < to; i ++) {
     struct meta_word *mw;
     for (mw = info->cnode[i].mw;
@@ -139,7 +139,7 @@ metaword_constraint_check_all(struct splitter_context *sc,
     }
   }
 
-  /* ˹줿metawordˤĤƥå */
+  /* 次に合成されたmetawordについてチェック */
   for (i = from; i < to; i ++) {
     struct meta_word *mw;
     for (mw = info->cnode[i].mw; mw; mw = mw->next) {
@@ -149,7 +149,65 @@ metaword_constraint_check_all(struct splitter_context *sc,
 }
 
 /*
- * ʸᶭޡ
+ * 再変換の元の文節の境界をまたぐかどうか
+ */
+static int
+cross_fixed_border(struct splitter_context *sc, struct meta_word *mw)
+{
+  int i;
+  for (i = mw->from + 1; i < mw->from + mw->len; i ++) {
+    if (sc->ce[i].fixed_border) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * 再変換の元の文節の境界をまたぐmetawordを使用不可にする
+ */
+static void
+metaword_fixed_border_check_all(struct splitter_context *sc,
+				int from, int to)
+{
+  int i;
+  struct word_split_info_cache *info;
+  info = sc->word_split_info;
+
+  for (i = from + 1; i < to; i ++) {
+    if (sc->ce[i].fixed_border) {
+      break;
+    }
+  }
+  if (i == to) {
+    /* 制約が無い */
+    return ;
+  }
+
+  for (i = from; i < to; i ++) {
+    struct meta_word *mw;
+    for (mw = info->cnode[i].mw; mw; mw = mw->next) {
+      if (mw->can_use != ok) {
+	continue;
+      }
+      if (anthy_metaword_type_tab[mw->type].check == MW_CHECK_COMPOUND) {
+	/* 複合語は個々の文節が境界をまたがなければ使える */
+	struct meta_word *itr = mw;
+	for (; itr && (itr->type == MW_COMPOUND_HEAD || itr->type == MW_COMPOUND); itr = itr->mw2) {
+	  if (cross_fixed_border(sc, itr->mw1)) {
+	    mw->can_use = ng;
+	    break;
+	  }
+	}
+      } else if (cross_fixed_border(sc, mw)) {
+	mw->can_use = ng;
+      }
+    }
+  }
+}
+
+/*
+ * ここから文節境界をマークする
  */
 void
 anthy_eval_border(struct splitter_context *sc, int from, int from2, int to)
@@ -157,11 +215,12 @@ anthy_eval_border(struct splitter_context *sc, int from, int from2, int to)
   struct meta_word *mw;
   int nr;
 
-  /* ʸΤȤΤΤ */
+  /* 文節候補のうち使えるもののみ選択 */
   metaword_constraint_check_all(sc, from, to, from2);
+  metaword_fixed_border_check_all(sc, from, to);
 
-  /* fromfrom2δ֤򥫥Сmeta_word뤫ɤõ
-   * СfromϤԤʤfrom2Ϥ򤹤롣
+  /* fromとfrom2の間をカバーするmeta_wordがあるかどうかを探す。
+   * あれば、fromから解析を行い、なければfrom2から解析をする。
    */
   nr = 0;
   for (mw = sc->word_split_info->cnode[from].mw; mw; mw = mw->next) {
@@ -174,6 +233,6 @@ anthy_eval_border(struct splitter_context *sc, int from, int from2, int to)
     from = from2;
   }
 
-  /* ʸζꤹ */
+  /* 文節の境界を設定する */
   anthy_mark_borders(sc, from, to);
 }
@@ -1,9 +1,9 @@
 /*
- * Ψɾӥӥ르ꥺ(viterbi algorithm)ˤä
- * ʸζڤꤷƥޡ롣
+ * 確率を評価しビタビアルゴリズム(viterbi algorithm)によって
+ * 文節の区切りを決定してマークする。
  *
  *
- * ƤӽФؿ
+ * 外部から呼び出される関数
  *  anthy_mark_borders()
  *
  * Copyright (C) 2006-2007 TABATA Yusuke
@@ -27,14 +27,14 @@
   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
  */
 /*
- * ƥ¸ߤmeta_wordĤʤǥդޤ
- * (ΥդΤȤƥ(lattice/«)⤷ϥȥꥹ(trellis)ȸƤӤޤ)
- * meta_wordɤ³դΥΡɤȤʤꡢ¤lattice_node
- * 󥯤Ȥƹޤ
+ * コンテキスト中に存在するmeta_wordをつないでグラフを構成します。
+ * (このグラフのことをラティス(lattice/束)もしくはトレリス(trellis)と呼びます)
+ * meta_wordどうしの接続がグラフのノードとなり、構造体lattice_nodeの
+ * リンクとして構成されます。
  *
- * ǤνϼĤǤǹޤ
- * (1) դĤġƥΡɤؤãΨ
- * (2) դ()餿ɤäƺŬʥѥ
+ * ここでの処理は次の二つの要素で構成されます
+ * (1) グラフを構成しつつ、各ノードへの到達確率を求める
+ * (2) グラフを後ろ(右)からたどって最適なパスを求める
  *
  */
 #include <stdio.h>
@@ -57,20 +57,20 @@ static void *seg_len_info_array;
 
 #define NODE_MAX_SIZE 50
 
-/* դΥΡ(ܾ) */
+/* グラフのノード(遷移状態) */
 struct lattice_node {
   int node_id;
-  int border; /* ʸΤɤϤޤΡɤ */
-  enum seg_class seg_class; /* ξ֤ʻ */
+  int border; /* 文字列中のどこから始まるノードか */
+  enum seg_class seg_class; /* この状態の品詞 */
 
 
-  double node_probability; /* ΥΡɤγΨ */
-  double path_probability;  /* ˻ޤǤγΨ */
+  double node_probability; /* このノードが正解の確率 */
+  double path_probability;  /* ここに至るまでの確率 */
 
-  struct lattice_node* before_node; /* ΥΡ */
-  struct meta_word* mw; /* ΥΡɤбmeta_word */
+  struct lattice_node* before_node; /* 一つ前のノード */
+  struct meta_word* mw; /* このノードに対応するmeta_word */
 
-  struct lattice_node* next; /* ꥹȹ¤ΤΥݥ */
+  struct lattice_node* next; /* リスト構造のためのポインタ */
 };
 
 struct node_list_head {
@@ -79,11 +79,11 @@ struct node_list_head {
 };
 
 struct lattice_info {
-  /* ܾ֤ΥꥹȤ */
+  /* 遷移状態のリストの配列 */
   int node_id;
   struct node_list_head *lattice_node_list;
   struct splitter_context *sc;
-  /* ΡɤΥ */
+  /* ノードのアロケータ */
   allocator node_allocator;
   int last_node_id;
 };
@@ -146,18 +146,9 @@ static double
 search_probability(void *array, struct feature_list *fl, double noscore)
 {
   double prob;
-  struct feature_freq *res, arg;
-
-  /* Ψ׻ */
-  res = anthy_find_feature_freq(array, fl, &arg);
-  if (res) {
-    double pos = res->f[15];
-    double neg = res->f[14];
-    prob = 1 - (neg) / (double) (pos + neg);
-    if (prob < 0) {
-      prob = noscore;
-    }
-  } else {
+
+  /* 確率を計算する */
+  if (!anthy_find_feature_prob(array, fl, &prob)) {
     prob = noscore;
   }
   return prob;
@@ -186,16 +177,16 @@ get_transition_probability(struct lattice_node *node)
   double probability, p;
   double trans_p, seg_p, all_p, len_p;
 
-  /* ΥꥹȤ */
+  /* 全部の素性のリストを作る */
   anthy_feature_list_init(&seg_features, FL_SEG_FEATURES);
   build_feature_list(node, node->before_node, &seg_features);
-  /* ʸ³˴ؤꥹ */
+  /* 文節接続に関する素性リスト */
   anthy_feature_list_clone(&seg_trans_features, &seg_features, FL_SEG_TRANS_FEATURES);
   anthy_feature_list_clone(&seg_struct_features, &seg_features, FL_SEG_STRUCT_FEATURES);
   /**/
   anthy_feature_list_clone(&seg_len_features, &seg_features, FL_SEG_LEN_FEATURES);
 
-  /* 줾ѤǳΨ׻ */
+  /* それぞれの積で確率を計算する */
   probability = 1;
   trans_p = search_probability(trans_info_array, &seg_trans_features, 0.4f);
   seg_p = search_probability(seg_info_array, &seg_struct_features, 0.5f);
@@ -231,7 +222,7 @@ get_transition_probability(struct lattice_node *node)
   anthy_feature_list_free(&seg_trans_features);
 
   if (1) {
-    /* length biasˤ */
+    /* length biasを順方向にかける */
     probability = (1 - probability) / node->mw->len;
     probability = 1 - probability;
   }
@@ -239,42 +230,88 @@ get_transition_probability(struct lattice_node *node)
   return probability;
 }
 
-static struct lattice_info*
-alloc_lattice_info(struct splitter_context *sc, int size)
+/*
+ * node_listにはsize+1個の要素が必要
+ * ノードのアロケータはsplitterのコンテキストに置いて使い回す
+ */
+static void
+init_lattice_info(struct lattice_info *info, struct splitter_context *sc,
+		  struct node_list_head *node_list, int size)
 {
   int i;
-  struct lattice_info* info = (struct lattice_info*)malloc(sizeof(struct lattice_info));
+  struct word_split_info_cache *wsi = sc->word_split_info;
   info->sc = sc;
-  info->lattice_node_list = (struct node_list_head*)
-    malloc((size + 1) * sizeof(struct node_list_head));
+  info->lattice_node_list = node_list;
   for (i = 0; i < size + 1; i++) {
     info->lattice_node_list[i].head = NULL;
     info->lattice_node_list[i].nr_nodes = 0;
   }
-  info->node_allocator = anthy_create_allocator(sizeof(struct lattice_node),
-						NULL);
+  if (!wsi->LatticeNodeAllocator) {
+    wsi->LatticeNodeAllocator =
+      anthy_create_allocator(sizeof(struct lattice_node), NULL);
+  }
+  info->node_allocator = wsi->LatticeNodeAllocator;
   info->last_node_id = 0;
-  return info;
+}
+
+static unsigned int
+trans_prob_hash(struct meta_word *mw, enum seg_class pc)
+{
+  unsigned int h = mw->from;
+  h = h * 31 + mw->len;
+  h = h * 31 + mw->dep_word_hash;
+  h = h * 31 + mw->seg_class;
+  h = h * 31 + pc;
+  h ^= h >> 13;
+  return h & (TRANS_PROB_HASH_SIZE - 1);
+}
+
+/* 遷移確率をキャッシュから取り出す、無ければ計算して覚えておく */
+static double
+get_cached_transition_probability(struct lattice_info *info,
+				  struct lattice_node *node)
+{
+  struct word_split_info_cache *wsi = info->sc->word_split_info;
+  struct trans_prob_ent **bucket, *tp;
+  enum seg_class pc = node->before_node->seg_class;
+
+  if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_LN) {
+    /* デバッグ出力のために毎回計算する */
+    return get_transition_probability(node);
+  }
+  bucket = &wsi->trans_prob_hash[trans_prob_hash(node->mw, pc)];
+  for (tp = *bucket; tp; tp = tp->next) {
+    if (tp->mw == node->mw && tp->pc == pc) {
+      return tp->prob;
+    }
+  }
+  tp = anthy_smalloc(wsi->TransProbAllocator);
+  tp->mw = node->mw;
+  tp->pc = pc;
+  tp->prob = get_transition_probability(node);
+  tp->next = *bucket;
+  *bucket = tp;
+  return tp->prob;
 }
 
 static void
-calc_node_parameters(struct lattice_node *node)
+calc_node_parameters(struct lattice_info *info, struct lattice_node *node)
 {
-  /* бmetaword̵ʸƬȽǤ */
+  /* 対応するmetawordが無い場合は文頭と判断する */
   node->seg_class = node->mw ? node->mw->seg_class : SEG_HEAD; 
 
   if (node->before_node) {
-    /* ܤΡɤ */
+    /* 左に隣接するノードがある場合 */
     if (node->mw && (node->mw->mw_features & MW_FEATURE_OCHAIRE)) {
       node->node_probability = 1.0f;
     } else {
-      node->node_probability = get_transition_probability(node);
+      node->node_probability = get_cached_transition_probability(info, node);
     }
     node->path_probability =
       node->before_node->path_probability *
       node->node_probability;
   } else {
-    /* ܤΡɤ̵ */
+    /* 左に隣接するノードが無い場合 */
     node->path_probability = 1.0f;
   }
 }
@@ -293,7 +330,7 @@ alloc_lattice_node(struct lattice_info *info,
   node->next = NULL;
   node->mw = mw;
 
-  calc_node_parameters(node);
+  calc_node_parameters(info, node);
 
   return node;
 }
@@ -307,9 +344,7 @@ release_lattice_node(struct lattice_info *info, struct lattice_node* node)
 static void
 release_lattice_info(struct lattice_info* info)
 {
-  anthy_free_allocator(info->node_allocator);
-  free(info->lattice_node_list);
-  free(info);
+  anthy_reset_allocator(info->node_allocator);
 }
 
 static int
@@ -339,12 +374,12 @@ cmp_node_by_type_to_type(struct lattice_node *lhs, struct lattice_node *rhs,
 }
 
 /*
- * ΡɤӤ
+ * ノードを比較する
  *
- ** ֤
- * 1: lhsΨ⤤
- * 0: Ʊ
- * -1: rhsΨ⤤
+ ** 返り値
+ * 1: lhsの方が確率が高い
+ * 0: 同じ
+ * -1: rhsの方が確率が高い
  */
 static int
 cmp_node(struct lattice_node *lhs, struct lattice_node *rhs)
@@ -360,11 +395,11 @@ cmp_node(struct lattice_node *lhs, struct lattice_node *rhs)
   while (lhs_before && rhs_before) {
     if (lhs_before->mw && rhs_before->mw &&
 	lhs_before->mw->from + lhs_before->mw->len == rhs_before->mw->from + rhs_before->mw->len) {
-      /* ؽ줿Ρɤɤ򸫤 */
+      /* 学習から作られたノードかどうかを見る */
       ret = cmp_node_by_type(lhs_before, rhs_before, MW_OCHAIRE);
       if (ret != 0) return ret;
 
-      /* COMPOUND_PARTCOMPOUND_HEADͥ */
+      /* COMPOUND_PARTよりはCOMPOUND_HEADを優先 */
       ret = cmp_node_by_type_to_type(lhs_before, rhs_before,
 				     MW_COMPOUND_HEAD, MW_COMPOUND_PART);
       if (ret != 0) return ret;
@@ -375,7 +410,7 @@ cmp_node(struct lattice_node *lhs, struct lattice_node *rhs)
     rhs_before = rhs_before->before_node;
   }
 
-  /* ǸܳΨ򸫤 */
+  /* 最後に遷移確率を見る */
   if (lhs->path_probability > rhs->path_probability) {
     return 1;
   } else if (lhs->path_probability < rhs->path_probability) {
@@ -386,7 +421,7 @@ cmp_node(struct lattice_node *lhs, struct lattice_node *rhs)
 }
 
 /*
- * Υƥ˥Ρɤɲä
+ * 構成中のラティスにノードを追加する
  */
 static void
 push_node(struct lattice_info* info, struct lattice_node* new_node,
@@ -399,7 +434,7 @@ push_node(struct lattice_info* info, struct lattice_node* new_node,
     print_lattice_node(info, new_node);
   }
 
-  /* Ƭnode̵̵ɲ */
+  /* 先頭のnodeが無ければ無条件に追加 */
   node = info->lattice_node_list[position].head;
   if (!node) {
     info->lattice_node_list[position].head = new_node;
@@ -408,14 +443,14 @@ push_node(struct lattice_info* info, struct lattice_node* new_node,
   }
 
   while (node->next) {
-    /* ;פʥΡɤɲäʤλ޴ */
+    /* 余計なノードを追加しないための枝刈り */
     if (new_node->seg_class == node->seg_class &&
 	new_node->border == node->border) {
-      /* segclassƱǡϤޤ֤Ʊʤ */
+      /* segclassが同じで、始まる位置が同じなら */
       switch (cmp_node(new_node, node)) {
       case 0:
       case 1:
-	/* Ψ礭ؽˤΤʤ顢ŤΤ֤*/
+	/* 新しい方が確率が大きいか学習によるものなら、古いのと置き換え*/
 	if (previous_node) {
 	  previous_node->next = new_node;
 	} else {
@@ -425,7 +460,7 @@ push_node(struct lattice_info* info, struct lattice_node* new_node,
 	release_lattice_node(info, node);
 	break;
       case -1:
-	/* Ǥʤʤ */
+	/* そうでないなら削除 */
 	release_lattice_node(info, new_node);
 	break;
       }
@@ -435,12 +470,12 @@ push_node(struct lattice_info* info, struct lattice_node* new_node,
     node = node->next;
   }
 
-  /* ǸΥΡɤθɲ */
+  /* 最後のノードの後ろに追加 */
   node->next = new_node;
   info->lattice_node_list[position].nr_nodes ++;
 }
 
-/* ֳΨ㤤Ρɤõ*/
+/* 一番確率の低いノードを消去する*/
 static void
 remove_min_node(struct lattice_info *info, struct node_list_head *node_list)
 {
@@ -449,7 +484,7 @@ remove_min_node(struct lattice_info *info, struct node_list_head *node_list)
   struct lattice_node* min_node = node;
   struct lattice_node* previous_min_node = NULL;
 
-  /* ֳΨ㤤Ρɤõ */
+  /* 一番確率の低いノードを探す */
   while (node) {
     if (cmp_node(node, min_node) < 0) {
       previous_min_node = previous_node;
@@ -459,7 +494,7 @@ remove_min_node(struct lattice_info *info, struct node_list_head *node_list)
     node = node->next;
   }
 
-  /* ֳΨ㤤Ρɤ */
+  /* 一番確率の低いノードを削除する */
   if (previous_min_node) {
     previous_min_node->next = min_node->next;
   } else {
@@ -469,16 +504,16 @@ remove_min_node(struct lattice_info *info, struct node_list_head *node_list)
   node_list->nr_nodes --;
 }
 
-/* ӥӥ르ꥺѤƷϩ */
+/* いわゆるビタビアルゴリズムを使用して経路を選ぶ */
 static void
 choose_path(struct lattice_info* info, int to)
 {
-  /* ǸޤãܤΤʤǰֳΨ礭Τ */
+  /* 最後まで到達した遷移のなかで一番確率の大きいものを選ぶ */
   struct lattice_node* node;
   struct lattice_node* best_node = NULL;
   int last = to; 
   while (!info->lattice_node_list[last].head) {
-    /* ǸʸޤܤƤʤä */
+    /* 最後の文字まで遷移していなかったら後戻り */
     --last;
   }
   for (node = info->lattice_node_list[last].head; node; node = node->next) {
@@ -490,7 +525,7 @@ choose_path(struct lattice_info* info, int to)
     return;
   }
 
-  /* ܤդˤɤĤʸڤܤϿ */
+  /* 遷移を逆にたどりつつ文節の切れ目を記録 */
   node = best_node;
   if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_LP) {
     printf("choose_path()\n");
@@ -516,34 +551,34 @@ build_graph(struct lattice_info* info, int from, int to)
   struct lattice_node* node;
   struct lattice_node* left_node;
 
-  /* ȤʤΡɤɲ */
+  /* 始点となるノードを追加 */
   node = alloc_lattice_node(info, NULL, NULL, from);
   push_node(info, node, from);
 
-  /* info->lattice_node_list[index]ˤindexޤǤܤäƤΤǤäơ
-   * indexܤäƤΤǤϤʤ 
+  /* info->lattice_node_list[index]にはindexまでの遷移が入っているのであって、
+   * indexからの遷移が入っているのではない 
    */
 
-  /* Ƥܤ򺸤 */
+  /* 全ての遷移を左から試す */
   for (i = from; i < to; ++i) {
     for (left_node = info->lattice_node_list[i].head; left_node;
 	 left_node = left_node->next) {
       struct meta_word *mw;
-      /* iʸܤãlattice_nodeΥ롼 */
+      /* i文字目に到達するlattice_nodeのループ */
 
       for (mw = info->sc->word_split_info->cnode[i].mw; mw; mw = mw->next) {
 	int position;
 	struct lattice_node* new_node;
-	/* iʸܤmeta_wordΥ롼 */
+	/* i文字目からのmeta_wordのループ */
 
 	if (mw->can_use != ok) {
-	  continue; /* 줿ʸζڤޤmetawordϻȤʤ */
+	  continue; /* 決められた文節の区切りをまたぐmetawordは使わない */
 	}
 	position = i + mw->len;
 	new_node = alloc_lattice_node(info, left_node, mw, i);
 	push_node(info, new_node, position);
 
-	/* θ䤬¿顢Ψ㤤 */
+	/* 解の候補が多すぎたら、確率の低い方から削る */
 	if (info->lattice_node_list[position].nr_nodes >= NODE_MAX_SIZE) {
 	  remove_min_node(info, &info->lattice_node_list[position]);
 	}
@@ -551,7 +586,7 @@ build_graph(struct lattice_info* info, int from, int to)
     }
   }
 
-  /* ʸ */
+  /* 文末補正 */
   for (node = info->lattice_node_list[to].head; node; node = node->next) {
     struct feature_list features;
     double prob;
@@ -571,12 +606,14 @@ build_graph(struct lattice_info* info, int from, int to)
 void
 anthy_mark_borders(struct splitter_context *sc, int from, int to)
 {
-  struct lattice_info* info = alloc_lattice_info(sc, to);
+  struct lattice_info info;
+  init_lattice_info(&info, sc,
+		    alloca(sizeof(struct node_list_head) * (to + 1)), to);
   trans_info_array = anthy_file_dic_get_section("trans_info");
   seg_info_array = anthy_file_dic_get_section("seg_info");
   yomi_info_array = anthy_file_dic_get_section("yomi_info");
   seg_len_info_array = anthy_file_dic_get_section("seg_len_info");
-  build_graph(info, from, to);
-  choose_path(info, to);
-  release_lattice_info(info);
+  build_graph(&info, from, to);
+  choose_path(&info, to);
+  release_lattice_info(&info);
 }
@@ -1,12 +1,12 @@
 /*
- * ʸ⤷ñİʾ奻åȤˤmetawordȤư
- * ǤϳƼmetaword
+ * 文節もしくは単語を一つ以上セットにしてmetawordとして扱う。
+ * ここでは各種のmetawordを生成する
  *
- * init_metaword_tab() metawordΤξ
- * anthy_make_metaword_all() contextmetaword
- * anthy_print_metaword() ꤵ줿metawordɽ
+ * init_metaword_tab() metaword処理のための情報を構成する
+ * anthy_make_metaword_all() context中のmetawordを構成する
+ * anthy_print_metaword() 指定されたmetawordを表示する
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 10/29
+ * Funded by IPA未踏ソフトウェア創造事業 2001 10/29
  * Copyright (C) 2000-2006 TABATA Yusuke
  * Copyright (C) 2004-2006 YOSHIDA Yuichi
  * Copyright (C) 2000-2003 UGAWA Tomoharu
@@ -22,7 +22,7 @@
 #include <anthy/segclass.h>
 #include "wordborder.h"
 
-/* Ƽmeta_wordɤΤ褦˽뤫 */
+/* 各種meta_wordをどのように処理するか */
 struct metaword_type_tab_ anthy_metaword_type_tab[] = {
   {MW_DUMMY,"dummy",MW_STATUS_NONE,MW_CHECK_SINGLE},
   {MW_SINGLE,"single",MW_STATUS_NONE,MW_CHECK_SINGLE},
@@ -43,14 +43,14 @@ struct metaword_type_tab_ anthy_metaword_type_tab[] = {
 static void
 combine_metaword(struct splitter_context *sc, struct meta_word *mw);
 
-/* ƥmetawordɲä */
+/* コンテキスト中にmetawordを追加する */
 void
 anthy_commit_meta_word(struct splitter_context *sc,
 		       struct meta_word *mw)
 {
   struct word_split_info_cache *info = sc->word_split_info;
   xstr xs;
-  /* ƱĥΡɤΥꥹ */
+  /* 同じ開始点を持つノードのリスト */
   mw->next = info->cnode[mw->from].mw;
   info->cnode[mw->from].mw = mw;
   /**/
@@ -156,7 +156,7 @@ alloc_metaword(struct splitter_context *sc)
 
 
 /*
- * wlƬʬʬʸȤƼФ
+ * wlの接頭辞部分と接尾辞部分を文字列として取り出す
  */
 static void
 get_surrounding_text(struct splitter_context* sc,
@@ -173,7 +173,7 @@ get_surrounding_text(struct splitter_context* sc,
 }
 
 /*
- * ʣǤwln֤ʬФmwˤ
+ * 複合語であるwlからn番めの部分を取り出してmwにする
  */
 static struct meta_word*
 make_compound_nth_metaword(struct splitter_context* sc, 
@@ -220,7 +220,7 @@ make_compound_nth_metaword(struct splitter_context* sc,
 
 
 /*
- * metawordºݤ˷礹
+ * metawordを実際に結合する
  */
 static struct meta_word *
 anthy_do_cons_metaword(struct splitter_context *sc,
@@ -250,7 +250,7 @@ anthy_do_cons_metaword(struct splitter_context *sc,
 }
 
 /*
- * ʣѤmeta_word롣
+ * 複合語用のmeta_wordを作成する。
  */
 static void
 make_compound_metaword_tree(struct splitter_context* sc, struct word_list* wl)
@@ -282,7 +282,7 @@ make_compound_metaword_tree(struct splitter_context* sc, struct word_list* wl)
 }
 
 /*
- * ʣθġʸ礷meta_word롣
+ * 複合語の中の個々の文節を結合したmeta_wordを作成する。
  */
 static void
 make_sub_compound_metaword(struct splitter_context* sc, struct word_list* wl)
@@ -305,8 +305,8 @@ make_sub_compound_metaword(struct splitter_context* sc, struct word_list* wl)
     ce = anthy_get_nth_compound_ent(se, i);
     seg_num = anthy_compound_get_nr_segments(ce);
 
-    /* start_segend_segޤǤʸ˺
-     * (ʸᤫ) */
+    /* start_segからend_segまでの文節を順に作る
+     * (後ろの文節から) */
     for (end_seg = seg_num - 1; end_seg >= 0; --end_seg) {
       mw = make_compound_nth_metaword(sc, ce, end_seg, wl, MW_COMPOUND_PART);
       for (start_seg = end_seg - 1; start_seg >= 0; --start_seg) {
@@ -323,7 +323,7 @@ make_sub_compound_metaword(struct splitter_context* sc, struct word_list* wl)
 }
 
 /*
- * ñʸñ
+ * 単文節単語
  */
 static void
 make_simple_metaword(struct splitter_context *sc, struct word_list* wl)
@@ -345,7 +345,7 @@ make_simple_metaword(struct splitter_context *sc, struct word_list* wl)
 }
 
 /*
- * wordlistĤʤ롢metaword
+ * wordlist一個からなる、metawordを作成
  */
 static void
 make_metaword_from_word_list(struct splitter_context *sc)
@@ -366,7 +366,7 @@ make_metaword_from_word_list(struct splitter_context *sc)
 }
 
 /*
- * metawordꥹ˷礹
+ * metawordをリスト風に結合する
  */
 static struct meta_word *
 list_metaword(struct splitter_context *sc,
@@ -382,7 +382,7 @@ list_metaword(struct splitter_context *sc,
 }
 
 /*
- * ưϢѷ + ƻ첽 ֡䤹פʤ
+ * 動詞連用形 + 形容詞化接尾語 「〜しやすい」など
  */
 static void
 try_combine_v_renyou_a(struct splitter_context *sc,
@@ -393,7 +393,7 @@ try_combine_v_renyou_a(struct splitter_context *sc,
   if (mw->wl->head_pos == POS_V &&
       mw->wl->tail_ct == CT_RENYOU &&
       anthy_wtype_get_pos(w2) == POS_D2KY) {
-    /* ƻǤϤΤǼΥå */
+    /* 形容詞ではあるので次のチェック */
     if (anthy_get_seq_ent_wtype_freq(mw2->wl->part[PART_CORE].seq, 
 				     anthy_wtype_a_tail_of_v_renyou)) {
       list_metaword(sc, MW_V_RENYOU_A, mw, mw2);
@@ -402,7 +402,7 @@ try_combine_v_renyou_a(struct splitter_context *sc,
 }
 
 /*
- * ưϢѷ + ư첽 ֡ľפʤ
+ * 動詞連用形 + 動詞化接尾辞 「〜直す」など
  */
 static void
 try_combine_v_renyou_v(struct splitter_context *sc,
@@ -418,7 +418,7 @@ try_combine_v_renyou_v(struct splitter_context *sc,
 }
 
 /*
- * ưϢѷ + ̾첽(#D2T35)  (Τ)פʤ
+ * 動詞連用形 + 名詞化接尾語(#D2T35) 「入れ たて(のお茶)」など
  */
 static void
 try_combine_v_renyou_noun(struct splitter_context *sc,
@@ -435,7 +435,7 @@ try_combine_v_renyou_noun(struct splitter_context *sc,
 }
 
 /*
- * 礹
+ * 数字を結合する
  */
 static void
 try_combine_number(struct splitter_context *sc,
@@ -444,44 +444,44 @@ try_combine_number(struct splitter_context *sc,
   struct word_list *wl1 = mw1->wl;
   struct word_list *wl2 = mw2->wl;
   struct meta_word *combined_mw;
-  int recursive = wl2 ? 0 : 1; /* combinedmw礹1 */
+  int recursive = wl2 ? 0 : 1; /* combinedなmwを結合する場合1 */
 
-  /* mwϿ */
+  /* 左mwは数詞 */
 
   if (anthy_wtype_get_pos(wl1->part[PART_CORE].wt) != POS_NUMBER) return;  
   if (recursive) {
-    /* mwϿ礷mw */
+    /* 右mwは数字を結合したmw */
     if (mw2->type != MW_NUMBER) return;
     wl2 = mw2->mw1->wl;
   } else {
-    /* mwϿ */
+    /* 右mwは数詞 */
     if (anthy_wtype_get_pos(wl2->part[PART_CORE].wt) != POS_NUMBER) return;    
   }
-  /* mwθʸդƤʤ */
+  /* 左mwの後ろに文字が付いていなければ */
   if (wl1->part[PART_POSTFIX].len == 0 &&
       wl1->part[PART_DEPWORD].len == 0) {
     int scos1 = anthy_wtype_get_scos(wl1->part[PART_CORE].wt);
     int scos2 = anthy_wtype_get_scos(wl2->part[PART_CORE].wt);
 
-    /* #NNоݳ */
+    /* #NNは対象外 */
     if (scos2 == SCOS_NONE) return;
     /* 
-       mwμˤäơˤĤȤǤ뱦mwμबѤ
-       㤨аθˤ岯ĤȤǤʤ
-       彽θˤϡ碌ưʤɤĤȤǤ
+       左mwの種類によって、後ろにつくことができる右mwの種類が変わる
+       例えば一〜九の後ろには万〜九万、億〜九億しかつくことができないが、
+       十〜九十の後ろには、あわせて一〜九などもつくことができる
      */
     switch (scos1) {
     case SCOS_N1: 
-      if (scos2 == SCOS_N1) return; /* ˰夬ĤƤϤʤ */
+      if (scos2 == SCOS_N1) return; /* 後ろに一〜九がついてはいけない */
     case SCOS_N10:
-      if (scos2 == SCOS_N10) return; /* ˽彽ĤƤϤʤ */
+      if (scos2 == SCOS_N10) return; /* 後ろに十〜九十がついてはいけない */
     case SCOS_N100:
-      if (scos2 == SCOS_N100) return; /* ɴɴĤƤϤʤ */
+      if (scos2 == SCOS_N100) return; /* 後ろに百〜九百がついてはいけない */
     case SCOS_N1000:
-      if (scos2 == SCOS_N1000) return; /* 餬ĤƤϤʤ */
+      if (scos2 == SCOS_N1000) return; /* 後ろに千〜九千がついてはいけない */
     case SCOS_N10000:
-      /* 岯Ĥʤɤϡ
-	 ĤǤˤĤȤǤ */
+      /* 万〜九万、億〜九億…などは、
+	 いつでも後ろにつくことができる */
       break;
     default:
       return;
@@ -490,22 +490,22 @@ try_combine_number(struct splitter_context *sc,
     if (recursive) {
       combined_mw = anthy_do_cons_metaword(sc, MW_NUMBER, mw1, mw2);
     } else {
-      /* Ʒ礹ϸnullĤlistˤ */
+      /* 初めて結合する場合は後ろにnullをつけてlistにする */
       combined_mw = list_metaword(sc, MW_NUMBER, mw1, mw2);
     }
     combine_metaword(sc, combined_mw);
   }
 }
 
-/* ٤metawordȷǤ뤫å */
+/* 右隣のmetawordと結合できるかチェック */
 static void
 try_combine_metaword(struct splitter_context *sc,
 		     struct meta_word *mw1, struct meta_word *mw2)
 {
   if (!mw1->wl) return;
 
-  /* metawordηԤˤϡ³
-     metawordƬʤȤɬ */
+  /* metawordの結合を行うためには、後続の
+     metawordに接頭辞がないことが必要 */
   if (mw2->wl && mw2->wl->part[PART_PREFIX].len > 0) {
     return;
   }
@@ -525,7 +525,7 @@ combine_metaword(struct splitter_context *sc, struct meta_word *mw)
   int i;
 
   if (mw->mw_features & MW_FEATURE_DEP_ONLY) {
-    /* °ʸȤϷ礷ʤ */  
+    /* 付属語だけの文節とは結合しない */  
     return;
   }
 
@@ -533,7 +533,7 @@ combine_metaword(struct splitter_context *sc, struct meta_word *mw)
     struct meta_word *mw_left;
     for (mw_left = info->cnode[i].mw; mw_left; mw_left = mw_left->next) {
       if (mw_left->from + mw_left->len == mw->from) {
-	/* Ǥ뤫å */
+	/* 結合できるかチェック */
 	try_combine_metaword(sc, mw_left, mw);
       }
     }
@@ -546,10 +546,10 @@ combine_metaword_all(struct splitter_context *sc)
   int i;
 
   struct word_split_info_cache *info = sc->word_split_info;
-  /* metawordκüˤ롼 */
+  /* metawordの左端によるループ */
   for (i = sc->char_count - 1; i >= 0; i--){
     struct meta_word *mw;
-    /* metawordΥ롼 */
+    /* 各metawordのループ */
     for (mw = info->cnode[i].mw;
 	 mw; mw = mw->next) {
       combine_metaword(sc, mw);
@@ -578,7 +578,7 @@ make_dummy_metaword(struct splitter_context *sc, int from,
 }
 
 /*
- * ʸ򿭤Ф餽ФƤ
+ * 文節を伸ばしたらそれを覚えておく
  */
 static void
 make_expanded_metaword_all(struct splitter_context *sc)
@@ -589,12 +589,12 @@ make_expanded_metaword_all(struct splitter_context *sc)
   }
   for (i = 0; i < sc->char_count; i++) {
     for (j = 1; j < sc->char_count - i; j++) {
-      /* ƤʬʸФ */
+      /* 全ての部分文字列に対して */
       xstr xs;
       xs.len = j;
       xs.str = sc->ce[i].c;
       if (anthy_select_row(&xs, 0) == 0) {
-	/* ʬʸϲ˳оݤȤʤä */
+	/* この部分文字列は過去に拡大の対象となった */
         int k;
         int nr = anthy_get_nr_values();
         for (k = 0; k < nr; k++) {
@@ -614,7 +614,7 @@ make_expanded_metaword_all(struct splitter_context *sc)
   }
 }
 
-/* ؽmetaword */
+/* お茶入れ学習のmetawordを作る */
 static void
 make_ochaire_metaword(struct splitter_context *sc,
 		      int from, int len)
@@ -629,13 +629,13 @@ make_ochaire_metaword(struct splitter_context *sc,
 
   (void)len;
 
-  /* ʸ */
+  /* 文節数を取得 */
   count = anthy_get_nth_value(0);
-  /* ֱʸΤʸιפ׻ */
+  /* 一番右の文節をのぞいた文字数の合計を計算 */
   for (s = 0, j = 0; j < count - 1; j++) {
     s += anthy_get_nth_value(j * 2 + 1);
   }
-  /* ֱʸmetaword */
+  /* 一番右の文節のmetawordを構成 */
   xs = anthy_get_nth_xstr((count - 1) * 2 + 2);
   if (!xs) {
     return ;
@@ -650,7 +650,7 @@ make_ochaire_metaword(struct splitter_context *sc,
   anthy_xstrcpy(&mw->cand_hint, xs);
   anthy_commit_meta_word(sc, mw);
   mw_len += seg_len;
-  /* ʳʸmetaword */
+  /* それ以外の文節でmetawordを構成 */
   for (j-- ; j >= 0; j--) {
     struct meta_word *n;
     seg_len = anthy_get_nth_value(j * 2 + 1);
@@ -661,7 +661,7 @@ make_ochaire_metaword(struct splitter_context *sc,
     }
     n = alloc_metaword(sc);
     n->type = MW_OCHAIRE;
-    /* metawordĤʤ */
+    /* 右のmetawordをつなぐ */
     n->mw1 = mw;
     n->from = from + s;
     n->len = seg_len;
@@ -691,28 +691,28 @@ try_ochaire_metaword(struct splitter_context *sc,
     }
 
     make_ochaire_metaword(sc, from, key->len);
-    /* 󸫤Ĥä meta_word μʸϤ */
+    /* 今回見つかった meta_word の次の文字から始める */
     return from + key->len;
   }
   return from + 1;
 }
 
 /*
- * ʣʸȤ򤫤鸡
+ * 複数の文節の組を履歴から検索する
  */
 static void
 make_ochaire_metaword_all(struct splitter_context *sc)
 {
   int i;
 
-  /* Τ򥫥СؽС */
+  /* 入力全体をカバーする学習があれば、それを利用 */
   if (!anthy_select_section("OCHAIRE_FULL_SEG", 0)) {
     if (try_ochaire_metaword(sc, 0, 1) > 1) {
       return ;
     }
   }
 
-  /* ϤʬФؽ */
+  /* 入力の部分に対する学習を利用 */
   if (anthy_select_section("OCHAIRE", 0) == -1) {
     return ;
   }
@@ -735,7 +735,7 @@ add_dummy_metaword(struct splitter_context *sc,
   anthy_commit_meta_word(sc, n);
 }
 
-/* ꤷmetawordwrapjʸĹmeta_word */
+/* 指定したmetawordをwrapしてj文字長いmeta_wordを作る */
 static void
 expand_meta_word(struct splitter_context *sc,
 		 struct meta_word *mw, int from, int len,
@@ -762,7 +762,7 @@ expand_meta_word(struct splitter_context *sc,
 }
 
 /*
- * metawordθλ¿ʸ򤯤äĤmetaword
+ * metawordの後ろの雑多な文字をくっつけたmetawordを構成する
  */
 static void
 make_metaword_with_depchar(struct splitter_context *sc,
@@ -773,18 +773,18 @@ make_metaword_with_depchar(struct splitter_context *sc,
   int from = mw ? mw->from : 0;
   int len = mw ? mw->len : 0;
 
-  /* metawordľʸμĴ٤ */
+  /* metawordの直後の文字の種類を調べる */
   int type = anthy_get_xchar_type(*sc->ce[from + len].c);
   if (!(type & XCT_SYMBOL) &&
       !(type & XCT_PART)) {
     return;
   }
   if (type & XCT_PUNCTUATION) {
-    /* ʤ̤ʸˤ */
+    /* 句読点ならば別の文節にする */
     return ;
   }
 
-  /* ƱʸǤʤФäĤΤ򤦤 */
+  /* 同じ種類の文字でなければくっつけるのをうちきり */
   for (j = 0; from + len + j < sc->char_count; j++) {
     int p = from + len + j;
     if ((anthy_get_xchar_type(*sc->ce[p].c) != type)) {
@@ -796,9 +796,9 @@ make_metaword_with_depchar(struct splitter_context *sc,
     }
   }
 
-  /* Υ롼פȴjˤΩǤʤʸοäƤ */
+  /* 上のループを抜けた時、jには独立できない文字の数が入っている */
 
-  /* ΩǤʤʸΤǡդmetaword */
+  /* 独立できない文字があるので、それを付けたmetawordを作る */
   if (j > 0) {
     expand_meta_word(sc, mw, from, len, destroy_seg_class, j);
   }
@@ -810,7 +810,7 @@ make_metaword_with_depchar_all(struct splitter_context *sc)
   int i;
   struct word_split_info_cache *info = sc->word_split_info;
 
-  /* metawordФ */
+  /* 全metawordに対して */
   for (i = 0; i < sc->char_count; i++) {
     struct meta_word *mw;
     for (mw = info->cnode[i].mw;
@@ -822,7 +822,7 @@ make_metaword_with_depchar_all(struct splitter_context *sc)
       add_dummy_metaword(sc, i);
     }
   }
-  /* ʸκüϤޤ */
+  /* 文の左端から始まるもの */
   make_metaword_with_depchar(sc, NULL);
 }
 
@@ -876,24 +876,24 @@ anthy_mark_border_by_metaword(struct splitter_context* sc,
 void
 anthy_make_metaword_all(struct splitter_context *sc)
 {
-  /* ޤword_listĤmetaword */
+  /* まず、word_list一個のmetawordを作る */
   make_metaword_from_word_list(sc);
 
-  /* metaword礹 */
+  /* metawordを結合する */
   combine_metaword_all(sc);
 
-  /* 礵줿ʸ */
+  /* 拡大された文節を処理する */
   make_expanded_metaword_all(sc);
 
-  /* Ĺʤɤε桢¾ε */
+  /* 濁点や長音などの記号、その他の記号を処理 */
   make_metaword_with_depchar_all(sc);
 
-  /* 򤤤 */
+  /* おちゃをいれる */
   make_ochaire_metaword_all(sc);
 }
 
 /* 
- * ꤵ줿ΰ򥫥Сmetaword 
+ * 指定された領域をカバーするmetawordを数える 
  */
 int
 anthy_get_nr_metaword(struct splitter_context *sc,
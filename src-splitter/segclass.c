@@ -10,18 +10,18 @@ static struct {
   const char *sym;
 } seg_class_tab[] = {
   /* 0 */
-  {"ʸƬ", "H"}, {"ʸ", "T"}, {"ʸ", "B"},
-  {"³", "C"}, {"̾+ʽ", "Nk"}, {"̾+ü", "Ne"},
-  {"ư+°", "Vf"}, {"ư+ü", "Ve"}, {"ƻ", "A"},
-  {"ư", "AJV"},
+  {"文頭", "H"}, {"文末", "T"}, {"文節", "B"},
+  {"接続語", "C"}, {"名詞+格助詞", "Nk"}, {"名詞+終端", "Ne"},
+  {"動詞+付属語", "Vf"}, {"動詞+終端", "Ve"}, {"形容詞", "A"},
+  {"形容動詞", "AJV"},
   /* 10 */
-  {"Ϣѽ", "YM"}, {"Ϣν", "TM"},
-  {"̾", "N"}, {"̾+°", "Nf"}, {"̾+Ϣ", "Ny"},
-  {"ư+Ϣ", "Vy"},
-  {"ư+Ϣ", "Vt"},
-  {"̾Ƭ", "P"},
-  {"̾", "S"},
-  {"̾", "CS"},
+  {"連用修飾", "YM"}, {"連体修飾", "TM"},
+  {"名詞", "N"}, {"名詞+付属語", "Nf"}, {"名詞+連用", "Ny"},
+  {"動詞+連用", "Vy"},
+  {"動詞+連体", "Vt"},
+  {"名詞接頭辞", "P"},
+  {"名詞接尾辞", "S"},
+  {"地名接尾辞", "CS"},
   /* 20 */
   {NULL, NULL}
 };
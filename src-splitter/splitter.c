@@ -1,14 +1,15 @@
 /*
- * ʸʸsplitsplitter
+ * 文を文節にsplitするsplitter
  *
- * ʸζ򸡽Ф
- *  anthy_init_split_context() ʬѤΥƥȤä
- *  anthy_mark_border() ʬ򤷤
- *  anthy_release_split_context() ƥȤ
+ * 文節の境界を検出する
+ *  anthy_init_split_context() 分割用のコンテキストを作って
+ *  anthy_mark_border() 分割をして
+ *  anthy_release_split_context() コンテキストを解放する
+ *  (作業領域は次の変換で使い回し、anthy_free_split_context()で解放する)
  *
- *  anthy_commit_border() ߥåȤ줿ƤФƳؽ򤹤
+ *  anthy_commit_border() コミットされた内容に対して学習をする
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 9/22
+ * Funded by IPA未踏ソフトウェア創造事業 2001 9/22
  *
  * Copyright (C) 2004 YOSHIDA Yuichi
  * Copyright (C) 2000-2004 TABATA Yusuke
@@ -55,20 +56,44 @@ wtype_t anthy_wtype_name_postfix;
 wtype_t anthy_wtype_sv_postfix;
 wtype_t anthy_wtype_a_tail_of_v_renyou;
 wtype_t anthy_wtype_v_renyou;
-wtype_t anthy_wtype_noun_tail;/* ֤ơפȤ */
+wtype_t anthy_wtype_noun_tail;/* いれ「たて」とか */
 wtype_t anthy_wtype_n1;
 wtype_t anthy_wtype_n10;
 
 
-/** make_word_cacheǺʸ
+/** make_word_cacheで作成した文節情報を解放する
+ *  作業領域とアロケータのページは次の変換のために残しておく
  */
 static void
 release_info_cache(struct splitter_context *sc)
 {
   struct word_split_info_cache *info = sc->word_split_info;
 
+  anthy_reset_allocator(info->MwAllocator);
+  anthy_reset_allocator(info->WlAllocator);
+  anthy_reset_allocator(info->DepAllocator);
+  anthy_reset_allocator(info->TransProbAllocator);
+  if (info->LatticeNodeAllocator) {
+    anthy_reset_allocator(info->LatticeNodeAllocator);
+  }
+}
+
+/** 作業領域を全て解放する */
+static void
+free_info_cache(struct splitter_context *sc)
+{
+  struct word_split_info_cache *info = sc->word_split_info;
+
   anthy_free_allocator(info->MwAllocator);
   anthy_free_allocator(info->WlAllocator);
+  anthy_free_allocator(info->DepAllocator);
+  anthy_free_allocator(info->TransProbAllocator);
+  if (info->LatticeNodeAllocator) {
+    anthy_free_allocator(info->LatticeNodeAllocator);
+  }
+  free(info->dep_scan);
+  free(info->wl_hash);
+  free(info->trans_prob_hash);
   free(info->cnode);
   free(info->seq_len);
   free(info->rev_seq_len);
@@ -85,57 +110,101 @@ metaword_dtor(void *p)
 }
 
 
+static void
+dep_scan_dtor(void *p)
+{
+  struct dep_scan *ds = (struct dep_scan *)p;
+  free(ds->outcomes);
+}
+
+/*
+ * len文字分の作業領域を確保する
+ * 確保した領域はfree_info_cacheまで解放せずに、最大の長さまで伸ばして使い回す
+ */
+static void
+reserve_buffers(struct splitter_context *sc, int len)
+{
+  struct word_split_info_cache *info = sc->word_split_info;
+  int size = len + 1;
+
+  if (!info) {
+    info = malloc(sizeof(struct word_split_info_cache));
+    sc->word_split_info = info;
+    info->MwAllocator = anthy_create_allocator(sizeof(struct meta_word),
+					       metaword_dtor);
+    info->WlAllocator = anthy_create_allocator(sizeof(struct word_list), 0);
+    info->DepAllocator = anthy_create_allocator(sizeof(struct dep_scan),
+						dep_scan_dtor);
+    info->TransProbAllocator =
+      anthy_create_allocator(sizeof(struct trans_prob_ent), 0);
+    /* lattice_nodeのアロケータはlattice.cで作る */
+    info->LatticeNodeAllocator = NULL;
+    info->wl_hash = malloc(sizeof(struct word_list *) * WL_HASH_SIZE);
+    info->trans_prob_hash =
+      malloc(sizeof(struct trans_prob_ent *) * TRANS_PROB_HASH_SIZE);
+    info->dep_scan = NULL;
+    info->cnode = NULL;
+    info->seq_len = NULL;
+    info->rev_seq_len = NULL;
+  }
+  if (size <= sc->nr_reserved) {
+    return ;
+  }
+  sc->ce = realloc(sc->ce, sizeof(struct char_ent) * size);
+  info->dep_scan = realloc(info->dep_scan, sizeof(struct dep_scan *) * size);
+  info->cnode = realloc(info->cnode, sizeof(struct char_node) * size);
+  info->seq_len = realloc(info->seq_len, sizeof(int) * size);
+  info->rev_seq_len = realloc(info->rev_seq_len, sizeof(int) * size);
+  sc->nr_reserved = size;
+}
+
 static void
 alloc_char_ent(xstr *xs, struct splitter_context *sc)
 {
   int i;
  
   sc->char_count = xs->len;
-  sc->ce = (struct char_ent*)
-    malloc(sizeof(struct char_ent)*(xs->len + 1));
   for (i = 0; i <= xs->len; i++) {
     sc->ce[i].c = &xs->str[i];
     sc->ce[i].seg_border = 0;
     sc->ce[i].initial_seg_len = 0;
+    sc->ce[i].fixed_border = 0;
     sc->ce[i].best_seg_class = SEG_HEAD;
     sc->ce[i].best_mw = NULL;
   }
  
-  /* ξüʸζǤ */
+  /* 左右両端は文節の境界である */
   sc->ce[0].seg_border = 1;
   sc->ce[xs->len].seg_border = 1;
 }
 
-/*  ǳݤƤrelease_info_cacheǲ 
+/*  ここで初期化した内容はrelease_info_cacheで解放される 
  */
 static void
 alloc_info_cache(struct splitter_context *sc)
 {
   int i;
-  struct word_split_info_cache *info;
-
-  /* åΥǡ */
-  sc->word_split_info = malloc(sizeof(struct word_split_info_cache));
-  info = sc->word_split_info;
-  info->MwAllocator = anthy_create_allocator(sizeof(struct meta_word), metaword_dtor);
-  info->WlAllocator = anthy_create_allocator(sizeof(struct word_list), 0);
-  info->cnode =
-    malloc(sizeof(struct char_node) * (sc->char_count + 1));
+  struct word_split_info_cache *info = sc->word_split_info;
 
-  info->seq_len = malloc(sizeof(int) * (sc->char_count + 1));
-  info->rev_seq_len = malloc(sizeof(int) * (sc->char_count + 1));
+  for (i = 0; i < WL_HASH_SIZE; i++) {
+    info->wl_hash[i] = NULL;
+  }
+  for (i = 0; i < TRANS_PROB_HASH_SIZE; i++) {
+    info->trans_prob_hash[i] = NULL;
+  }
 
-  /* ʸǥåФƽԤ */
+  /* 各文字インデックスに対して初期化を行う */
   for (i = 0; i <= sc->char_count; i++) {
     info->seq_len[i] = 0;
     info->rev_seq_len[i] = 0;
+    info->dep_scan[i] = NULL;
     info->cnode[i].wl = NULL;
     info->cnode[i].mw = NULL;
     info->cnode[i].max_len = 0;
   }
 }
 
-/** ƤӽФwordsplitterΥȥåץ٥δؿ */
+/** 外から呼び出されるwordsplitterのトップレベルの関数 */
 void
 anthy_mark_border(struct splitter_context *sc,
 		  int from, int from2, int to)
@@ -148,7 +217,7 @@ anthy_mark_border(struct splitter_context *sc,
     return ;
   }
 
-  /* ޡѤlatticeθѤ륯饹Ѥΰ */
+  /* 境界マーク用とlatticeの検索で用いられるクラス用の領域を確保 */
   info = sc->word_split_info;
   info->seg_border = alloca(sizeof(int)*(sc->char_count + 1));
   info->best_seg_class = alloca(sizeof(enum seg_class)*(sc->char_count + 1));
@@ -159,7 +228,7 @@ anthy_mark_border(struct splitter_context *sc,
     info->best_mw[i] = sc->ce[i].best_mw;
   }
 
-  /* ꤹ */
+  /* 境界を決定する */
   anthy_eval_border(sc, from, from2, to);
 
   for (i = from; i < to; ++i) {
@@ -169,7 +238,7 @@ anthy_mark_border(struct splitter_context *sc,
   }
 }
 
-/* ʸ᤬礵줿Τǡؽ */
+/* 文節が拡大されたので，それを学習する */
 static void
 proc_expanded_segment(struct splitter_context *sc,
 		      int from, int len)
@@ -192,7 +261,7 @@ proc_expanded_segment(struct splitter_context *sc,
   for (i = 0; i < nr; i ++) {
     xs = anthy_get_nth_xstr(i);
     if (!xs || !anthy_xstrcmp(xs, &to_xs)) {
-      /* ˤ */
+      /* 既にある */
       return ;
     }
   }
@@ -200,16 +269,16 @@ proc_expanded_segment(struct splitter_context *sc,
   anthy_truncate_section(MAX_EXPAND_PAIR_ENTRY_COUNT);
 }
 
-/* ʸΥޡȸؽ */
+/* 文節のマージと語尾を学習する */
 void
 anthy_commit_border(struct splitter_context *sc, int nr_segments,
 		    struct meta_word **mw, int *seg_len)
 {
   int i, from = 0;
 
-  /* Фʸ */
+  /* 伸ばした文節 */
   for (i = 0; i < nr_segments; i++) {
-    /* 줾ʸФ */
+    /* それぞれの文節に対して */
 
     int len = seg_len[i];
     int initial_len = sc->ce[from].initial_seg_len;
@@ -217,12 +286,12 @@ anthy_commit_border(struct splitter_context *sc, int nr_segments,
     int l2;
 
     if (!initial_len || from + initial_len == sc->char_count) {
-      /* ϶ǤϤʤ */
+      /* そこは境界ではない */
       goto tail;
     }
     l2 = sc->ce[from + initial_len].initial_seg_len;
     if (initial_len + l2 > len) {
-      /* ٤ʸޤۤɳ礵줿櫓ǤϤʤ */
+      /* 隣の文節を含むほど拡大されたわけではない */
       goto tail;
     }
     if (mw[i]) {
@@ -231,7 +300,7 @@ anthy_commit_border(struct splitter_context *sc, int nr_segments,
     if (real_len <= initial_len) {
       goto tail;
     }
-    /* ʸޤĹ˳ĥ줿ʸ᤬ߥåȤ줿 */
+    /* 右の文節を含む長さに拡張された文節がコミットされた */
     proc_expanded_segment(sc, from, real_len);
   tail:
     from += len;
@@ -247,36 +316,53 @@ anthy_splitter_debug_flags(void)
 void
 anthy_init_split_context(xstr *xs, struct splitter_context *sc, int is_reverse)
 {
+  reserve_buffers(sc, xs->len);
   alloc_char_ent(xs, sc);
   alloc_info_cache(sc);
   sc->is_reverse = is_reverse;
-  /* Ƥʬʸåơʸθ󤹤
-     word_listƤmetaword */
-  anthy_lock_dic();
+  /* 全ての部分文字列をチェックして、文節の候補を列挙する
+     word_listを構成してからmetawordを構成する */
+  anthy_lock_dic_shared();
   anthy_make_word_list_all(sc);
   anthy_unlock_dic();
   anthy_make_metaword_all(sc);
 
 }
 
+/** len文字までの変換で使う作業領域を前もって確保しておく */
+void
+anthy_reserve_split_context(struct splitter_context *sc, int len)
+{
+  reserve_buffers(sc, len);
+}
+
 void
 anthy_release_split_context(struct splitter_context *sc)
 {
   if (sc->word_split_info) {
     release_info_cache(sc);
+  }
+}
+
+void
+anthy_free_split_context(struct splitter_context *sc)
+{
+  if (sc->word_split_info) {
+    free_info_cache(sc);
     sc->word_split_info = 0;
   }
   if (sc->ce) {
     free(sc->ce);
     sc->ce = 0;
   }
+  sc->nr_reserved = 0;
 }
 
-/** splitterΤνԤ */
+/** splitter全体の初期化を行う */
 int
 anthy_init_splitter(void)
 {
-  /* ǥХåץȤ */
+  /* デバッグプリントの設定 */
   char *en = getenv("ANTHY_ENABLE_DEBUG_PRINT");
   char *dis = getenv("ANTHY_DISABLE_DEBUG_PRINT");
   splitter_debug_flags = SPLITTER_DEBUG_NONE;
@@ -303,25 +389,25 @@ anthy_init_splitter(void)
       }
     }
   }
-  /* °쥰դν */
+  /* 付属語グラフの初期化 */
   if (anthy_init_depword_tab()) {
     anthy_log(0, "Failed to init dependent word table.\n");
     return -1;
   }
   /**/
-  anthy_wtype_noun = anthy_init_wtype_by_name("̾35");
-  anthy_wtype_name_noun = anthy_init_wtype_by_name("̾");
-  anthy_wtype_num_noun = anthy_init_wtype_by_name("");
-  anthy_wtype_a_tail_of_v_renyou = anthy_init_wtype_by_name("ƻ첽");
-  anthy_wtype_v_renyou = anthy_init_wtype_by_name("ưϢѷ");
-  anthy_wtype_noun_tail = anthy_init_wtype_by_name("̾첽");
-  anthy_wtype_prefix = anthy_init_wtype_by_name("̾Ƭ");
-  anthy_wtype_num_prefix = anthy_init_wtype_by_name("Ƭ");
-  anthy_wtype_num_postfix = anthy_init_wtype_by_name("");
-  anthy_wtype_name_postfix = anthy_init_wtype_by_name("̾");
-  anthy_wtype_sv_postfix = anthy_init_wtype_by_name("");
-  anthy_wtype_n1 = anthy_init_wtype_by_name("1");
-  anthy_wtype_n10 = anthy_init_wtype_by_name("10");
+  anthy_wtype_noun = anthy_init_wtype_by_name("名詞35");
+  anthy_wtype_name_noun = anthy_init_wtype_by_name("人名");
+  anthy_wtype_num_noun = anthy_init_wtype_by_name("数詞");
+  anthy_wtype_a_tail_of_v_renyou = anthy_init_wtype_by_name("形容詞化接尾語");
+  anthy_wtype_v_renyou = anthy_init_wtype_by_name("動詞連用形");
+  anthy_wtype_noun_tail = anthy_init_wtype_by_name("名詞化接尾語");
+  anthy_wtype_prefix = anthy_init_wtype_by_name("名詞接頭辞");
+  anthy_wtype_num_prefix = anthy_init_wtype_by_name("数接頭辞");
+  anthy_wtype_num_postfix = anthy_init_wtype_by_name("数接尾辞");
+  anthy_wtype_name_postfix = anthy_init_wtype_by_name("人名接尾辞");
+  anthy_wtype_sv_postfix = anthy_init_wtype_by_name("サ変接尾辞");
+  anthy_wtype_n1 = anthy_init_wtype_by_name("数詞1");
+  anthy_wtype_n10 = anthy_init_wtype_by_name("数詞10");
   return 0;
 }
 
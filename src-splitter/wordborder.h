@@ -1,4 +1,4 @@
-/* ʸᶭθФ˻Ȥǡ */
+/* 文節境界の検出に使うデータ */
 #ifndef _wordborder_h_included_
 #define _wordborder_h_included_
 
@@ -11,14 +11,14 @@
 struct splitter_context;
 
 /*
- * meta_wordλѲǽåΤ
+ * meta_wordの使用可能チェックのやり方
  */
 enum mw_check {
-  /* ʤˤ⤻ */
+  /* なにもせず */
   MW_CHECK_NONE,
-  /* mw->wl̵wlȤ */
+  /* mw->wlが無いか、wlが使える場合 */
   MW_CHECK_SINGLE,
-  /* +ơפ */
+  /* 「入れ+たて」の等 */
   MW_CHECK_COMBINED,
   MW_CHECK_WRAP,
   MW_CHECK_OCHAIRE,
@@ -27,8 +27,8 @@ enum mw_check {
 };
 
 /*
- * ʸΤɽ
- * Ϥޤmeta_word, word_listΥåȤ
+ * 文字列中のある場所を表し，
+ * そこから始まるmeta_word, word_listのセットを持つ
  */
 struct char_node {
   int max_len;
@@ -36,48 +36,94 @@ struct char_node {
   struct word_list *wl;
 };
 
+/* word_listの重複検査用のハッシュ表の大きさ(2のべき乗) */
+#define WL_HASH_SIZE 1024
+
+/* latticeの遷移確率のキャッシュのハッシュ表の大きさ(2のべき乗) */
+#define TRANS_PROB_HASH_SIZE 1024
+
+/*
+ * latticeのノードの遷移確率はmeta_wordと直前のノードのクラスだけで
+ * 決まるので、コンテキストの間覚えておいて文節の伸縮の時にも使う
+ */
+struct trans_prob_ent {
+  struct meta_word *mw;
+  enum seg_class pc;
+  double prob;
+  struct trans_prob_ent *next;
+};
+
+/*
+ * 付属語グラフをたどった結果
+ * dc, head_posは上書きする場合のみDEP_NONE, POS_NONE以外になる
+ */
+struct dep_outcome {
+  int len;
+  enum dep_class dc;
+  int head_pos;
+  int ct;
+  int weak;
+};
+
+/*
+ * ある位置からあるノードを検索した結果のキャッシュ
+ */
+struct dep_scan {
+  struct dep_scan *next;
+  int node;
+  int nr_outcomes;
+  struct dep_outcome *outcomes;
+};
+
 /*
- * ƥμΩʤɤξ󡢺ǽѴ򲡤Ȥ
- * ۤ
+ * コンテキスト中の自立語などの情報、最初に変換キーを押したときに
+ * 構築される
  */
 struct word_split_info_cache {
   struct char_node *cnode;
 
-  /* å幽˻Ȥ */
-  /* õΤ˻Ȥ */
-  int *seq_len;/* ϤޤĹñĹ */
-  /* ƬõΤ˻Ȥ */
-  int *rev_seq_len;/* ǽĹñĹ */
-  /* ʸᶭcontextΥԡ */
+  /* キャッシュ構成時に使う情報 */
+  /* 接尾辞を探すのに使う */
+  int *seq_len;/* そこから始まる最長の単語の長さ */
+  /* 接頭辞を探すのに使う */
+  int *rev_seq_len;/* そこで終わる最長の単語の長さ */
+  /* 文節境界contextからのコピー */
   int *seg_border;
-  /* ǰӤɤä饹 */
+  /* 検索で一番成績の良かったクラス */
   enum seg_class* best_seg_class;
   /*  */
   struct meta_word **best_mw;
-  /*  */
-  allocator MwAllocator, WlAllocator;
+  /* 付属語部の開始位置ごとの付属語グラフの検索結果 */
+  struct dep_scan **dep_scan;
+  /* コミットしたword_listのハッシュ表 */
+  struct word_list **wl_hash;
+  /* latticeの遷移確率のハッシュ表 */
+  struct trans_prob_ent **trans_prob_hash;
+  /* アロケータ */
+  allocator MwAllocator, WlAllocator, DepAllocator, TransProbAllocator;
+  allocator LatticeNodeAllocator;
 };
 
 /*
- * meta_wordξ
+ * meta_wordの状態
  */
 enum mw_status {
   MW_STATUS_NONE,
-  /* mw->mw1ȤäƤ */
+  /* mw->mw1に中身が入っている */
   MW_STATUS_WRAPPED,
-  /* mw-mw1mw->mw2Ϣ */
+  /* mw-mw1とmw->mw2から連結 */
   MW_STATUS_COMBINED,
-  /* ʣ */
+  /* 複合語用 */
   MW_STATUS_COMPOUND,
-  /* ʣθġʸ礷ưĤʸȤƸ */
+  /* 複合語の個々の文節を結合して一つの文節として見たもの */
   MW_STATUS_COMPOUND_PART,
-  /* OCHAIREؽФ */
+  /* OCHAIRE学習から取り出す */
   MW_STATUS_OCHAIRE
 };
 
 
 
-/* metawordμˤΰ㤤 (metaword.c) */
+/* metawordの種類による処理の違い (metaword.c) */
 extern struct metaword_type_tab_ {
   enum metaword_type type;
   const char *name;
@@ -86,9 +132,9 @@ extern struct metaword_type_tab_ {
 } anthy_metaword_type_tab[];
 
 /*
- * 0: Ƭ
- * 1: Ω
- * 2: 
+ * 0: 接頭辞
+ * 1: 自立語部
+ * 2: 接尾辞
  */
 #define NR_PARTS 4
 #define PART_PREFIX 0
@@ -97,67 +143,69 @@ extern struct metaword_type_tab_ {
 #define PART_DEPWORD 3
 
 struct part_info {
-  /* partĹ */
+  /* このpartの長さ */
   int from, len;
-  /* ʻ */
+  /* 品詞 */
   wtype_t wt;
   seq_ent_t seq;
-  /* °쥯饹 */
+  /* 付属語クラス */
   enum dep_class dc;
 };
 
 /*
- * word_list: ʸ
- * Ƭ졢Ω졢졢°ޤ
+ * word_list: 文節を形成するもの
+ * 接頭語、自立語、接尾語、付属語を含む
  */
 struct word_list {
   /**/
-  int from, len; /* ʸ */
-  int is_compound; /* ʣ줫ɤ */
+  int from, len; /* 文節全体 */
+  int is_compound; /* 複合語かどうか */
 
   /**/
   int dep_word_hash;
   int mw_features;
   /**/
   enum seg_class seg_class;
-  enum constraint_stat can_use; /* ȶ˸٤äƤʤ */
+  enum constraint_stat can_use; /* セグメント境界に跨がっていない */
 
-  /* 뤿ǤϤʤơ¿ʽ˻Ȥ */
-  int head_pos; /* latticeѤʻ */
-  int tail_ct; /* meta_wordηѤγѷ */
+  /* 漢字を得るためではなくて、雑多な処理に使いたい情報 */
+  int head_pos; /* lattice検索用の品詞 */
+  int tail_ct; /* meta_wordの結合用の活用形 */
 
   /**/
   int last_part;
   struct part_info part[NR_PARTS];
 
-  /* word_listäݤξ */
-  int node_id; /* °쥰դθϤnodeid*/
+  /* このword_listを作った際の情報 */
+  int node_id; /* 付属語グラフの検索開始のnodeのid*/
 
-  /* Ʊfromword_listΥꥹ */
+  /* 同じfromを持つword_listのリスト */
   struct word_list *next;
+  /* 重複検査用のハッシュ表の同じバケットのリスト */
+  struct word_list *hash_next;
 };
 
 
 /* splitter.c */
 #define SPLITTER_DEBUG_NONE 0
-/* wordlistɽ */
+/* wordlistの表示 */
 #define SPLITTER_DEBUG_WL 1
-/* metawordɽ */
+/* metawordの表示 */
 #define SPLITTER_DEBUG_MW 2
-/* lattice nodeɽ */
+/* latticeの nodeの表示 */
 #define SPLITTER_DEBUG_LN 4
-/* lattice pathɽ */
+/* latticeの pathの表示 */
 #define SPLITTER_DEBUG_LP 8
-/* ΩΥޥåʻ */
+/* 自立語のマッチした品詞 */
 #define SPLITTER_DEBUG_ID 16
-/*  */
+/* 候補生成 */
 #define SPLITTER_DEBUG_CAND 32
 
 int anthy_splitter_debug_flags(void);
 
 
 /* defined in wordseq.c */
-/* Ωʹߤ³ν */
+/* 自立語以降の接続の処理 */
 void anthy_scan_node(struct splitter_context *sc,
 		     struct word_list *wl,
 		     xstr *follow, int node);
@@ -193,7 +241,7 @@ void anthy_mark_borders(struct splitter_context *sc, int from, int to);
 /* defined at seg_class.c */
 void anthy_set_seg_class(struct word_list* wl);
 
-/* ʻ(anthy_init_splitterǽ) */
+/* 品詞(anthy_init_splitterで初期化される) */
 extern wtype_t anthy_wtype_noun;
 extern wtype_t anthy_wtype_name_noun;
 extern wtype_t anthy_wtype_num_noun;
@@ -204,7 +252,7 @@ extern wtype_t anthy_wtype_name_postfix;
 extern wtype_t anthy_wtype_sv_postfix;
 extern wtype_t anthy_wtype_a_tail_of_v_renyou;
 extern wtype_t anthy_wtype_v_renyou;
-extern wtype_t anthy_wtype_noun_tail;/* ֤ơפȤ */
+extern wtype_t anthy_wtype_noun_tail;/* いれ「たて」とか */
 extern wtype_t anthy_wtype_n1;
 extern wtype_t anthy_wtype_n10;
 
@@ -1,12 +1,12 @@
 /*
- * ʸκǾñ̤Ǥwordlist
+ * 文節の最小単位であるwordlistを構成する
  *
  * anthy_make_word_list_all() 
- * ʸηʬʸ󤹤
- *  ηϩ󤵤줿word_list
- *  anthy_commit_word_listsplitter_contextɲä
+ * 文節の形式を満たす部分文字列を列挙する
+ *  いくかの経路で列挙されたword_listは
+ *  anthy_commit_word_listでsplitter_contextに追加される
  *
- * Funded by IPA̤Ƨեȥ¤ 2002 2/27
+ * Funded by IPA未踏ソフトウェア創造事業 2002 2/27
  * Copyright (C) 2000-2007 TABATA Yusuke
  * Copyright (C) 2004-2006 YOSHIDA Yuichi
  * Copyright (C) 2000-2003 UGAWA Tomoharu
@@ -31,7 +31,7 @@
 #include <anthy/feature_set.h>
 #include "wordborder.h"
 
-/* ǥХå */
+/* デバッグ用 */
 void
 anthy_print_word_list(struct splitter_context *sc,
 		      struct word_list *wl)
@@ -41,22 +41,22 @@ anthy_print_word_list(struct splitter_context *sc,
     printf("--\n");
     return ;
   }
-  /* Ƭ */
+  /* 接頭辞 */
   xs.len = wl->part[PART_CORE].from - wl->from;
   xs.str = sc->ce[wl->from].c;
   anthy_putxstr(&xs);
   printf(".");
-  /* Ω */
+  /* 自立語 */
   xs.len = wl->part[PART_CORE].len;
   xs.str = sc->ce[wl->part[PART_CORE].from].c;
   anthy_putxstr(&xs);
   printf(".");
-  /*  */
+  /* 接尾辞 */
   xs.len = wl->part[PART_POSTFIX].len;
   xs.str = sc->ce[wl->part[PART_CORE].from + wl->part[PART_CORE].len].c;
   anthy_putxstr(&xs);
   printf("-");
-  /* ° */
+  /* 付属語 */
   xs.len = wl->part[PART_DEPWORD].len;
   xs.str = sc->ce[wl->part[PART_CORE].from +
 		  wl->part[PART_CORE].len +
@@ -73,7 +73,7 @@ anthy_dep_word_hash(xstr *xs)
   int h = (xs->len % 2)/* small piece of information */;
   xstr tail = *xs;
   if (tail.len > HASH_DEP_LEN) {
-    /* °θʬФ */
+    /* 付属語の後ろの部分を取り出す */
     tail.str = &tail.str[tail.len - HASH_DEP_LEN];
     tail.len = HASH_DEP_LEN;
   }
@@ -84,8 +84,8 @@ anthy_dep_word_hash(xstr *xs)
   return h;
 }
 
-/** word_listӤ롢޴ΤʤΤǡ
-    ̩ӤǤɬפ̵ */
+/** word_listを比較する、枝刈りのためなので、
+    厳密な比較である必要は無い */
 static int
 word_list_same(struct word_list *wl1, struct word_list *wl2)
 {
@@ -103,10 +103,28 @@ word_list_same(struct word_list *wl1, struct word_list *wl2)
   if (wl1->part[PART_DEPWORD].dc != wl2->part[PART_DEPWORD].dc) {
     return 0;
   }
-  /* ƱȽ */
+  /* 同じと判断 */
   return 1;
 }
 
+/** word_list_sameで比較する項目からハッシュ値を求める */
+static int
+word_list_hash(struct word_list *wl)
+{
+  unsigned int h = wl->from;
+  h = h * 31 + wl->len;
+  h = h * 31 + wl->node_id;
+  h = h * 31 + wl->mw_features;
+  h = h * 31 + wl->tail_ct;
+  h = h * 31 + wl->part[PART_CORE].len;
+  h = h * 31 + wl->head_pos;
+  h = h * 31 + wl->part[PART_DEPWORD].dc;
+  h = h * 31 + anthy_wtype_get_pos(wl->part[PART_CORE].wt);
+  h = h * 31 + anthy_wtype_get_scos(wl->part[PART_CORE].wt);
+  h ^= h >> 13;
+  return h & (WL_HASH_SIZE - 1);
+}
+
 static void
 set_features(struct word_list *wl)
 {
@@ -150,22 +168,23 @@ set_features(struct word_list *wl)
   }
 }
 
-/** äword_listΥ׻Ƥ饳ߥåȤ */
+/** 作ったword_listのスコアを計算してからコミットする */
 void 
 anthy_commit_word_list(struct splitter_context *sc,
 		       struct word_list *wl)
 {
   struct word_list *tmp;
+  struct word_list **bucket;
   xstr xs;
 
-  /* °word_listǡĹ0ΤäƤΤ */
+  /* 付属語だけのword_listで、長さ0のもやってくるので */
   if (wl->len == 0) return;
   /**/
   wl->last_part = PART_DEPWORD;
 
   /**/
   set_features(wl);
-  /* ʸᶭθǻѤ륯饹 */
+  /* 文節境界の検索で使用するクラスの設定 */
   anthy_set_seg_class(wl);
   /**/
   xs.len = wl->part[PART_DEPWORD].len;
@@ -176,17 +195,20 @@ anthy_commit_word_list(struct splitter_context *sc,
     xs.str = sc->ce[wl->part[PART_POSTFIX].from].c;
   }
 
-  /* ƱƤword_listʤĴ٤ */
-  for (tmp = sc->word_split_info->cnode[wl->from].wl; tmp; tmp = tmp->next) {
+  /* 同じ内容のword_listがないかを調べる */
+  bucket = &sc->word_split_info->wl_hash[word_list_hash(wl)];
+  for (tmp = *bucket; tmp; tmp = tmp->hash_next) {
     if (word_list_same(tmp, wl)) {
       return ;
     }
   }
-  /* wordlistΥꥹȤɲ */
+  wl->hash_next = *bucket;
+  *bucket = wl;
+  /* wordlistのリストに追加 */
   wl->next = sc->word_split_info->cnode[wl->from].wl;
   sc->word_split_info->cnode[wl->from].wl = wl;
 
-  /* ǥХåץ */
+  /* デバッグプリント */
   if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_WL) {
     anthy_print_word_list(sc, wl);
   }
@@ -198,12 +220,12 @@ anthy_alloc_word_list(struct splitter_context *sc)
   return anthy_smalloc(sc->word_split_info->WlAllocator);
 }
 
-/* ³γѸ졢ưդ */
+/* 後続の活用語尾、助詞、助動詞を付ける */
 static void
 make_following_word_list(struct splitter_context *sc,
 			 struct word_list *tmpl)
 {
-  /* xsϼΩθ³ʸ */
+  /* このxsは自立語部の後続の文字列 */
   xstr xs;
   xs.str = sc->ce[tmpl->from+tmpl->len].c;
   xs.len = sc->char_count - tmpl->from - tmpl->len;
@@ -211,16 +233,16 @@ make_following_word_list(struct splitter_context *sc,
     tmpl->part[PART_POSTFIX].from + tmpl->part[PART_POSTFIX].len;
 
   if (tmpl->node_id >= 0) {
-    /* ̤word_list */
+    /* 普通のword_list */
     anthy_scan_node(sc, tmpl, &xs, tmpl->node_id);
   } else {
-    /* Ω줬ʤword_list */
+    /* 自立語がないword_list */
     struct wordseq_rule rule;
     struct word_list new_tmpl;
     int i;
     int nr_rule = anthy_get_nr_dep_rule();
     new_tmpl = *tmpl;
-    /* ̾35θ³롼Ф */
+    /* 名詞35の後に続くルールに対して */
     for (i = 0; i < nr_rule; ++i) {
       anthy_get_nth_dep_rule(i, &rule);
       if (anthy_wtype_get_pos(rule.wt) == POS_NOUN
@@ -245,7 +267,7 @@ push_part_back(struct word_list *tmpl, int len,
   tmpl->last_part = PART_POSTFIX;
 }
 
-/* 򤯤äĤ */
+/* 接尾辞をくっつける */
 static void 
 make_suc_words(struct splitter_context *sc,
 	       struct word_list *tmpl)
@@ -253,12 +275,12 @@ make_suc_words(struct splitter_context *sc,
   int i, right;
 
   wtype_t core_wt = tmpl->part[PART_CORE].wt;
-  /* 졢̾̾Τ줫°դ */
+  /* 数詞、名前、サ変名詞のいずれかに付属語は付く */
   int core_is_num = 0;
   int core_is_name = 0;
   int core_is_sv_noun = 0;
 
-  /* ޤդΩ줫å */
+  /* まず、接尾辞が付く自立語かチェックする */
   if (anthy_wtype_include(anthy_wtype_num_noun, core_wt)) {
     core_is_num = 1;
   }
@@ -273,7 +295,7 @@ make_suc_words(struct splitter_context *sc,
   }
 
   right = tmpl->part[PART_CORE].from + tmpl->part[PART_CORE].len;
-  /* Ωα¦ʸФ */
+  /* 自立語の右側の文字列に対して */
   for (i = 1;
        i <= sc->word_split_info->seq_len[right];
        i++){
@@ -283,7 +305,7 @@ make_suc_words(struct splitter_context *sc,
     xs.len = i;
     suc = anthy_get_seq_ent_from_xstr(&xs, sc->is_reverse);
     if (anthy_get_seq_ent_pos(suc, POS_SUC)) {
-      /* ¦ʸ°ʤΤǡΩʻˤ碌ƥå */
+      /* 右側の文字列は付属語なので、自立語の品詞にあわせてチェック */
       struct word_list new_tmpl;
       if (core_is_num &&
 	  anthy_get_seq_ent_wtype_freq(suc, anthy_wtype_num_postfix)) {
@@ -319,7 +341,7 @@ push_part_front(struct word_list *tmpl, int len,
   tmpl->part[PART_PREFIX].seq = se;
 }
 
-/* Ƭ򤯤äĤƤ򤯤äĤ */
+/* 接頭辞をくっつけてから接尾辞をくっつける */
 static void
 make_pre_words(struct splitter_context *sc,
 	       struct word_list *tmpl)
@@ -327,16 +349,16 @@ make_pre_words(struct splitter_context *sc,
   int i;
   wtype_t core_wt = tmpl->part[PART_CORE].wt;
   int core_is_num = 0;
-  /* ΩϿ줫 */
+  /* 自立語は数詞か？ */
   if (anthy_wtype_include(anthy_wtype_num_noun, core_wt)) {
     core_is_num = 1;
   }
-  /* Ƭ󤹤 */
+  /* 接頭辞を列挙する */
   for (i = 1; 
        i <= sc->word_split_info->rev_seq_len[tmpl->part[PART_CORE].from];
        i++) {
     seq_ent_t pre;
-    /* xsϼΩʸ */
+    /* このxsは自立語部の前の文字列 */
     xstr xs;
     xs.str = sc->ce[tmpl->part[PART_CORE].from - i].c;
     xs.len = i;
@@ -348,7 +370,7 @@ make_pre_words(struct splitter_context *sc,
 	new_tmpl = *tmpl;
 	push_part_front(&new_tmpl, i, pre, anthy_wtype_num_prefix);
 	make_following_word_list(sc, &new_tmpl);
-	/* ξ⤯äĤ */
+	/* 数の場合は接尾辞もくっつける */
 	make_suc_words(sc, &new_tmpl);
       }/* else if (anthy_get_seq_ent_wtype_freq(pre, anthy_wtype_prefix)) {
 	new_tmpl = *tmpl;
@@ -359,7 +381,7 @@ make_pre_words(struct splitter_context *sc,
   }
 }
 
-/* wordlist */
+/* wordlistを初期化する */
 static void
 setup_word_list(struct word_list *wl, int from, int len,
 		int is_compound)
@@ -368,7 +390,7 @@ setup_word_list(struct word_list *wl, int from, int len,
   wl->from = from;
   wl->len = len;
   wl->is_compound = is_compound;
-  /* part */
+  /* partの配列を初期化する */
   for (i = 0; i < NR_PARTS; i++) {
     wl->part[i].from = 0;
     wl->part[i].len = 0;
@@ -376,7 +398,7 @@ setup_word_list(struct word_list *wl, int from, int len,
     wl->part[i].seq = 0;
     wl->part[i].dc = DEP_NONE;
   }
-  /* ΩΥѡȤ */
+  /* 自立語のパートを設定 */
   wl->part[PART_CORE].from = from;
   wl->part[PART_CORE].len = len;
   /**/
@@ -388,8 +410,8 @@ setup_word_list(struct word_list *wl, int from, int len,
 }
 
 /*
- * ΩФơƬ°դΤ
- * ʸθ(=word_list)Ȥcacheɲä
+ * ある独立語に対して、接頭辞、接尾辞、付属語を付けたものを
+ * 文節の候補(=word_list)としてcacheに追加する
  */
 static void
 make_word_list(struct splitter_context *sc,
@@ -402,11 +424,11 @@ make_word_list(struct splitter_context *sc,
   int nr_rule = anthy_get_nr_dep_rule();
   int i;
 
-  /* ƥץ졼Ȥν */
+  /* テンプレートの初期化 */
   setup_word_list(&tmpl, from, len, is_compound);
   tmpl.part[PART_CORE].seq = se;
 
-  /* ƥ롼˥ޥå뤫 */
+  /* 各ルールにマッチするか比較 */
   for (i = 0; i < nr_rule; ++i) {
     int freq;
     anthy_get_nth_dep_rule(i, &rule);
@@ -417,9 +439,9 @@ make_word_list(struct splitter_context *sc,
     }
 
     if (freq) {
-      /* ΩʻϤΥ롼ˤäƤ */
+      /* 自立語の品詞はそのルールにあっている */
       if (anthy_splitter_debug_flags() & SPLITTER_DEBUG_ID) {
-	/* ʻɽΥǥХå*/
+	/* 品詞表のデバッグ用*/
 	xstr xs;
 	xs.str = sc->ce[tmpl.part[PART_CORE].from].c;
 	xs.len = tmpl.part[PART_CORE].len;
@@ -429,7 +451,7 @@ make_word_list(struct splitter_context *sc,
 	printf(" freq=%d rule_id=%d node_id=%d\n",
 	       freq, i, rule.node_id);
       }
-      /* ܤ롼ξž */
+      /* 遷移したルールの情報を転記する */
       tmpl.part[PART_CORE].wt = rule.wt;
       tmpl.node_id = rule.node_id;
       tmpl.head_pos = anthy_wtype_get_pos(tmpl.part[PART_CORE].wt);
@@ -441,11 +463,11 @@ make_word_list(struct splitter_context *sc,
       /**/
       if (anthy_wtype_get_pos(rule.wt) == POS_NOUN ||
 	  anthy_wtype_get_pos(rule.wt) == POS_NUMBER) {
-	/* Ƭ̾졢ˤդʤȤˤƤ */
+	/* 接頭辞、接尾辞は名詞、数詞にしか付かないことにしている */
 	make_pre_words(sc, &tmpl);
 	make_suc_words(sc, &tmpl);
       }
-      /* Ƭ̵ǽưĤ */
+      /* 接頭辞、接尾辞無しで助詞助動詞をつける */
       make_following_word_list(sc, &tmpl);
     }
   }
@@ -463,7 +485,7 @@ make_dummy_head(struct splitter_context *sc)
   make_suc_words(sc, &tmpl);
 }
 
-/* ƥȤꤵ줿ʸʬʸ󤫤Ƥword_list󤹤 */
+/* コンテキストに設定された文字列の部分文字列から全てのword_listを列挙する */
 void 
 anthy_make_word_list_all(struct splitter_context *sc)
 {
@@ -487,8 +509,8 @@ anthy_make_word_list_all(struct splitter_context *sc)
   xs.len = sc->char_count;
   anthy_gang_load_dic(&xs, sc->is_reverse);
 
-  /* ƤμΩ */
-  /* Υ롼 */
+  /* 全ての自立語を列挙 */
+  /* 開始地点のループ */
   for (i = 0; i < sc->char_count ; i++) {
     int search_len = sc->char_count - i;
     int search_from = 0;
@@ -496,20 +518,20 @@ anthy_make_word_list_all(struct splitter_context *sc)
       search_len = 30;
     }
 
-    /* ʸĹΥ롼(Ĺ) */
+    /* 文字列長のループ(長い方から) */
     for (j = search_len; j > search_from; j--) {
-      /* seq_ent */
+      /* seq_entを取得する */
       xs.len = j;
       xs.str = sc->ce[i].c;
       se = anthy_get_seq_ent_from_xstr(&xs, sc->is_reverse);
 
-      /* ñȤǧǤʤ */
+      /* 単語として認識できない */
       if (!se) {
 	continue;
       }
 
-      /* ơʬʸñʤƬ
-	 ĹĴ٤ƥޡ */
+      /* 各、部分文字列が単語ならば接頭辞、接尾辞の
+	 最大長を調べてマークする */
       if (j > info->seq_len[i] &&
 	  anthy_get_seq_ent_pos(se, POS_SUC)) {
 	info->seq_len[i] = j;
@@ -519,9 +541,9 @@ anthy_make_word_list_all(struct splitter_context *sc)
 	info->rev_seq_len[i + j] = j;
       }
 
-      /* ȯΩꥹȤɲ */
+      /* 発見した自立語をリストに追加 */
       if (anthy_get_seq_ent_indep(se) &&
-	  /* ʣ̵䤬뤳Ȥǧ */
+	  /* 複合語で無い候補があることを確認 */
 	  anthy_has_non_compound_ents(se)) {
 	de = (struct depword_ent *)anthy_smalloc(de_ator);
 	de->from = i;
@@ -532,7 +554,7 @@ anthy_make_word_list_all(struct splitter_context *sc)
 	de->next = head;
 	head = de;
       }
-      /* ȯʣꥹȤɲ */
+      /* 発見した複合語をリストに追加 */
       if (anthy_has_compound_ents(se)) {
 	de = (struct depword_ent *)anthy_smalloc(de_ator);
 	de->from = i;
@@ -546,13 +568,13 @@ anthy_make_word_list_all(struct splitter_context *sc)
     }
   }
 
-  /* ȯΩƤФ°ѥθ */
+  /* 発見した自立語全てに対して付属語パターンの検索 */
   for (de = head; de; de = de->next) {
     make_word_list(sc, de->se, de->from, de->len,
 		   de->is_compound);
   }
 
-    /* Ω̵word_list */
+    /* 自立語の無いword_list */
   for (i = 0; i < sc->char_count; i++) {
     struct word_list tmpl;
     setup_word_list(&tmpl, i, 0, 0);
@@ -562,13 +584,13 @@ anthy_make_word_list_all(struct splitter_context *sc)
       int type = anthy_get_xchar_type(*sc->ce[i - 1].c);
       if ((type & (XCT_CLOSE | XCT_SYMBOL)) &&
 	  !(type & XCT_PUNCTUATION)) {
-	/* ʳε */
+	/* 句読点以外の記号 */
 	make_following_word_list(sc, &tmpl);
       }
     }
   }  
 
-  /* Ƭ0ʸμΩդ */
+  /* 先頭に0文字の自立語を付ける */
   make_dummy_head(sc);
 
   anthy_free_allocator(de_ator);
@@ -1,15 +1,15 @@
 /* 
- * ɸϤǥޥɤꡤѴ̤ʤɤ̿
- * ץꥱ(Emacs)ȹԤȤˤꡤץꥱ
- * AnthyˤϵǽưפİɲäǤ롥
+ * 標準入出力でコマンドを受けたり，変換結果を送るなどの通信を
+ * アプリケーション(おもにEmacs)と行うことにより，アプリケーションに
+ * Anthyによる入力機能を容易かつ安全に追加できる．
  *
- * Funded by IPA̤Ƨեȥ¤ 2002 2/26
+ * Funded by IPA未踏ソフトウェア創造事業 2002 2/26
  * Copyright (C) 2001-2002 UGAWA Tomoharu
  * Copyright (C) 2002-2004 TABATA Yusuke,
  */
 /*
- * *ޥƥȤΰᤫͤƤ
- * *ϤstdioȤfdȤᤫͤƤ
+ * *マルチコンテキストの扱いを決めかねている
+ * *入出力にstdioを使うかfdを使うか決めかねている
  */
 
 #include <sys/time.h>
@@ -30,11 +30,11 @@
 
 extern void egg_main(void);
 
-/* 󼡸򲡤ȸ⡼ɤؤ뤫 */
+/* 何回次候補を押すと候補の列挙を一覧モードに切替えるか？ */
 #define DEFAULT_ENUM_CAND_LIMIT 3
 
 
-/* б */
+/* キーに対応する定数 */
 #define KEY_SHIFT   0x00010000
 #define KEY_CTRL    0x00020000
 #define KEY_ALT     0x00040000
@@ -67,18 +67,18 @@ extern void egg_main(void);
 
 
 /*
- * ޥɤˤϥ줿Ȥ򼨤̤Υޥɤ
- * ̿Υϥ٥륳ޥɤ롥
+ * コマンドにはキーが押されたことを示す普通のコマンドと
+ * 高水準な命令のハイレベルコマンドがある．
  */
 enum {
-  /* ϥ٥륳ޥ */
+  /* ハイレベルコマンド */
   CMDH_IGNORE_ICTXT, CMDH_GETPREEDIT, CMDH_SELECT_CONTEXT,
   CMDH_RELEASE_CONTEXT, CMDH_MAP_EDIT, CMDH_MAP_SELECT,
   CMDH_GET_CANDIDATE, CMDH_SELECT_CANDIDATE, CMDH_CHANGE_TOGGLE,
   CMDH_MAP_CLEAR, CMDH_SET_BREAK_INTO_ROMAN,
-  CMDH_SET_PREEDIT_MODE, CMDH_PRINT_CONTEXT,
+  CMDH_SET_PREEDIT_MODE, CMDH_PRINT_CONTEXT, CMDH_RELOAD_DIC,
 
-  /* ޥ */
+  /* キーコマンド */
   CMD_SPACE = 1000,
   CMD_ENTER,
   CMD_BACKSPACE, 
@@ -99,11 +99,11 @@ struct high_level_command_type {
   int n_arg;
   int opt_arg;
 } high_level_command_type[] = {
-  /* ƥȤξɽ */
+  /* コンテキストの情報を表示する */
   {"PRINT_CONTEXT",  CMDH_PRINT_CONTEXT,  0, 0},
-  /* ȥ˻Ȥѹ */
+  /* トグルに使うキーを変更する */
   {"CHANGE_TOGGLE",  CMDH_CHANGE_TOGGLE,  1, 0},
-  /* ƥȤ򤹤 */
+  /* コンテキストを選択する */
   {"SELECT_CONTEXT", CMDH_SELECT_CONTEXT, 1, 0},
   {"RELEASE_CONTEXT", CMDH_RELEASE_CONTEXT, 0, 0},
   {"MAP_CLEAR", CMDH_MAP_CLEAR, 1, 0},
@@ -111,10 +111,12 @@ struct high_level_command_type {
   {"MAP_SELECT",     CMDH_MAP_SELECT,     1, 0},
   {"GET_CANDIDATE",  CMDH_GET_CANDIDATE,  1, 0},
   {"SELECT_CANDIDATE", CMDH_SELECT_CANDIDATE, 1, 0},
-  /* Хåڡǥ޻ */
+  /* バックスペースでローマ字に戻る */
   {"BREAK_INTO_ROMAN", CMDH_SET_BREAK_INTO_ROMAN, 1, 0},
   /**/
   {"SET_PREEDIT_MODE", CMDH_SET_PREEDIT_MODE, 1, 0},
+  /* 辞書ファイルを読み込み直す */
+  {"RELOAD_DIC", CMDH_RELOAD_DIC, 1, 0},
   /**/
   {NULL, -1, 0, 0}
 };
@@ -163,7 +165,7 @@ encode_command_arg(char *a)
       j++;
       continue;
     }
-    /* Хåå */
+    /* バックスラッシュ */
     i++;
     switch (a[i]) {
     case 0:
@@ -180,7 +182,7 @@ encode_command_arg(char *a)
 	char buf[5];
 	unsigned char *p;
 	int num;
-	/* ToBeDone 顼å */
+	/* ToBeDone エラーチェック */
 	strncpy(buf, &a[i+1], 4);
 	i+= 5;
 	sscanf(buf, "%x", (unsigned int *)&num);
@@ -270,7 +272,7 @@ static struct key_name_table {
 };
 
 /*
- * 󥳡ɤ줿ξ
+ * エンコードされたキーの情報を取得する
  */
 static int
 read_encoded_key(char** buf)
@@ -280,7 +282,7 @@ read_encoded_key(char** buf)
 
   int key = 0;
 
-  /* Ĥ̤õ */
+  /* 閉じ括弧を探す */
   for (p = *buf + 1; *p; p++) {
     if (*p == ')') {
       break;
@@ -333,7 +335,7 @@ find_command_type(char *str)
   return NULL;
 }
 
-/* ϥ٥륳ޥɤѡ */
+/* ハイレベルコマンドをパースする */
 static struct command *
 make_hl_command(char *buf)
 {
@@ -343,7 +345,7 @@ make_hl_command(char *buf)
   char* p;
   int i;
 
-  /* ޥɤμĴ٤ */
+  /* コマンドの種類を調べる */
   p = strtok(buf, " \t\r");
   if (!p) {
     return NULL;
@@ -353,7 +355,7 @@ make_hl_command(char *buf)
     return NULL;
   }
 
-  /* ޥɤ */
+  /* コマンドを作る */
   cmd = (struct command*) malloc(sizeof(struct command));
   cmd->cmd = cmdn->cmd;
   cmd->n_arg = cmdn->n_arg;
@@ -385,7 +387,7 @@ make_hl_command(char *buf)
   return cmd;
 }
 
-/* ̤Υޥɤѡ */
+/* 普通のコマンドをパースする */
 static struct command *
 make_ll_command(char *buf)
 {
@@ -454,7 +456,7 @@ make_ll_command(char *buf)
       break;
     default:
       if ((c & 0xffffff80) == 0) {
-	/* ASCIIʸ */
+	/* ASCII文字 */
 	char str[2];
 
 	str[0] = (char)c;
@@ -489,7 +491,7 @@ make_command(char* buf)
 {
 
   if (*buf == ' ') {
-    /* ϥ٥륳ޥ */
+    /* ハイレベルコマンド */
     struct command *cmd;
     cmd = make_hl_command(buf);
     if (!cmd) {
@@ -584,6 +586,10 @@ AGAIN:
       }
     }
 
+    if (conn->n_wbuf == 0) {
+      /* 次の入力を待つ間に学習データをまとめる */
+      anthy_idle();
+    }
     if (proc_connection() == -1) {
       return NULL;
     }
@@ -627,7 +633,7 @@ send_string(const char* str)
 static void
 send_quote_string(const char* str)
 {
-  char buf[20]; /* Τ餤 */
+  char buf[20]; /* このぐらいあれば大抵大丈夫 */
   const char *p;
   char *q, *end;
 
@@ -846,6 +852,16 @@ cmdh_set_break_into_roman(struct command *cmd)
   send_ok();
 }
 
+static void
+cmdh_reload_dic(struct command *cmd)
+{
+  if (anthy_reload_dic(cmd->arg[0])) {
+    send_error();
+  } else {
+    send_ok();
+  }
+}
+
 static void
 cmdh_set_preedit_mode(struct command *cmd)
 {
@@ -955,7 +971,7 @@ cmd_key(struct anthy_input_context* ictx, struct command* cmd)
 }
 
 /*
- * ޥɤǥѥå
+ * コマンドをディスパッチする
  */
 static void
 dispatch_command(struct anthy_input_context* ictx, 
@@ -1007,6 +1023,9 @@ dispatch_command(struct anthy_input_context* ictx,
   case CMDH_SET_PREEDIT_MODE:
     cmdh_set_preedit_mode(cmd);
     break;
+  case CMDH_RELOAD_DIC:
+    cmdh_reload_dic(cmd);
+    break;
     /* key commands follows */
 
   case CMD_SPACE:
@@ -1,6 +1,6 @@
 /*
- * Ѵ󥸥ȤᡢտŪ
- * layer violation֤Ƥ롣
+ * 変換エンジンの内部情報を使うため、意図的に
+ * layer violationを放置している。
  *
  */
 #include <stdio.h>
@@ -17,23 +17,23 @@
 #include "../src-worddic/dic_ent.h"
 
 
-/* Ω° */
+/* 自立語部か付属語部か */
 #define WORD_INDEP 0
 #define WORD_DEP 1
 
-/* ñ(Ωor°) */
+/* 単語(自立語or付属語) */
 struct word {
   /* WORD_* */
   int type;
-  /* °hash(WORD_INDEP)⤷Ѵʸhash(WORD_DEP) */
+  /* 付属語のhash(WORD_INDEP)もしくは変換後の文字列のhash(WORD_DEP) */
   int hash;
-  /* ɤߤʸhash */
+  /* 読みの文字列のhash */
   int yomi_hash;
-  /* Ѵʸ */
+  /* 変換前の文字列 */
   xstr *raw_xs;
-  /* Ѵʸ */
+  /* 変換後の文字列 */
   xstr *conv_xs;
-  /* Ѵʻ */
+  /* 変換後の品詞 */
   const char *wt;
 };
 
@@ -173,9 +173,9 @@ parse_line(struct res_db *db, char *line)
   }
   if (buf1[0] != '|') {
     /* buf1 buf2    buf3
-     * ʿʸ ڤʸ
-     * ʿʸ ڤʸ Ѵ
-     * ʿʸ ڤʸ check
+     * 平文 区切り文
+     * 平文 区切り文 変換後
+     * 平文 区切り文 check
      */
     src = buf1;
     res = buf2;
@@ -186,9 +186,9 @@ parse_line(struct res_db *db, char *line)
     }
   } else {
     /* buf1    buf2  (buf3)
-     * ڤʸ
-     * ڤʸ Ѵ
-     * ڤʸ check
+     * 区切り文
+     * 区切り文 変換後
+     * 区切り文 check
      */
     strip_separator_vbar(buf4, buf1);
     src = buf4;
@@ -271,12 +271,12 @@ free_word(struct word *w)
   anthy_free_xstr(w->conv_xs);
 }
 
-/* Ω */
+/* 自立語を作る */
 static void
 fill_indep_word(struct word *w, struct cand_elm *elm)
 {
   init_word(w, WORD_INDEP);
-  /* Ѵɤߤ */
+  /* 変換前の読みを取得する */
   w->raw_xs = anthy_xstr_dup(&elm->str);
   w->yomi_hash = anthy_xstr_hash(w->raw_xs);
   w->hash = 0;
@@ -284,7 +284,7 @@ fill_indep_word(struct word *w, struct cand_elm *elm)
   fill_conv_info(w, elm);
 }
 
-/* ° */
+/* 付属語を作る */
 static void
 fill_dep_word(struct word *w, struct cand_elm *elm)
 {
@@ -320,24 +320,24 @@ print_word(const char *prefix, struct word *w, struct feature_list *fl)
 {
   printf("%s", prefix);
   if (w->type == WORD_DEP) {
-    /* ° */
+    /* 付属語 */
     printf("dep_word hash=%d ", w->hash);
     anthy_putxstrln(w->raw_xs);
     return ;
   }
-  /* Ω */
+  /* 自立語 */
   printf("indep_word hash=%d", w->hash);
   /**/
   if (fl) {
     print_features(fl);
   }
-  /* ʻ */
+  /* 品詞 */
   if (w->wt) {
     printf(" %s", w->wt);
   } else {
     printf(" null");
   }
-  /* ʸ */
+  /* 文字列 */
   if (w->conv_xs) {
     printf(" ");
     anthy_putxstr(w->conv_xs);
@@ -348,8 +348,8 @@ print_word(const char *prefix, struct word *w, struct feature_list *fl)
   anthy_putxstrln(w->raw_xs);
 }
 
-/** segʸ᥯饹֤
- * segnullǤСcl򥯥饹Ȥ
+/** segの文節クラスを返す
+ * segがnullであれば、clをクラスとする
  */
 static int
 get_seg_class(struct seg_ent *seg, int cl)
@@ -422,11 +422,11 @@ print_element(const char *prefix,
     return ;
   }
   if (elm->id != -1) {
-    /* Ω */
+    /* 自立語 */
     fill_indep_word(&w, elm);
     print_word(prefix, &w, fl);
   } else {
-    /* ° */
+    /* 付属語 */
     fill_dep_word(&w, elm);
     print_word(prefix, &w, NULL);
   }
@@ -452,8 +452,8 @@ print_eos(struct seg_ent *prev_seg)
   anthy_feature_list_free(&fl);
 }
 
-/* Υߥˤ '~'ʸĹΥߥˤ '!'դ
- * ƱʸĤʹߤμΩˤ '^'դ
+/* 候補のミスには '~'、文節長のミスには '!'を付ける
+ * 同じ文節内の二つめ以降の自立語には '^'を付ける
  */
 static const char *
 get_prefix(int flag)
@@ -489,9 +489,9 @@ print_segment_info(int is_negative,
     if (nr_indep > 0 && elm->id != -1) {
       prefix = get_prefix(is_negative | CONV_INVALID);
     }
-    /* Ϥ */
+    /* 出力する */
     print_element(prefix, elm, &fl);
-    /* Ω */
+    /* 自立語を数える */
     if (elm->id != -1) {
       nr_indep ++;
     }
@@ -528,7 +528,7 @@ print_context_info(anthy_context_t ac, struct conv_res *cr)
   struct seg_ent *prev_seg = NULL;
 
   printf("segments: %d\n", ac->seg_list.nr_segments);
-  /* ʸФ */
+  /* 各文節に対して */
   for (i = 0; i < ac->seg_list.nr_segments; i++) {
     struct seg_ent *seg = anthy_get_nth_segment(&ac->seg_list, i);
     struct cand_ent *ce = selected_candidate(seg);
@@ -537,19 +537,19 @@ print_context_info(anthy_context_t ac, struct conv_res *cr)
       is_negative = CONV_CAND_MISS;
     }
 
-    /* ǤФ */
+    /* 各要素に対して */
     if (!ce->nr_words) {
-      /* Ǥ̵ΤϤΤޤɽ */
+      /* 要素が無いものはそのまま表示 */
       print_unconverted(ce);
     } else {
-      /* ѹäϤɽ */
+      /* 候補の変更があった場合はそれを表示 */
       if (seg->committed > 0) {
 	int tmp = seg->committed;
 	seg->committed = 0;
 	print_cand_miss_segment_info(ac, i);
 	seg->committed = tmp;
       }
-      /* ʸιɽ */
+      /* 文節の構成を表示 */
       print_segment_info(is_negative, prev_seg, seg);
     }
     /**/
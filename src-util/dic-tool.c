@@ -1,17 +1,17 @@
 /*
- * ѤΥ桼ƥƥޥ
+ * 辞書操作用のユーティリティコマンド
  *
- * Υ饤֥ηȳηѴԤ
- * 
- * *ɤ  ñ
- * *ʻѿ1 = 1
- * *ʻѿ2 = 2
+ * 辞書のライブラリ内部の形式と外部の形式の相互変換を行う
+ * 外部形式は
+ * *読み 頻度 単語
+ * *品詞の変数1 = 値1
+ * *品詞の変数2 = 値2
  * *...
- * *<>
- * ˤʤ
+ * *<空行>
+ * になる
  */
 /*
- * Funded by IPA̤Ƨեȥ¤ 2001 9/22
+ * Funded by IPA未踏ソフトウェア創造事業 2001 9/22
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  */
@@ -65,18 +65,18 @@ static FILE *fp_in;
 static char *fn;
 static const char *personality = "";
 
-/* ѿ̾ͤΥڥ */
+/* 変数名と値のペア */
 struct var{
   struct var *next;
   char *var_name;
   char *val;
 };
 
-/* ʻΥѥ᡼ʻ̾뤿Υơ֥ */
+/* 品詞のパラメータから品詞名を得るためのテーブル */
 struct trans_tab {
   struct trans_tab *next;
-  char *type_name; /* Ǥη̾ T35Ȥ */
-  struct var var_list; /* ꤹ뤿Υѥ᡼ */
+  char *type_name; /* 内部での型の名前 T35とか */
+  struct var var_list; /* 型を決定するためのパラメータ */
 }trans_tab_list;
 
 static void
@@ -107,10 +107,10 @@ static FILE *
 open_usage_file(void)
 {
   FILE *fp;
-  /* ȥǥ쥯ȥˤϡѤ */
+  /* カレントディレクトリにある場合は、それを使用する */
   fp = fopen(USAGE_TEXT, "r");
   if (!fp) {
-    /* 󥹥ȡ뤵줿Τ */
+    /* インストールされたものを使用 */
     char *fn;
     fn = strdup(anthy_dic_util_get_anthydir());
     fn = realloc(fn, strlen(fn) + strlen(USAGE_TEXT) + 10);
@@ -133,7 +133,7 @@ print_usage_text(void)
   if (encoding == ANTHY_UTF8_ENCODING) {
   } else {
   }
-  /* ΤޤޥեƤ */
+  /* そのままファイルの内容を出力 */
   while (fgets(buf, 256, fp)) {
     if (encoding == ANTHY_UTF8_ENCODING) {
       char *s;
@@ -152,7 +152,7 @@ read_line(char *buf, int len, FILE *fp)
 {
   while (fgets(buf, len, fp)) {
     if (buf[0] != '#') {
-      /* Ԥ */
+      /* 改行を削除する */
       int l = strlen(buf);
       if (l > 0 && buf[l-1] == '\n') {
 	buf[l-1] = 0;
@@ -191,7 +191,7 @@ read_typetab_var(struct var *head, FILE *fp, int table)
     v->val = strdup(val);
   }
 
-  /* ꥹȤˤĤʤ */
+  /* リストにつなぐ */
   v->next = head->next;
   head->next = v;
 
@@ -204,7 +204,7 @@ read_typetab_entry(FILE *fp)
   char buf[256], type_name[257];
   char *res;
   struct trans_tab *t;
-  /* ܤʻ̾ɤ */
+  /* 一行目の品詞名を読む */
   do {
     res = read_line(buf, 256, fp);
     if (!res) {
@@ -215,9 +215,9 @@ read_typetab_entry(FILE *fp)
   sprintf(type_name, "#%s", buf);
   t->type_name = strdup(type_name);
   t->var_list.next = 0;
-  /* ѥ᡼ɤ */
+  /* パラメータを読む */
   while(!read_typetab_var(&t->var_list, fp, 1));
-  /* ꥹȤˤĤʤ */
+  /* リストにつなぐ */
   t->next = trans_tab_list.next;
   trans_tab_list.next = t;
   return 0;
@@ -298,7 +298,7 @@ open_input_file(void)
   }
 }
 
-/* v sˤ뤫 */
+/* vが sの中にあるか */
 static int
 match_var(struct var *v, struct var *s)
 {
@@ -312,7 +312,7 @@ match_var(struct var *v, struct var *s)
   return 0;
 }
 
-/* v1v2ʬ礫ɤ */
+/* v1がv2の部分集合かどうか */
 static int
 var_list_subset_p(struct var *v1, struct var *v2)
 {
@@ -1,10 +1,10 @@
 /*
  * Some comments are written in Japanese.
  *
- * Funded by IPA̤Ƨեȥ¤ 2001
+ * Funded by IPA未踏ソフトウェア創造事業 2001
  *
  * Comments are in Japanese(EUC-JP)
- * doc/ILIB 
+ * doc/ILIB 参照
  */
 
 #ifndef INPUT_H_INCLUDE
@@ -21,11 +21,11 @@ extern int anthy_input_errno;
 #define AIE_INVAL 2
 #define AIE_NOIMPL 3
 
-#define ANTHY_INPUT_ST_OFF  0  /* ̵ */ /* anthy agent does not use this state */
-#define ANTHY_INPUT_ST_NONE 1  /* Ե */
-#define ANTHY_INPUT_ST_EDIT 2  /* Խ */
-#define ANTHY_INPUT_ST_CONV 3  /* Ѵ */
-#define ANTHY_INPUT_ST_CSEG 4  /* ʸ῭̾ */
+#define ANTHY_INPUT_ST_OFF  0  /* 無効状態 */ /* anthy agent does not use this state */
+#define ANTHY_INPUT_ST_NONE 1  /* 待機状態 */
+#define ANTHY_INPUT_ST_EDIT 2  /* 編集状態 */
+#define ANTHY_INPUT_ST_CONV 3  /* 変換状態 */
+#define ANTHY_INPUT_ST_CSEG 4  /* 文節伸縮状態 */
 
 #define ANTHY_INPUT_MAP_ALPHABET  0
 #define ANTHY_INPUT_MAP_WALPHABET 1
@@ -1,4 +1,4 @@
-/* ѥܹ뤿Υ 
+/* コーパスから遷移行列を作るためのコード 
  *
  * Copyright (C) 2005-2006 TABATA Yusuke
  * Copyright (C) 2005-2006 YOSHIDA Yuichi
@@ -122,7 +122,7 @@ conv_sentence(struct test_context *tc, const char *str)
   }
 }
 
-/* βԤ */
+/* 行末の改行を削除 */
 static void
 chomp(char *buf)
 {
@@ -1,8 +1,8 @@
 /*
  * roma kana converter
  *
- * 򤹤뤿ˤϡʸϤˤĤƽ񤫤줿ƥȤ
- * SLR(1)ˤĤĴ٤
+ * 理解するためには，構文解析について書かれたテキストで
+ * SLR(1)について調べるよろし．
  *
  * $Id: rkconv.c,v 1.16 2002/11/16 03:35:21 yusuke Exp $
  *
@@ -635,7 +635,7 @@ rk_rule_compare_func(const void *p, const void *q)
 }
 
 /*
- * Ȥ줿rk_ruleä֤
+ * ソートされたrk_ruleを作って返す
  */
 static struct rk_rule *
 rk_sort_rule(const struct rk_rule *src)
@@ -667,7 +667,7 @@ rk_sort_rule(const struct rk_rule *src)
   return NULL;
 }
 
-/* ܤΥ롼뤬ͥ褵 */
+/* 一つ目のルールが優先される */
 static struct rk_rule*
 rk_do_merge_rules(const struct rk_rule* r1,
 		  const struct rk_rule* r2)
@@ -689,10 +689,10 @@ rk_do_merge_rules(const struct rk_rule* r1,
   r = rules;
   p = (struct rk_rule *)r1;
   q = (struct rk_rule *)r2;
-  /* ȺѤФƥޡȤ򤹤 */
+  /* ソート済の列に対してマージソートをする */
   for (i = 0; i < size; i++) {
     if (p->lhs && q->lhs) {
-      /* p,qӤƤɤ餫Ф */
+      /* p,qを比較してどちらから取り出すかを選ぶ */
       ret = rk_my_strcmp(p->lhs, q->lhs);
       if (ret > 0) {
 	tmp = q;
@@ -701,7 +701,7 @@ rk_do_merge_rules(const struct rk_rule* r1,
 	tmp = p;
 	p++;
       } else {
-	/* ξƱʤΤqͥ褹 */
+	/* キーが両方同じなのでqの方を優先する */
 	tmp = q;
 	p++;q++;
       }
@@ -714,7 +714,7 @@ rk_do_merge_rules(const struct rk_rule* r1,
     } else {
       continue;
     }
-    /* ޤǤ򤷤Τcopy */
+    /* ここまでに選択したものをcopyする */
     ret = rk_rule_copy_to(tmp, r);
     if (ret == -1) {
       r->lhs = NULL;
@@ -1,11 +1,11 @@
 /*
- * ޻ʿ̾Τˤϥ󤫤ʸˤɽ(rk_map)
- * ޥ
+ * ローマ字から平仮名（正確にはキーの列から文字）の表(rk_map)の
+ * カスタマイズを管理する
  *
  * Copyright (C) 2001-2002 UGAWA Tomoharu
  * Copyright (C) 2002 Tabata Yusuke
  *
- * Funded by IPA̤Ƨեȥ¤ 2001
+ * Funded by IPA未踏ソフトウェア創造事業 2001
  */
 
 #include <string.h>
@@ -18,19 +18,19 @@ static const char* rk_default_symbol[128] = {
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-  "", "", "", "", "", "", "", "", 
-  "", "", "", "", "", "", "", "",
-  "", "", "", "", "", "", "", "",
-  "", "", "", "", "", "", "", "",
+  "　", "！", "”", "＃", "＄", "％", "＆", "’", 
+  "（", "）", "＊", "＋", "、", "ー", "。", "／",
+  "０", "１", "２", "３", "４", "５", "６", "７",
+  "８", "９", "：", "；", "＜", "＝", "＞", "？",
 
-  "", NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+  "＠", NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-  NULL, NULL, NULL, "", "", "", "", "",
-  "", NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+  NULL, NULL, NULL, "「", "＼", "」", "＾", "＿",
+  "‘", NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
   NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
-  NULL, NULL, NULL, "", "", "", "", NULL
+  NULL, NULL, NULL, "｛", "｜", "｝", "〜", NULL
 };
 
 struct rk_conf_ent {
@@ -41,14 +41,14 @@ struct rk_conf_ent {
 
 struct rk_option {
   int enable_default;
-  char toggle; /* ѿȤΰŪؤ˻Ȥܥ */
+  char toggle; /* 英数との一時的な切替えに使うシンボル */
   /*
-   * Ϥ줾ꥹȤƬˤʤ
-   * ꥹȤƬϰʸΥȥ꤬
+   * 配列はそれぞれリストの先頭になる
+   * リストの先頭は一文字のエントリが入る
    */
-  struct rk_conf_ent hiragana_symbol[128]; /* Ҥ餬ʤȤб */
-  struct rk_conf_ent katakana_symbol[128]; /* ʤȤб */
-  struct rk_conf_ent hankaku_kana_symbol[128]; /* ʤȤб */
+  struct rk_conf_ent hiragana_symbol[128]; /* ひらがなとの対応 */
+  struct rk_conf_ent katakana_symbol[128]; /* カタカナとの対応 */
+  struct rk_conf_ent hankaku_kana_symbol[128]; /* カタカナとの対応 */
 };
 
 #include "rkmap.h"
@@ -114,7 +114,7 @@ find_rk_conf_ent(struct rk_option *opt, int map,
   if (strlen(key) == 1) {
     sym = &tab[c];
   } else {
-    /* 2ʸʾ */
+    /* 2文字以上 */
     for (sym = tab[c].next; sym; sym = sym->next) {
       if (!strcmp(sym->lhs, key)) {
 	break;
@@ -122,7 +122,7 @@ find_rk_conf_ent(struct rk_option *opt, int map,
     }
   }
   if (!sym && force) {
-    /* ݤƤĤʤ */
+    /* メモリ確保してつなぐ */
     sym = malloc(sizeof(struct rk_conf_ent));
     sym->rhs = NULL;
     sym->lhs = NULL;
@@ -136,11 +136,11 @@ find_rk_conf_ent(struct rk_option *opt, int map,
 }
 
 /*
- * opt ѹоݤoption
+ * opt 変更対象のoption
  * map RKMAP_*
- * from ѴȤʸ
- * to Ѵʸ
- * follow follow
+ * from 変換もとの文字
+ * to 変換先の文字列
+ * follow follow集合
  */
 int
 anthy_input_do_edit_rk_option(struct rk_option* opt, int map, 
@@ -187,23 +187,23 @@ anthy_input_do_clear_rk_option(struct rk_option* opt,
 
   opt->enable_default = use_default;
   for (i = 0; i < 128; i++) {
-    /* ʸФ */
+    /* 各文字に対して */
     struct rk_conf_ent *tab, *tmp;
-    /* Ҥ餬ʤΥꥹȤ */
+    /* ひらがなのリストを解放 */
     for (tab = opt->hiragana_symbol[i].next; tab;) {
       tmp = tab;
       tab = tab->next;
       free_rk_conf_ent(tmp);
       free(tmp);
     }
-    /* ʤΥꥹȤ */
+    /* カタカナのリストを解放 */
     for (tab = opt->katakana_symbol[i].next; tab;) {
       tmp = tab;
       tab = tab->next;
       free_rk_conf_ent(tmp);
       free(tmp);
     }
-    /* ƬΰʸΥȥ˺줺˲ */
+    /* 先頭の一文字のエントリも忘れずに解放 */
     free_rk_conf_ent(&opt->katakana_symbol[i]);
     free_rk_conf_ent(&opt->hiragana_symbol[i]);
   }
@@ -282,7 +282,7 @@ make_rkmap_shiftascii(struct rk_option* opt)
   for (c = 0; c < 128; c++) {
     if (rk_default_symbol[c]) {
       if (c == toggle_char) {
-	/* ȥ뤹ʸξ */
+	/* トグルする文字の場合 */
 	w[0] = c;
 	w[1] = '\0';
 	rkrule_set(p++, w, "\xff" "o", NULL);
@@ -292,7 +292,7 @@ make_rkmap_shiftascii(struct rk_option* opt)
 	rkrule_set(p++, w + 2, w, NULL);
 	w += 5;	
       } else {
-	/* ̤ʸξ */
+	/* 普通の文字の場合 */
 	w[0] = c;
 	w[1] = '\0';
 	rkrule_set(p++, w, w, NULL);
@@ -336,8 +336,8 @@ count_rk_rule_ent(struct rk_option *opt, int map_no)
 }
 
 /*
- * ǥեȤΥ롼ȥޥ줿롼ޡ
- * rk_map롣
+ * デフォルトのルールとカスタマイズされたルールをマージして
+ * rk_mapを作る。
  */
 static struct rk_map*
 make_rkmap_hirakata(const struct rk_rule* rule,
@@ -362,8 +362,8 @@ make_rkmap_hirakata(const struct rk_rule* rule,
   p = rk_var_part;
   w = work;
 
-  /* ʸΤΤrk_var_part˽񤭹Ǥ */
-  /* ȥξ */
+  /* 一文字のものをrk_var_partに書き込んでいく */
+  /* トグルの場合 */
   buf[0] = toggle;
   buf[1] = 0;
   w[0] = toggle;
@@ -382,24 +382,24 @@ make_rkmap_hirakata(const struct rk_rule* rule,
     rkrule_set(p++, w + 5, rk_default_symbol[toggle], NULL);
   }
   w += 8;
-  /* ȥʳ */
+  /* トグル以外 */
   for (c = 0; c < 128; c++) {
     if (c != toggle) {
       buf[0] = c;
       buf[1] = 0;
-      /* ʸΤ */
+      /* 一文字のもの */
       w[0] = c;
       w[1] = '\0';
       tab = find_rk_conf_ent(opt, map_no, buf, 0);
       if (tab && tab->rhs) {
-	/* ޥѤΤ */
+	/* カスタマイズ済のがある */
 	rkrule_set(p++, w, tab->rhs, NULL);
       } else if (rk_default_symbol[c]) {
-	/* ʤ */
+	/* 記号など */
 	rkrule_set(p++, w, rk_default_symbol[c], NULL);
       }
       w += 2;
-      /* ʸʾΤ */
+      /* 二文字以上のもの */
       if (tab) {
 	for (tab = tab->next; tab; tab = tab->next) {
 	  rkrule_set(p++, tab->lhs, tab->rhs, NULL);
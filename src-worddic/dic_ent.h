@@ -4,41 +4,41 @@
 #include <anthy/wtype.h>
 #include <anthy/dic.h>
 
-/* ʸΥ (seq_ent->seq_type) */
+/* 文字列のタイプ (seq_ent->seq_type) */
 #define ST_NONE 0
 /**/
 #define ST_REVERSE 8
 
-/** ñ */
+/** ある単語 */
 struct dic_ent {
-  wtype_t type; /** ʻ */
-  int freq; /**  */
+  wtype_t type; /** 品詞 */
+  int freq; /** 頻度 */
   int feature;
   const char *wt_name;
   int is_compound;
-  xstr str; /** Ѵ̤ʸ */
-  /** Ʊʻξμν(anthy_get_seq_ent_wtype_freq
-      anthy_wtype_includeƤФ򸺤餹ΤѤ */
+  xstr str; /** 変換結果の文字列 */
+  /** 同一品詞の場合の辞書中の順番(anthy_get_seq_ent_wtype_freqから
+      anthy_wtype_includeが呼ばれる回数を減らすのに用いる */
   int order;
 };
 
-/**ʸƱ۵
- * seq_ent_t ȤƻȤ
+/**ある文字列と同音異義語の配列
+ * seq_ent_t として参照される
  */
 struct seq_ent {
-  xstr str;/* ɤ */
+  xstr str;/* 読み */
 
   int seq_type; /** ST_(type) */
 
-  /** dic_ent */
+  /** dic_entの配列 */
   int nr_dic_ents;
   struct dic_ent **dic_ents;
-  /** compound_ent */
+  /** compound_entの配列 */
   int nr_compound_ents;
 
-  /* °꼭 */
+  /* 属するメモリ辞書 */
   struct mem_dic *md;
-  /* 꼭hash chain */
+  /* メモリ辞書中のhash chain */
   struct seq_ent *next;
 };
 
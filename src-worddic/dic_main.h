@@ -7,7 +7,7 @@
 #include <anthy/xstr.h>
 
 
-/* ٤Ф٤Ψ */
+/* 辞書中の頻度に対して内部の頻度の倍率 */
 #define FREQ_RATIO 8
 
 
@@ -17,12 +17,12 @@ struct seq_ent *anthy_cache_get_seq_ent(xstr *x, int is_reverse);
 
 
 /* word_dic.c */
-/* 񸡺Υ˻Ѥʬʸ */
+/* 辞書検索のキーに使用する部分文字列 */
 struct gang_elm {
   char *key;
   xstr xs;
   union {
-    /* ʥΤunionˤƤ */
+    /* 省メモリのためにunionにしている */
     int idx;
     struct gang_elm *next;
   } tmp;
@@ -35,6 +35,8 @@ struct seq_ent *anthy_validate_seq_ent(struct seq_ent *seq, xstr *xs,
 /* word_lookup.c */
 void anthy_init_word_dic(void);
 struct word_dic* anthy_create_word_dic(void);
+struct word_dic* anthy_create_word_dic_from_file(const char *fn);
+struct word_dic* anthy_create_word_dic_from_dic_file(const char *fn);
 void anthy_release_word_dic(struct word_dic *);
 void anthy_gang_fill_seq_ent(struct word_dic *wd,
 			     struct gang_elm **array, int nr,
@@ -57,10 +59,11 @@ void anthy_init_mem_dic(void);
 void anthy_quit_mem_dic(void);
 struct mem_dic * anthy_create_mem_dic(void);
 void anthy_release_mem_dic(struct mem_dic * );
-/* node ʤк */
+void anthy_reset_mem_dic(struct mem_dic * );
+/* node がなければ作る */
 struct seq_ent *anthy_mem_dic_alloc_seq_ent_by_xstr(struct mem_dic * d,
 						    xstr *, int is_reverse);
-/* node ʤкʤ */
+/* node がなければ作らない */
 struct seq_ent *anthy_mem_dic_find_seq_ent_by_xstr(struct mem_dic * d,
 						   xstr *, int is_reverse);
 /**/
@@ -77,7 +80,8 @@ void anthy_copy_words_from_private_dic(struct seq_ent *seq, xstr *xs,
 				       int is_reverse);
 void anthy_release_private_dic(void);
 void anthy_check_user_dir(void);
-void anthy_priv_dic_lock(void);
+int anthy_priv_dic_lock(void);
+void anthy_priv_dic_lock_shared(void);
 void anthy_priv_dic_unlock(void);
 struct word_line {
   char wt[10];
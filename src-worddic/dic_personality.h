@@ -1,6 +1,6 @@
 /*
- * ¦ǤΥѡʥƥδ
- * ե󥹥Ȥʤɤϥեȥɤ롣
+ * 辞書側でのパーソナリティの管理
+ * リファレンスカウントなどはフロントエンドがやる。
  */
 #ifndef _dic_personality_h_included_
 #define _dic_personality_h_included_
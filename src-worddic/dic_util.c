@@ -1,17 +1,17 @@
 /*
- * ĿͼѤδؿ
+ * 個人辞書管理用の関数群
  *
- * ߴԹ
- *  utf8μtextdict
- *  recordȤäƤƺ𤷤ޤ
- * textdictذܹԤ
+ * 互換性の都合で
+ *  utf8の辞書はtextdict
+ *  およびrecordを使ってて混乱しまくり
+ * textdictへ移行する
  *
- * ȯͽ
+ * 開発予定
  *
- *  recordطϾä
+ *  record関係は消す
  *
  *
- * Funded by IPA̤Ƨեȥ¤ 2001 10/24
+ * Funded by IPA未踏ソフトウェア創造事業 2001 10/24
  *
  * Copyright (C) 2001-2007 TABATA Yusuke
  *
@@ -44,17 +44,17 @@
 #include "dic_main.h"
 #include "dic_personality.h"
 
-/* UTF832ʸ x 3bytes */
+/* UTF8で32文字 x 3bytes */
 #define MAX_KEY_LEN 96
 
 static int gIsInit;
 static int dic_util_encoding;
 
 extern struct textdict *anthy_private_text_dic;
-/* 򤵤Ƥɤ */
+/* 現在選択されている読み */
 static struct iterate_contex {
   /**/
-  /* textdictθ */
+  /* textdictの検索用 */
   int dicfile_offset;
   char *current_index;
   char *current_line;
@@ -87,7 +87,7 @@ set_current_line(const char *index, const char *line)
   }
 }
 
-/** Ŀͼ饤֥ */
+/** 個人辞書ライブラリを初期化する */
 void
 anthy_dic_util_init(void)
 {
@@ -102,7 +102,7 @@ anthy_dic_util_init(void)
   dic_util_encoding = ANTHY_EUC_JP_ENCODING;
 }
 
-/** 饤֥ */
+/** 辞書ライブラリを解放する */
 void
 anthy_dic_util_quit(void)
 {
@@ -113,7 +113,7 @@ anthy_dic_util_quit(void)
   gIsInit = 0;
 }
 
-/** 桼ƥƥAPIΥ󥳡ǥ󥰤ꤹ */
+/** 辞書ユーティリティAPIのエンコーディングを設定する */
 int
 anthy_dic_util_set_encoding(int enc)
 {
@@ -130,7 +130,7 @@ anthy_dic_util_set_personality(const char *id)
   anthy_dic_set_personality(id);
 }
 
-/** (API) Ŀͼä */
+/** (API) 個人辞書を全部消す */
 void
 anthy_priv_dic_delete(void)
 {
@@ -159,18 +159,18 @@ select_first_entry_in_textdict(void)
   if (word_iterator.current_line) {
     return 0;
   }
-  /* ñ줬̵ */
+  /* 単語が無い */
   return ANTHY_DIC_UTIL_ERROR;
 }
 
-/** (API) ǽñ򤹤 */
+/** (API) 最初の単語を選択する */
 int
 anthy_priv_dic_select_first_entry(void)
 {
   return select_first_entry_in_textdict();
 }
 
-/** (API) 򤵤Ƥñμñ򤹤 */
+/** (API) 現在選択されている単語の次の単語を選択する */
 int
 anthy_priv_dic_select_next_entry(void)
 {
@@ -184,7 +184,7 @@ anthy_priv_dic_select_next_entry(void)
   return ANTHY_DIC_UTIL_ERROR;
 }
 
-/** ̤ */
+/** 未実装 */
 int
 anthy_priv_dic_select_entry(const char *index)
 {
@@ -192,7 +192,7 @@ anthy_priv_dic_select_entry(const char *index)
   return 0;
 }
 
-/** 򤵤Ƥñɤߤ */
+/** 現在選択されている単語の読みをを取得する */
 char *
 anthy_priv_dic_get_index(char *buf, int len)
 {
@@ -205,7 +205,7 @@ anthy_priv_dic_get_index(char *buf, int len)
   } else {
     src_buf = strdup(src_buf);
   }
-  /* ǽζ\0ޤǤ򥳥ԡ */
+  /* 最初の空白か\0までをコピーする */
   for (i = 0; src_buf[i] && src_buf[i] != ' '; i++) {
     if (i >= len - 1) {
       free(src_buf);
@@ -218,7 +218,7 @@ anthy_priv_dic_get_index(char *buf, int len)
   return buf;
 }
 
-/** 򤵤Ƥñ٤ */
+/** 現在選択されている単語の頻度を取得する */
 int
 anthy_priv_dic_get_freq(void)
 {
@@ -227,7 +227,7 @@ anthy_priv_dic_get_freq(void)
   return res.freq;
 }
 
-/** 򤵤Ƥñʻ */
+/** 現在選択されている単語の品詞を取得する */
 char *
 anthy_priv_dic_get_wtype(char *buf, int len)
 {
@@ -240,7 +240,7 @@ anthy_priv_dic_get_wtype(char *buf, int len)
   return buf;
 }
 
-/** 򤵤Ƥñ */
+/** 現在選択されている単語を取得する */
 char *
 anthy_priv_dic_get_word(char *buf, int len)
 {
@@ -250,7 +250,7 @@ anthy_priv_dic_get_word(char *buf, int len)
   if (!v) {
     return NULL;
   }
-  /* ʻθˤñФ */
+  /* 品詞の後ろにある単語を取り出す */
   s = strchr(v, ' ');
   s++;
   if (dic_util_encoding == ANTHY_EUC_JP_ENCODING) {
@@ -295,7 +295,7 @@ order_cb(void *p, int next_offset, const char *key, const char *n)
   return 0;
 }
 
-/* utf8 */
+/* 引数はutf8 */
 static int
 do_add_word_to_textdict(struct textdict *td, int offset,
 			const char *yomi, const char *word,
@@ -328,7 +328,7 @@ add_word_to_textdict(const char *yomi, const char *word,
     return ANTHY_DIC_UTIL_ERROR;
   }
 
-  /* Ʊʪää */
+  /* 同じ物があったら消す */
   sc.yomi = yomi;
   sc.word = word;
   sc.wt_name = wt_name;
@@ -343,12 +343,12 @@ add_word_to_textdict(const char *yomi, const char *word,
   if (freq == 0) {
     return ANTHY_DIC_UTIL_OK;
   }
-  /* ɲäõ */
+  /* 追加する場所を探す */
   sc.offset = 0;
   sc.found_word = 0;
   anthy_textdict_scan(anthy_private_text_dic, 0, &sc,
 		      order_cb);
-  /* ɲä */
+  /* 追加する */
   rv = do_add_word_to_textdict(anthy_private_text_dic, sc.offset,
 			       yomi, word, wt_name, freq);
   if (!rv) {
@@ -357,8 +357,8 @@ add_word_to_textdict(const char *yomi, const char *word,
   return ANTHY_DIC_UTIL_ERROR;
 }
 
-/** ñϿ
- * ٤0ξϺ
+/** 単語を登録する
+ * 頻度が0の場合は削除
  */
 int
 anthy_priv_dic_add_entry(const char *yomi, const char *word,
@@ -383,7 +383,7 @@ anthy_dic_util_get_anthydir(void)
   return anthy_conf_get_str("ANTHYDIR");
 }
 
-/* lookޥɤμ򸡺뤿δؿ */
+/* lookコマンドの辞書を検索するための関数 */
 static char *
 do_search(FILE *fp, const char *word)
 {
@@ -407,7 +407,7 @@ do_search(FILE *fp, const char *word)
   return res;
 }
 
-/* lookޥɤμ򸡺API */
+/* lookコマンドの辞書を検索するAPI */
 char *
 anthy_dic_search_words_file(const char *word)
 {
@@ -1,7 +1,7 @@
 /*
- * "123" "ABC" Τ褦ʼˤΤäƤʤ
- * ʸФ礻ξƤθ򤳤
- * 嵭¾͹ֹؤΥԤʤ
+ * "123" "ABC" のような辞書にのってない
+ * 文字列に対する問合せの場合は全ての候補をここで生成する
+ * 上記の他に郵便番号へのアクセスも行なう
  *
  * Copyright (C) 2001-2005 TABATA Yusuke
  * Copyright (C) 2004-2005 YOSHIDA Yuichi
@@ -33,10 +33,10 @@
 #include "dic_ent.h"
 
 /* ext entry */
-static struct seq_ent unkseq_ent;/*̤ʸ󤿤ȤбʸȤ*/
-static struct seq_ent num_ent;/*ʤ*/
-static struct seq_ent sep_ent;/*ѥ졼ʤɡ*/
-/* ext entrywtype*/
+static struct seq_ent unkseq_ent;/*未知文字列たとえば英文字列とか*/
+static struct seq_ent num_ent;/*数字など*/
+static struct seq_ent sep_ent;/*セパレータなど。*/
+/* ext entryのwtype*/
 static wtype_t wt_num;
 
 static xchar narrow_wide_tab[]= {WIDE_0, WIDE_1, WIDE_2,
@@ -50,7 +50,7 @@ struct zipcode_line {
   xstr **strs;
 };
 
-/* ̾ɲä */
+/* 地名を追加する */
 static void
 pushback_place_name(struct zipcode_line *zl, char *pn)
 {
@@ -62,7 +62,7 @@ pushback_place_name(struct zipcode_line *zl, char *pn)
   zl->nr++;
 }
 
-/* ͹ֹ漭ѡƥڡڤ򸡽Ф */
+/* 郵便番号辞書をパースしてスペース区切りを検出する */
 static void
 parse_zipcode_line(struct zipcode_line *zl, char *ln)
 {
@@ -90,7 +90,7 @@ parse_zipcode_line(struct zipcode_line *zl, char *ln)
   pushback_place_name(zl, buf);
 }
 
-/* ͹ֹ漭񤫤õ */
+/* 郵便番号辞書から探す */
 static void
 search_zipcode_dict(struct zipcode_line *zl, xstr* xs)
 {
@@ -107,16 +107,16 @@ search_zipcode_dict(struct zipcode_line *zl, xstr* xs)
     return ;
   }
   
-  /* ȾѡѤۼ */
+  /* 半角、全角を吸収する */
   temp = anthy_xstr_wide_num_to_num(xs);
   index = anthy_xstr_to_cstr(temp, 0);
   len = strlen(index);
 
-  /* grep */
+  /* 全部grepする */
   while (fgets(buf, 1000, fp)) {
-    /* 3ʸ͹ֹ椬7ʸ͹ֹƬ˥ޥåʤ褦 */
+    /* 3文字の郵便番号が7文字の郵便番号の頭にマッチしないように */
     if (!strncmp(buf, index, len) && buf[len] == ' ') {
-      /* Ԥä */
+      /* 改行を消す */
       buf[strlen(buf) - 1] = 0;
       parse_zipcode_line(zl, &buf[len + 1]);
     }
@@ -126,7 +126,7 @@ search_zipcode_dict(struct zipcode_line *zl, xstr* xs)
   fclose(fp);
 }
 
-/* ͹ֹ漭ξ */
+/* 郵便番号辞書の情報を解放する */
 static void
 free_zipcode_line(struct zipcode_line *zl)
 {
@@ -142,10 +142,10 @@ gen_zipcode(xstr* xs, xstr *dest, int nth)
 {
   struct zipcode_line zl;
 
-  /* ͹ֹ漭񤫤̾ɤ߼ */
+  /* 郵便番号辞書から地名を読み取る */
   search_zipcode_dict(&zl, xs);
 
-  /*  */
+  /* 候補を取得する */
   if (zl.nr > nth) {
     dest->len = zl.strs[nth]->len;
     dest->str = anthy_xstr_dup_str(zl.strs[nth]);
@@ -159,7 +159,7 @@ gen_zipcode(xstr* xs, xstr *dest, int nth)
 
 
 
-/* ȾѤοѤο */
+/* 半角の数字から全角の数字を求める */
 static xchar
 narrow_num_to_wide_num(xchar xc)
 {
@@ -169,7 +169,7 @@ narrow_num_to_wide_num(xchar xc)
   return narrow_wide_tab[(int)(xc - '0')];
 }
 
-/* ѤοȾѤο */
+/* 全角の数字から半角の数字を求める */
 static xchar
 wide_num_to_narrow_num(xchar xc)
 {
@@ -182,7 +182,7 @@ wide_num_to_narrow_num(xchar xc)
   return '0';
 }
 /*
- * Ѵ
+ * 一桁の整数を漢数字に変換する
  */
 static xchar
 get_kj_num(int n)
@@ -194,7 +194,7 @@ get_kj_num(int n)
 }
 
 /*
- * 4ʬʸȤƤ
+ * 4桁分の整数を漢字文字列としてを生成する
  */
 static void
 compose_num_component(xstr *xs, long long num)
@@ -205,7 +205,7 @@ compose_num_component(xstr *xs, long long num)
     n[i] = num-(num/10)*10;
     num /= 10;
   }
-  /* 10,100,1000ΰ */
+  /* 10,100,1000の位 */
   for (i = 3; i > 0; i--) {
     if (n[i] > 0) {
       if (n[i] > 1) {
@@ -214,13 +214,13 @@ compose_num_component(xstr *xs, long long num)
       anthy_xstrappend(xs, a[i]);
     }
   }
-  /* 1ΰ */
+  /* 1の位 */
   if (n[0]) {
     anthy_xstrappend(xs, get_kj_num(n[0]));
   }
 }
 
-/** ʸ */
+/** 漢数字の文字列を作る */
 static int
 gen_kanji_num(long long num, xstr *dest)
 {
@@ -229,7 +229,7 @@ gen_kanji_num(long long num, xstr *dest)
   if (num < 1 || num >= 10000000000000000LL) {
     return -1;
   }
-  /* 4夺nˤĤ */
+  /* 4桁ずつ配列nにつめる */
   for (i = 0; i < 10; i ++) {
     n[i] = num-(num/10000)*10000;
     num = num/10000;
@@ -237,17 +237,17 @@ gen_kanji_num(long long num, xstr *dest)
   /**/
   dest->len = 0;
   dest->str = 0;
-  /* ΰ̤Ĥ */
+  /* 京の位をつくる */
   if (n[3]) {
     compose_num_component(dest, n[3]);
     anthy_xstrappend(dest, KJ_1000000000000);
   }
-  /* ΰ̤Ĥ */
+  /* 億の位をつくる */
   if (n[2]) {
     compose_num_component(dest, n[2]);
     anthy_xstrappend(dest, KJ_100000000);
   }
-  /* ΰ̤Ĥ */
+  /* 万の位をつくる */
   if (n[1]) {
     compose_num_component(dest, n[1]);
     anthy_xstrappend(dest, KJ_10000);
@@ -265,7 +265,7 @@ get_nr_zipcode(xstr* xs)
   if (xs->len != 3 && xs->len != 7) {
     return 0;
   }
-  /* ͹ֹ漭񤫤̾ɤ߼ */
+  /* 郵便番号辞書から地名を読み取る */
   search_zipcode_dict(&zl, xs);
 
   nr = zl.nr;
@@ -278,22 +278,22 @@ get_nr_num_ents(long long num)
 {
   if (num > 0 && num < 10000000000000000LL) {
     if (num > 999) {
-      /* ӥ(Τޤ)ӥ(Ⱦؤ)
-	 3ڤ(ѡȾ) */
+      /* アラビア数字(そのまま)、アラビア数字(全角半角切替え)、
+	 漢数字、3桁区切り(全角、半角) */
       return 5;
     } else {
-      /* ӥ(Τޤ)Ⱦؤ */
+      /* アラビア数字(そのまま)、全角半角切替え、漢数字 */
       return 3;
     }
   } else {
-    /* ӥ(Τޤ)Ⱦؤ */
+    /* アラビア数字(そのまま)、全角半角切替え */
     return 2;
   }
 }
 
 
 /*
- * ĤιΥȥ꡼뤫
+ * いくつの合成のエントリーがあるか
  */
 int
 anthy_get_nr_dic_ents_of_ext_ent(seq_ent_t se, xstr *xs)
@@ -308,7 +308,7 @@ anthy_get_nr_dic_ents_of_ext_ent(seq_ent_t se, xstr *xs)
   return 0;
 }
 
-/* ʸȾѤ򴹤 */
+/* 文字列の全角半角を交換する */
 static void
 toggle_wide_narrow(xstr *dest, xstr *src)
 {
@@ -325,7 +325,7 @@ toggle_wide_narrow(xstr *dest, xstr *src)
   }
 }
 
-/* 3˶ڤä */
+/* 3桁に区切った数字を生成する */
 static int
 gen_separated_num(long long num, xstr *dest, int full)
 {
@@ -337,20 +337,20 @@ gen_separated_num(long long num, xstr *dest, int full)
     return -1;
   }
 
-  /*  */
+  /* 桁数を数える */
   for (tmp = num; tmp != 0; tmp /= 10) {
     width ++;
   }
-  /* ο */
+  /* 点の数 */
   dot_count = (width - 1) / 3;
-  /* ǼΤɬפʸѰդ */
+  /* 格納するのに必要な文字列を用意する */
   dest->len = dot_count + width;
   dest->str = malloc(sizeof(xchar)*dest->len);
 
-  /* η夫˷Ƥ */
+  /* 右の桁から順に決めていく */
   for (i = 0, pos = dest->len - 1; i < width; i++, pos --) {
     int n = num % 10;
-    /* ޤɲ */
+    /* カンマを追加 */
     if (i > 0 && (i % 3) == 0) {
       if (full) {
 	dest->str[pos] = WIDE_COMMA;
@@ -360,10 +360,10 @@ gen_separated_num(long long num, xstr *dest, int full)
       pos --;
     }
     if (full) {
-      /* ѿ */
+      /* 全角数字 */
       dest->str[pos] = narrow_wide_tab[n];
     } else {
-      /* ASCII */
+      /* ASCII数字 */
       dest->str[pos] = 48 + n;
     }
     num /= 10;
@@ -372,46 +372,46 @@ gen_separated_num(long long num, xstr *dest, int full)
 }
 
 /*
- * nthĤθФ
+ * nth個めの候補を取り出す
  */
 int
 anthy_get_nth_dic_ent_str_of_ext_ent(seq_ent_t se, xstr *xs,
 				     int nth, xstr *dest)
 {
   if (nth == 0) {
-    /* ̵Ѵʸ */
+    /* 無変換文字列 */
     dest->len = xs->len;
     dest->str = anthy_xstr_dup_str(xs);
     return 0;
   }
   if (anthy_get_xstr_type(xs) & (XCT_NUM|XCT_WIDENUM)) {
     long long num = anthy_xstrtoll(xs);
-    /* ӥȾؤ */
+    /* 漢数字、アラビア数字、全角半角切替え */
     switch(nth) {
     case 1:
-      /* ȾѤ촹 */
+      /* 全角半角を入れ換えたもの */
       toggle_wide_narrow(dest, xs);
       return 0;
     case 2:
-      /*  */
+      /* 漢数字 */
       if (!gen_kanji_num(num, dest)) {
 	return 0;
       }
-      /* break̵ */
+      /* break無し */
     case 3:
-      /* 3Ƕڤä */
+      /* 3桁で区切った数字 */
       if (!gen_separated_num(num, dest, 0)) {
 	return 0;
       }
-      /* break̵ */
+      /* break無し */
     case 4:
-      /* 3Ƕڤä() */
+      /* 3桁で区切った数字(全角) */
       if (!gen_separated_num(num, dest, 1)) {
 	return 0;
       }
-      /* break̵ */
+      /* break無し */
     default:
-      /* ͹ֹ */
+      /* 郵便番号 */
       if (nth >= 5) {
 	if (xs->len == 3 || xs->len == 7) {
 	  if (!gen_zipcode(xs, dest, nth-5)) {
@@ -435,23 +435,23 @@ anthy_get_ext_seq_ent_indep(struct seq_ent *se)
   return 0;
 }
 
-/* ѷ */
+/* 活用形を得る */
 int
 anthy_get_ext_seq_ent_ct(struct seq_ent *se, int pos, int ct)
 {
   if (anthy_get_ext_seq_ent_pos(se, pos) && ct == CT_NONE) {
-    /* ʻ줬äƤƤ̵Ѥξ 
-       (ext_entϳѤʤ) */
+    /* 品詞が合っていてかつ無活用の場合 
+       (ext_entは活用しない) */
     return 10;
   }
   return 0;
 }
 
-/* ʻ */
+/* 品詞を取得する */
 int
 anthy_get_ext_seq_ent_pos(struct seq_ent *se, int pos)
 {
-  /* ext_ent̾Τ */
+  /* ext_entは名詞のみ */
   if (se == &num_ent && pos == POS_NOUN) {
     return 10;
   }
@@ -462,18 +462,18 @@ anthy_get_ext_seq_ent_pos(struct seq_ent *se, int pos)
 }
 
 /*
- * ˤΤäƤʤ󥹤
+ * 辞書にのっていないシーケンスを解析
  */
 seq_ent_t
 anthy_get_ext_seq_ent_from_xstr(xstr *x, int is_reverse)
 {
   int t = anthy_get_xstr_type(x);
 
-  /* ΤߤǹƤ num_ent */
+  /* 数字のみで構成されていれば num_ent */
   if (t & (XCT_NUM | XCT_WIDENUM)) {
     return &num_ent;
   }
-  /* ѿʤunkseq */
+  /* 英数ならunkseq */
   if (t & XCT_ASCII) {
     return &unkseq_ent;
   }
@@ -481,13 +481,13 @@ anthy_get_ext_seq_ent_from_xstr(xstr *x, int is_reverse)
     return &unkseq_ent;
   }
   if (!is_reverse) {
-    /* ѴϴϺʤ */
+    /* 逆変換中は漢字候補は作らない */
     if (t & XCT_KANJI) {
       return &unkseq_ent;
     }
   }
   if (x->len == 1) {
-    /* ˤΤäƤʤ1ʸʤ饻ѥ졼 */
+    /* 辞書にのってなくて1文字ならセパレータ */
     return &sep_ent;
   }
   return 0;
@@ -525,7 +525,7 @@ anthy_get_ext_seq_ent_wtype(struct seq_ent *se, wtype_t w)
 {
   if (se == &num_ent) {
     if (anthy_wtype_include(w, wt_num)) {
-      /* ξ */
+      /* 数字の場合 */
       return 10;
     }
     return 0;
@@ -533,7 +533,7 @@ anthy_get_ext_seq_ent_wtype(struct seq_ent *se, wtype_t w)
   if (anthy_wtype_get_pos(w) == POS_NOUN &&
       anthy_wtype_get_cos(w) == COS_NONE &&
       anthy_wtype_get_scos(w) == SCOS_NONE) {
-    /* ̾졢ʻʤʻ̵˥ޥå */
+    /* 名詞、副品詞なし、副々品詞無しにマッチ */
     return 10;
   }
   return 0;
@@ -550,5 +550,5 @@ anthy_init_ext_ent(void)
   sep_ent.seq_type = 0;
   sep_ent.nr_dic_ents = 0;
   /**/
-  wt_num = anthy_init_wtype_by_name("");
+  wt_num = anthy_init_wtype_by_name("数詞");
 }
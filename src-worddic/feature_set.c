@@ -1,6 +1,6 @@
 /* features
  *
- * ֹỌ̇̄äƴ
+ * 素性の番号と意味を隠蔽して管理する
  *
  * Copyright (C) 2006-2007 TABATA Yusuke
  *
@@ -23,20 +23,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <arpa/inet.h>
 #include <anthy/segclass.h>
 #include <anthy/feature_set.h>
+#include <anthy/logger.h>
 /* for MW_FEATURE* constants */
 #include <anthy/splitter.h>
 
-/* ֹ 
+/* 素性の番号 
  *
- * 0-19 饹
- * 30- °μ
- * - ¾
- * 1000-(SEG_SIZE^2) 饹°
- * 2000- (2048) °μ
- * 10000- ʸɤߤ
+ * 0-19 クラス素性
+ * 30- 付属語の種類
+ * - その他
+ * 1000-(SEG_SIZE^2) クラス遷移属性
+ * 2000- (2048個) 付属語の種類
+ * 10000- 文節の読みの素性
  */
 
 #define CUR_CLASS_BASE 0
@@ -57,7 +59,7 @@
 #define DEP_FEATURE_BASE 2000
 #define WORD_HASH_BASE 10000
 
-/* Υ饹 */
+/* 素性のクラス */
 #define FC_MISC 0x1
 #define FC_SEG 0x2
 #define FC_TRANS 0x4
@@ -70,7 +72,7 @@
 #define FC_NOUN_COS 0x200
 #define FC_ALL 0x3ff
 
-/* ꥹȤμ(FL_*)ؤб */
+/* 素性リストの種類(FL_*)から素性への対応を得る */
 static const int fc_tab[] = {
   /* FL_ALL_FEATURES */
   FC_ALL,
@@ -89,21 +91,21 @@ static const int fc_tab[] = {
   FC_CORE
 };
 /*
- * ʸᶭηˤFL_SEG_FEATURESȤsubsetǤ
+ * 文節境界の決定にはFL_SEG_FEATURESとそのsubsetである
  * FL_SEG_TRANS_FEATURES,
  * FL_SEG_STRUCT_FEATURES,
- * FL_SEG_LEN_FEATURESѤ
+ * FL_SEG_LEN_FEATURESを用いる
  *
- * ηˤFL_CAND_FEATURESѤ
+ * 候補の決定にはFL_CAND_FEATURESを用いる
  *
- * FC_COREϼΩι¤(̤)
+ * FC_COREは自立語の構造(未使用)
  */
 
 static int
 get_feature_class(int c)
 {
   if (c >= DEP_FEATURE_BASE && c < DEP_FEATURE_BASE + WORD_HASH_MAX) {
-    /* ° */
+    /* 付属語 */
     return FC_SEG;
   }
   if (c >= FEATURE_SEG1 && c <= FEATURE_SEG3) {
@@ -183,13 +185,13 @@ anthy_feature_list_compare(struct feature_list *f1,
 void
 anthy_feature_list_add(struct feature_list *fl, int f)
 {
-  /* Υ饹 */
+  /* 素性のクラスを取得 */
   int fc = get_feature_class(f);
-  /* ꥹȤ뤳ȤΤǤå */
+  /* 素性リストに入れることのできる素性かチェックする */
   if (!(fc_tab[fl->type] & fc)) {
     return ;
   }
-  /* ꥹȤɲä */
+  /* リストに追加する */
   if (fl->nr < NR_EM_FEATURES) {
     fl->u.index[fl->nr] = f;
     fl->nr++;
@@ -334,71 +336,150 @@ anthy_feature_list_print(struct feature_list *fl)
   printf("\n");
 }
 
+/* 可変長整数を読む */
+static const unsigned char *
+read_varint(const unsigned char *p, int *v)
+{
+  unsigned int r = 0;
+  int shift = 0;
+  while (*p & 0x80) {
+    r |= (unsigned int)(*p & 0x7f) << shift;
+    shift += 7;
+    p ++;
+  }
+  *v = (int)(r | ((unsigned int)*p << shift));
+  return p + 1;
+}
+
+/* 前の行の素性fを更新しながら一行読み、確率の値を*qに返す */
+static const unsigned char *
+read_feature_row(const unsigned char *p, int *f, int *q)
+{
+  int i, shared = p[0], nr = p[1];
+  p += 2;
+  for (i = shared; i < shared + nr && i < NR_EM_FEATURES; i++) {
+    p = read_varint(p, &f[i]);
+  }
+  for (; i < NR_EM_FEATURES; i++) {
+    f[i] = 0;
+  }
+  *q = (p[0] << 8) | p[1];
+  return p + 2;
+}
+
 static int
-compare_line(const void *kp, const void *cp)
+compare_features(const int *f1, const int *f2)
 {
-  const int *f = kp;
-  const struct feature_freq *c = cp;
   int i;
   for (i = 0; i < NR_EM_FEATURES; i++) {
-    if (f[i] != (int)ntohl(c->f[i])) {
-      return f[i] - ntohl(c->f[i]);
+    if (f1[i] != f2[i]) {
+      return f1[i] - f2[i];
     }
   }
   return 0;
 }
 
-struct feature_freq *
-anthy_find_array_freq(const void *image, int *f, int nr,
-		      struct feature_freq *arg)
+/* 識別子の合わないセクション、同じセクションについて何度もログを出さない */
+#define MAX_BAD_SECTIONS 8
+static const void *bad_sections[MAX_BAD_SECTIONS];
+static int nr_bad_sections;
+
+/* セクションの識別子を調べる、合わなければログを出してそのセクションを使わない */
+static int
+check_section(const void *image)
 {
-  struct feature_freq *res;
-  int nr_lines, i;
-  const int *array = (int *)image;
-  int n[NR_EM_FEATURES];
-  if (!image) {
-    return NULL;
-  }
-  /* ԡ */
-  for (i = 0; i < NR_EM_FEATURES; i++) {
-    if (i < nr) {
-      n[i] = f[i];
-    } else {
-      n[i] = 0;
+  const int *header = image;
+  int i;
+  if ((int)ntohl(header[0]) == FEATURE_SECTION_MAGIC) {
+    return 1;
+  }
+  for (i = 0; i < nr_bad_sections; i++) {
+    if (bad_sections[i] == image) {
+      return 0;
     }
   }
-  /**/
-  nr_lines = ntohl(array[1]);
-  res = bsearch(n, &array[16], nr_lines,
-		sizeof(struct feature_freq),
-		compare_line);
-  if (!res) {
-    return NULL;
+  if (nr_bad_sections < MAX_BAD_SECTIONS) {
+    bad_sections[nr_bad_sections++] = image;
+  }
+  anthy_log(0, "Probability table has an unknown format (%08x), "
+	    "rebuild anthy.dic.\n", (unsigned int)ntohl(header[0]));
+  return 0;
+}
+
+/* 素性の配列fに対する確率を探す
+ * 先頭の行が f 以下の最後のブロックを二分探索してから、ブロック内を順に見る
+ */
+static int
+find_array_prob(const void *image, const int *f, double *prob)
+{
+  const int *header = image;
+  const unsigned char *data;
+  int cur[NR_EM_FEATURES];
+  int nr_rows, nr_blocks, lo, hi, i, q, r;
+  const unsigned char *p;
+
+  if (!image || !check_section(image)) {
+    return 0;
+  }
+  nr_rows = ntohl(header[1]);
+  nr_blocks = ntohl(header[2]);
+  data = (const unsigned char *)&header[FEATURE_SECTION_HEADER + nr_blocks];
+  if (nr_rows <= 0) {
+    return 0;
+  }
+
+  lo = 0;
+  hi = nr_blocks - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    p = &data[ntohl(header[FEATURE_SECTION_HEADER + mid])];
+    read_feature_row(p, cur, &q);
+    if (compare_features(cur, f) <= 0) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
   }
-  for (i = 0; i < NR_EM_FEATURES + 2; i++) {
-    arg->f[i] = ntohl(res->f[i]);
+
+  p = &data[ntohl(header[FEATURE_SECTION_HEADER + lo])];
+  for (i = lo * FEATURE_BLOCK_ROWS;
+       i < nr_rows && i < (lo + 1) * FEATURE_BLOCK_ROWS; i++) {
+    p = read_feature_row(p, cur, &q);
+    r = compare_features(cur, f);
+    if (r > 0) {
+      break;
+    }
+    if (r == 0) {
+      if (q == FEATURE_PROB_ZERO) {
+	*prob = 0;
+      } else {
+	*prob = exp(-(double)q / FEATURE_PROB_SCALE);
+      }
+      return 1;
+    }
   }
-  return arg;
+  return 0;
 }
 
-struct feature_freq *
-anthy_find_feature_freq(const void *image,
+/** 素性の組に対する正例の割合を*probに返す、テーブルに無ければ0を返す */
+int
+anthy_find_feature_prob(const void *image,
 			const struct feature_list *fl,
-			struct feature_freq *arg)
+			double *prob)
 {
   int i, nr;
-  int f[NR_EM_FEATURES + 2];
+  int f[NR_EM_FEATURES];
 
-  /* ˥ԡ */
+  /* 配列にコピーする */
   nr = anthy_feature_list_nr(fl);
-  for (i = 0; i < NR_EM_FEATURES + 2; i++) {
+  for (i = 0; i < NR_EM_FEATURES; i++) {
     if (i < nr) {
       f[i] = anthy_feature_list_nth(fl, i);
     } else {
       f[i] = 0;
     }
   }
-  return anthy_find_array_freq(image, f, NR_EM_FEATURES, arg);
+  return find_array_prob(image, f, prob);
 }
 
 void
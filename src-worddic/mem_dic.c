@@ -1,8 +1,8 @@
 /*
- * mem_dic ΥåԤ
+ * mem_dic 辞書のキャッシュを行う
  *
- * åɤߤʸȵѴѤΥե饰(is_reverse)
- * Ĥ򥭡Ȥ롣
+ * キャッシュは読みの文字列と逆変換用かのフラグ(is_reverse)の
+ * 二つをキーとして操作される。
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  */
@@ -62,7 +62,7 @@ mem_dic_dtor(void *p)
   anthy_free_allocator(md->dic_ent_allocator);
 }
 
-/** xstrбseq_entݤ */
+/** xstrに対応するseq_entを確保する */
 static struct seq_ent *
 alloc_seq_ent_by_xstr(struct mem_dic * md, xstr *x, int is_reverse)
 {
@@ -85,7 +85,7 @@ alloc_seq_ent_by_xstr(struct mem_dic * md, xstr *x, int is_reverse)
   return se;
 }
 
-/* ϥåؿȤꤢƤȡ */
+/* ハッシュ関数。とりあえずてきとー */
 static int
 hash_function(xstr *xs)
 {
@@ -95,22 +95,22 @@ hash_function(xstr *xs)
   return 0;
 }
 
-/** xstrбseq_ent֤ */
+/** xstrに対応するseq_entを返す */
 struct seq_ent *
 anthy_mem_dic_alloc_seq_ent_by_xstr(struct mem_dic * md, xstr *xs,
 				    int is_reverse)
 {
   struct seq_ent *se;
   int h;
-  /* åˤФ֤ */
+  /* キャッシュにあればそれを返す */
   se = anthy_mem_dic_find_seq_ent_by_xstr(md, xs, is_reverse);
   if (se) {
     return se;
   }
-  /* åˤ̵ΤǺ */
+  /* キャッシュには無いので作る */
   se = alloc_seq_ent_by_xstr(md, xs, is_reverse);
 
-  /* mem_dicˤĤʤ */
+  /* mem_dic中につなぐ */
   h = hash_function(xs);
   se->next = md->seq_ent_hash[h];
   md->seq_ent_hash[h] = se;
@@ -121,7 +121,7 @@ anthy_mem_dic_alloc_seq_ent_by_xstr(struct mem_dic * md, xstr *xs,
 static int
 compare_seq_ent(struct seq_ent *seq, xstr *xs, int is_reverse)
 {
-  /* ޤɤ餫ѴѤΥȥ꤫å */
+  /* まず、どちらかが逆変換用のエントリかをチェック */
   if (seq->seq_type & ST_REVERSE) {
     if (!is_reverse) {
       return 1;
@@ -131,11 +131,11 @@ compare_seq_ent(struct seq_ent *seq, xstr *xs, int is_reverse)
       return 1;
     }
   }
-  /* ʸ */
+  /* 次に文字列の比較 */
   return anthy_xstrcmp(&seq->str, xs);
 }
 
-/*** mem_dic椫ʸбseq_ent*
+/*** mem_dicの中から文字列に対応するseq_ent*を取得する
  * */
 struct seq_ent *
 anthy_mem_dic_find_seq_ent_by_xstr(struct mem_dic * md, xstr *xs,
@@ -172,7 +172,7 @@ anthy_mem_dic_release_seq_ent(struct mem_dic * md, xstr *xs, int is_reverse)
   }
 }
 
-/** seq_entdic_entɲä */
+/** seq_entにdic_entを追加する */
 void
 anthy_mem_dic_push_back_dic_ent(struct seq_ent *se, int is_compound,
 				xstr *xs, wtype_t wt,
@@ -193,7 +193,7 @@ anthy_mem_dic_push_back_dic_ent(struct seq_ent *se, int is_compound,
     se->nr_compound_ents ++;
   }
 
-  /* order׻ */
+  /* orderを計算する */
   if (se->nr_dic_ents > 0) {
     struct dic_ent *prev_de = se->dic_ents[se->nr_dic_ents-1];
     if (anthy_wtype_equal(prev_de->type, de->type) &&
@@ -202,7 +202,7 @@ anthy_mem_dic_push_back_dic_ent(struct seq_ent *se, int is_compound,
     }
   }
 
-  /* ɲä */
+  /* 配列に追加する */
   se->nr_dic_ents ++;
   se->dic_ents = realloc(se->dic_ents,
 			 sizeof(struct dic_ent *)*se->nr_dic_ents);
@@ -226,6 +226,7 @@ anthy_create_mem_dic(void)
   md->dic_ent_allocator =
     anthy_create_allocator(sizeof(struct dic_ent),
 			   dic_ent_dtor);
+  md->word_dic = NULL;
 
   return md;
 }
@@ -236,6 +237,19 @@ anthy_release_mem_dic(struct mem_dic * d)
   anthy_sfree(mem_dic_ator, d);
 }
 
+/** キャッシュを空にする、アロケータのページは残しておく */
+void
+anthy_reset_mem_dic(struct mem_dic * md)
+{
+  int i;
+  /* seq_entのdtorがdic_entを解放する */
+  anthy_reset_allocator(md->seq_ent_allocator);
+  anthy_reset_allocator(md->dic_ent_allocator);
+  for (i = 0; i < HASH_SIZE; i++) {
+    md->seq_ent_hash[i] = NULL;
+  }
+}
+
 void
 anthy_init_mem_dic(void)
 {
@@ -5,13 +5,15 @@
 #include "dic_ent.h"
 
 
-#define HASH_SIZE 64 /*ϥåơ֥Υ64(ʤȤʤ)*/
+#define HASH_SIZE 64 /*ハッシュテーブルのサイズ…64(なんとなく)*/
 
-/** 꼭 */
+/** メモリ辞書 */
 struct mem_dic {
   struct seq_ent *seq_ent_hash[HASH_SIZE];
   allocator seq_ent_allocator;
   allocator dic_ent_allocator;
+  /* セッションの開始時の単語辞書(NULLなら現在の辞書を使う) */
+  struct word_dic *word_dic;
 };
 
 #endif
@@ -1,8 +1,8 @@
 /*
- * Ŀͼ򰷤Υ
+ * 個人辞書を扱うためのコード
  *
- * 桼ŪϿñǤʤ
- * ̤θưŪ˳ؽƴAPIġ
+ * ユーザが明示的に登録した単語だけでなく、
+ * 未知語を自動的に学習して管理するAPIも持つ。
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  */
@@ -43,18 +43,19 @@
 #include "dic_main.h"
 #include "dic_ent.h"
 
-/* Ŀͼ */
+/* 個人辞書 */
 struct textdict *anthy_private_text_dic;
 static struct textdict *anthy_imported_text_dic;
 static char *imported_dic_dir;
-/* åѤѿ */
+/* ロック用の変数 */
 static char *lock_fn;
 static int lock_depth;
-static int lock_fd;
+static int lock_fd = -1;
+static int lock_type = F_UNLCK;
 
 #define MAX_DICT_SIZE 100000000
 
-/* ĿͼΥǥ쥯ȥ̵ͭǧ */
+/* 個人辞書のディレクトリの有無を確認する */
 void
 anthy_check_user_dir(void)
 {
@@ -98,34 +99,84 @@ open_textdic(const char *home, const char *name, const char *id)
   return td;
 }
 
-void
-anthy_priv_dic_lock(void)
+static int
+set_lock(int type)
 {
   struct flock lck;
+  lck.l_type = type;
+  lck.l_whence = (short) 0;
+  lck.l_start = (off_t) 0;
+  lck.l_len = (off_t) 1;
+  return fcntl(lock_fd, F_SETLKW, &lck);
+}
+
+static void
+close_lock_fd(void)
+{
+  if (lock_fd != -1) {
+    close(lock_fd);
+    lock_fd = -1;
+  }
+  lock_type = F_UNLCK;
+}
+
+/*
+ * 読むだけならF_RDLCKを、書き込むときはF_WRLCKを取る。
+ * ロックは入れ子にできて、共有ロックの内側で排他ロックを
+ * 要求されたら一番外側の解放まで排他ロックに上げる。
+ * 同じように上げようとしている他のプロセスとのデッドロックで
+ * 上げられなかったときは-1を返すので、呼び出し側は書き込みを諦めて
+ * anthy_priv_dic_unlockも呼ばない
+ */
+static int
+priv_dic_lock(int type)
+{
   lock_depth ++;
   if (lock_depth > 1) {
-    return ;
+    if (type == F_WRLCK && lock_type == F_RDLCK) {
+      if (set_lock(F_WRLCK) == -1) {
+	anthy_log(0, "Failed to upgrade the lock of the private dictionary.\n");
+	lock_depth --;
+	return -1;
+      }
+      lock_type = F_WRLCK;
+    }
+    return 0;
   }
   if (!lock_fn) {
-    /* ߥäƤ */
-    lock_fd = -1;
-    return ;
+    /* 初期化をミスってる */
+    return 0;
   }
 
-  /* եåˡ¿뤬ˡcygwinǤưΤǺѤ */
-  lock_fd = open(lock_fn, O_CREAT|O_RDWR, S_IREAD|S_IWRITE);
+  /* ファイルロックの方法は多数あるが、この方法はcygwinでも動くので採用した
+   * ロックファイルは個人辞書ごとに一度だけ開いて使い回す */
   if (lock_fd == -1) {
-    return ;
+    lock_fd = open(lock_fn, O_CREAT|O_RDWR, S_IREAD|S_IWRITE);
+    if (lock_fd == -1) {
+      return 0;
+    }
   }
 
-  lck.l_type = F_WRLCK;
-  lck.l_whence = (short) 0;
-  lck.l_start = (off_t) 0;
-  lck.l_len = (off_t) 1;
-  if (fcntl(lock_fd, F_SETLKW, &lck) == -1) {
-    close(lock_fd);
-    lock_fd = -1;
+  if (set_lock(type) == -1) {
+    close_lock_fd();
+    return 0;
   }
+  lock_type = type;
+  return 0;
+}
+
+/* 個人辞書を更新するときの排他ロック */
+int
+anthy_priv_dic_lock(void)
+{
+  return priv_dic_lock(F_WRLCK);
+}
+
+/* 個人辞書や学習データを読むだけのときの共有ロック */
+void
+anthy_priv_dic_lock_shared(void)
+{
+  priv_dic_lock(F_RDLCK);
 }
 
 void
@@ -136,10 +187,10 @@ anthy_priv_dic_unlock(void)
     return ;
   }
 
-  if (lock_fd != -1) {
-    close(lock_fd);
-    lock_fd = -1;
+  if (lock_fd != -1 && lock_type != F_UNLCK) {
+    set_lock(F_UNLCK);
   }
+  lock_type = F_UNLCK;
 }
 
 void
@@ -169,7 +220,7 @@ anthy_parse_word_line(const char *line, struct word_line *res)
   res->wt[0] = 0;
   res->freq = 1;
   res->word = NULL;
-  /* ʻ٤parse */
+  /* 品詞と頻度をparse */
   for (i = 0; i < 9 && *buf && *buf != '*' && *buf != ' '; buf++, i++) {
     res->wt[i] = *buf;
   }
@@ -186,7 +237,7 @@ anthy_parse_word_line(const char *line, struct word_line *res)
     return -1;
   }
   buf++;
-  /* ñ */
+  /* 単語 */
   res->word = buf;
   return 0;
 }
@@ -237,7 +288,7 @@ anthy_ask_scan(void (*request_scan)(struct textdict *, void *),
 static void
 add_unknown_word(xstr *yomi, xstr *word)
 {
-  /* recordɲ */
+  /* recordに追加 */
   if (anthy_select_section("UNKNOWN_WORD", 1)) {
     return ;
   }
@@ -267,7 +318,7 @@ anthy_add_unknown_word(xstr *yomi, xstr *word)
 void
 anthy_forget_unused_unknown_word(xstr *xs)
 {
-  /* record˵Ͽ줿ʪä */
+  /* recordに記録された物を消す */
   if (anthy_select_section("UNKNOWN_WORD", 0)) {
     return ;
   }
@@ -287,6 +338,7 @@ anthy_init_private_dic(const char *id)
   if (lock_fn) {
     free(lock_fn);
   }
+  close_lock_fd();
   init_lock_fn(home, id);
   /**/
   anthy_private_text_dic = open_textdic(home, "private_words_", id);
@@ -314,6 +366,7 @@ anthy_release_private_dic(void)
     }
   }
   /**/
+  close_lock_fd();
   free(lock_fn);
   lock_fn = NULL;
 }
@@ -1,12 +1,11 @@
 /*
- * ؽʤɤ뤿Υǡ١
- * ʸ(xstr)򥭡ˤƹ®˹(row)򸡺뤳ȤǤ롥
- * ʣΥĤȤǤؽΰ㤦եʤɤб
- *  ( * ʸ -> )
- * ƹԤʸ󤫿ˤʤäƤ
+ * 学習の履歴などを管理するためのデータベース
+ * 文字列(xstr)をキーにして高速に行(row)を検索することができる．
+ * 複数のセクションをもつことができ，学習の違うフェーズなどに対応する
+ *  (セクション * 文字列 -> 行)
+ * 各行は文字列か数を持つ配列になっている
  *
- * ֥ѥȥꥷȥ饤פȤǡ¤ѤƤ롣
- * θʤɤ򰷤äƤ붵ʽ򻲾ȤΤ
+ * 各セクションの行はキーのhash表と、キーの順に並べた配列で引く
  */
 /*
   This library is free software; you can redistribute it and/or
@@ -24,20 +23,22 @@
   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
  */
 /*
- * Funded by IPA̤Ƨեȥ¤ 2002 1/18
- * Funded by IPA̤Ƨեȥ¤ 2005
+ * Funded by IPA未踏ソフトウェア創造事業 2002 1/18
+ * Funded by IPA未踏ソフトウェア創造事業 2005
  * Copyright (C) 2005 YOSHIDA Yuichi
  * Copyright (C) 2000-2007 TABATA Yusuke
  * Copyright (C) 2000-2003 UGAWA Tomoharu
  * Copyright (C) 2001-2002 TAKAI Kosuke
  */
 /*
- * ѡʥƥ""ƿ̾ѡʥƥǤꡤ
- * եؤɤ߽񤭤ϹԤʤ
+ * パーソナリティ""は匿名パーソナリティであり，
+ * ファイルへの読み書きは行わない．
  */
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <string.h>
 #include <stdio.h>
@@ -61,7 +62,7 @@ enum val_type {
   RT_EMPTY, RT_VAL, RT_XSTR, RT_XSTRP
 };
 
-/*  */
+/* 値 */
 struct record_val {
   enum val_type type;
   union {
@@ -71,183 +72,242 @@ struct record_val {
   } u;
 };
 
-/*  */
+/* 行 */
 struct record_row {
   xstr key;
   int nr_vals;
   struct record_val *vals;
 };
 
-/* trie node */
+/* 行のノード */
 struct trie_node {
-  struct trie_node *l;
-  struct trie_node *r;
-  int bit;
   struct record_row row;
-  /* ξü롼 */
+  unsigned int hash; /* row.keyのhash値 */
+  int pending; /* 書き出し待ちの操作の番号+1 */
+  /* 両端ループ */
   struct trie_node *lru_prev;
   struct trie_node *lru_next;
-  int dirty; /* LRU Τ used, sused ӥå */
+  int dirty; /* LRU のための used, sused ビット */
 };
 
-/* trie treeroot */
+/*
+ * セクションの索引
+ * 完全一致はキーのhash値の表を開番地法で引き、prefixでの検索には
+ * キーの順に並べた配列を使う。
+ * ents[0 .. nr_sorted - 1] は整列していて、その後ろに最大
+ * TRIE_DELTA_MAX 個の未整列の追加分が並ぶ
+ * 削除したノードはREMOVEDを付けてentsに残しておき、追加分を併合する
+ * 時か、entsの半分を越えた時にまとめて外す
+ */
 struct trie_root {
+  /* LRUリストの番兵 */
   struct trie_node root;
+  /* LRUリスト上で最後のUSEDのノード、無ければroot */
+  struct trie_node *lru_used_last;
+  struct trie_node **ents;
+  int nr_ents;
+  int nr_sorted;
+  int nr_removed; /* entsに残っているREMOVEDのノードの数 */
+  int ents_size;
+  struct trie_node **hash;
+  int hash_size; /* 2の冪 */
+  int max_key_len; /* これまでに追加された一番長いキーの長さ */
   allocator node_ator;
 };
 
+#define TRIE_DELTA_MAX 32
+
 #define LRU_USED  0x01
 #define LRU_SUSED 0x02
-#define PROTECT   0x04 /* ʬ񤭽Ф˻Ȥ(LRUȤϴطʤ)
-			*   ʬ񤭽ФǤϡե˽񤭽Ф
-			*   ե¾ΥץϿ
-			*   ɤ߹ࡣˤäơ줫ɲä
-			*   ȤΡɤäΤɤ
+#define LRU_MASK  (LRU_USED | LRU_SUSED)
+#define PROTECT   0x04 /* 差分書き出し時に使う(LRUとは関係ない)
+			*   差分書き出しでは、ファイルに書き出す前に
+			*   ファイル上に他のプロセスが記録した更新を
+			*   読み込む。それによって、これから追加しよ
+			*   うとするノードが消されるのを防ぐ
 			*/
+#define REMOVED   0x08 /* 削除されて、entsからまとめて外される
+			*   のを待っている */
+#define READDED   0x10 /* sync_pendingで後から追加されたことを示す */
 /*
  * LRU:
- *   USED:  ǻȤ줿
- *   SUSED: ¸줿 used ӥå
+ *   USED:  メモリ上で使われた
+ *   SUSED: 保存された used ビット
  *
- * LRUꥹȾǤϡ USED ɬꥹƬ¤Ǥ뤬 SUSED 
- * ե饰ʤΥΡɤȺߤƤǽ롣
+ * LRUリスト上では、 USED は必ずリスト先頭に並んでいるが、 SUSED は
+ * フラグなしのノードと混在している可能性がある。
  *
- * nĤĤ褦˻ꤵ줿ư
+ * n個を残すように指定された時の動作
  *    1. used > n
- *        LRU ꥹȤƬ n ܰʹߤä
+ *        LRU リストの先頭から n 番目以降を消す
  *    2. used + sused > n
- *        used -> Ĥ
- *        sused -> sused ե饰
- *        ʳ -> ä
- *    3. ʳ
- *        ƻĤ
- * ե˽񤭽Фˡ used || sused -> sused Ȥƽ񤭽Ф
+ *        used -> 残す
+ *        sused -> sused フラグを落す
+ *        それ以外 -> 消す
+ *    3. それ以外
+ *        全て残す
+ * USEDの末尾を覚えておくので、どちらの場合も消すノードと
+ * フラグを落とすノードだけをたどる
+ * ファイルに書き出す時に、 used || sused -> sused として書き出す
  */
 
-/**  */
+/** セクション */
 struct record_section {
   const char *name;
   struct trie_root cols;
   struct record_section *next;
-  int lru_nr_used, lru_nr_sused; /* LRU  */
+  int lru_nr_used, lru_nr_sused; /* LRU 用 */
+};
+
+/** 差分ファイルへの書き出しを待っている行の操作 */
+enum pending_op {
+  PENDING_TOUCH, /* LRUの更新のみ */
+  PENDING_ADD,   /* 内容を更新した */
+  PENDING_DEL    /* 削除した */
+};
+
+struct pending_row {
+  enum pending_op op;
+  struct record_section *rsc;
+  xstr *key; /* intern されている */
 };
 
-/** ǡ١ */
+/** データベース */
 struct record_stat {
-  struct record_section section_list; /* sectionΥꥹ*/
+  struct record_section section_list; /* sectionのリスト*/
   struct record_section *cur_section;
-  struct trie_root xstrs; /* xstr  intern 뤿 trie */
+  struct trie_root xstrs; /* xstr を intern するための trie */
   struct trie_node *cur_row;
-  int row_dirty; /* cur_row ¸ɬפ뤫 */
+  int row_dirty; /* cur_row が保存の必要があるか */
+  /* 書き出し待ちの行 */
+  struct pending_row *pending;
+  int nr_pending, pending_size;
+  int in_batch; /* anthy_sync_record まで書き出しを待つ */
+  /* 開いたままにしている差分ファイル */
+  FILE *journal_fp;
+  char *journal_buf;
+  dev_t journal_dev;
+  ino_t journal_ino;
+  /* 基本ファイルの更新の統計 */
+  int nr_sync_compactions; /* 同期の中で行った回数 */
+  int nr_idle_compactions; /* 入力待ちの間に行った回数 */
+  long compaction_usec; /* かかった時間の合計 */
+  long max_compaction_usec; /* 一回にかかった最長の時間 */
   /**/
   int is_anon;
-  const char *id;         /* ѡʥƥid */
-  char *base_fn; /* ܥե Хѥ */
-  char *journal_fn; /* ʬե Хѥ */
+  const char *id;         /* パーソナリティのid */
+  char *base_fn; /* 基本ファイル 絶対パス */
+  char *journal_fn; /* 差分ファイル 絶対パス */
   /**/
-  time_t base_timestamp; /* ܥեΥॹ */
-  int last_update;  /* ʬեκǸɤ */
-  time_t journal_timestamp; /* ʬեΥॹ */
+  time_t base_timestamp; /* 基本ファイルのタイムスタンプ */
+  ino_t base_ino; /* 基本ファイルのinode番号 */
+  int last_update;  /* 差分ファイルの最後に読んだ位置 */
+  time_t journal_timestamp; /* 差分ファイルのタイムスタンプ */
 };
 
-/* ʬ100KBۤܥեإޡ */
+/* 差分が100KB越えたら基本ファイルへマージ */
 #define FILE2_LIMIT 102400
+/* anthy_idleを呼ぶクライアントでは普段はそこでマージし、
+ * 差分がこれを越えた時だけ同期のついでにマージする */
+#define FILE2_HARD_LIMIT (FILE2_LIMIT * 10)
+/* 差分ファイルの書き込みバッファ、一回の同期の分はまとめて write する */
+#define JOURNAL_BUF_SIZE 65536
+/* コミットが無くても書き出し待ちの行がこれだけたまったら書き出す */
+#define MAX_PENDING_ROWS 256
 
 
 /*
- * xstr  intern:
- *  Ŀͤ( record_stat )ʸ intern 롣ϡ
- *  ¾ˡǡ١ flush ˥ǡ١
- *  ͳ褹 xstr ̵ˤʤΤɤŪ롣
- *  äơǡ١ flush Ǥ xstr  intern 
- *  Υǡ١ xstrs ϤΤޤ¸롣
+ * xstr の intern:
+ *  個人ごと( record_stat ごと)に文字列を intern する。これは、
+ *  メモリの節約の他に、データベースの flush 時にデータベースに
+ *  由来する xstr が無効になるのを防ぐ目的がある。
+ *  したがって、データベースの flush 時でも xstr の intern 用
+ *  のデータベース xstrs はそのまま保存する。
  *  
- *  xstrs: xstr  intern ѤΥǡ١
- *         row  key  intern 줿 xstr ȤƻȤ
- *         row  value ϻʤ
- *                    (Ūˤϻȥ󥿤ĤƤ⤤)
- *  : intern_xstr()
+ *  xstrs: xstr の intern 用のデータベース
+ *         row の key を intern された xstr として使う。
+ *         row に value は持たない。
+ *                    (将来的には参照カウンタをつけてもいいかも)
+ *  参照: intern_xstr()
  */
 
 /*
- * ʬ񤭽Ф:
- *  ǡ١¸ʣ anthy 饤֥󥯤
- *  ץγؽƱΤˡؽι
- *  ե˽񤭽Ф
+ * 差分書き出し:
+ *  データベースの保存、複数の anthy ライブラリをリンクした
+ *  プロセスの学習履歴の同期のために、学習履歴の更新情報を
+ *  逐一ファイルに書き出す。
  *
- * ܥե  Ť anthy γؽƱ
- *                 ʬŬѤ븵Ȥʤե롣
- *                 Ūˤϵưɤ߹ࡣ
- *                 Υץǥե1baseȸƤ֤Ȥ롣
- * ʬե  ܥեФ빹
- *                 ǡ١Ф빹ߥåȤ뤿Ӥ
- *                 ɤ߽񤭤롣
- *                 Υץǥե2journalȸƤ֤Ȥ롣
- *  :
- *     ǡ١Ф빹ߥåȤȡޤʬե
- *     ¾Υץɲäɤ߹ߡθ˼ʬ
- *     ߥåȤʬե˽񤭽Ф
- *     ϥåեѤƥȥߥå˹Ԥ롣ޤ
- *     ܥե롢ʬեȤ⡢åäƤ֤
- *     ץ󤷤ƤƤϤʤ
- *  ɲäȺ:
- *     ɲäϤǤ˥ǹ줿 row 򥳥ߥåȤˤä
- *     ˽񤭽Фᡢ
- *       1. ߥåо row ʳʬեξ
- *       2. ߥåо row ʬե˽񤭽Ф
- *     Ȥ롣Ϥޤ row ĤäƤ֤ǥߥå
- *     Ԥ(׵򥳥ߥåȤȤư)ᡢ
- *       1. ξʬե˽񤭽Ф
- *       2. ʬեɤ߹ߤˤ׵¹Ԥ
- *     Ȥ롣
- *  ܥեι:
- *     ʬե뤬粽ȡʬեξ
- *     ܥեȿǤƺʬեˤ롣
- *     ץ:
- *       ʬե˽񤭽ФԤä塢ʬե礭Ĵ١
- *       粽ƤСΤȤΥΥǡ١(ˤ
- *       ƤκʬեιŬѤƤ)ܥե
- *       񤭽Ф
- *     ʳΥץ:
- *       ʬեɤˡܥե뤬Ƥ뤫
- *       եΥॹפĴ١ƤСߥå
- *       줿ľ˹եɲä
- *       ǡ١ flush ܥե롢ʬե
- *       ɤ߹ľ
- *       ǡ١ flush ˤꡢ 
- *           cur_row ̵ˤʤ (NULL ˤʤ)
- *           cur_section ͭ¸(sectionϲʤ)
- *           xstr  intern Ƥ¸
- *                              (٤Ƥ xstr  intern ƤϤ)
- *   ɡͤˤʤ:
- *     if (ܥե뤬Ƥ) {
- *             ʬեإߥåȤ줿񤭽Ф;
- *             ǡ١Υեå;
- *             ܥեɹȺʬեκǽɹ֥ꥢ;
- *             ʬեɹȺʬեκǽɹֹ;
+ * ・基本ファイル  古い anthy の学習履歴と同じ形式。
+ *                 差分情報を適用する元となるファイル。
+ *                 基本的には起動時だけに読み込む。
+ *                 このプログラム中でファイル1，baseと呼ぶことがある。
+ * ・差分ファイル  基本ファイルに対する更新情報。
+ *                 データベースに対する更新がコミットされるたびに
+ *                 読み書きされる。
+ *                 このプログラム中でファイル2，journalと呼ぶことがある。
+ *  基本方針:
+ *     データベースに対する更新がコミットされると、まず差分ファイル
+ *     に他のプロセスが追加した更新情報を読み込み、その後に自分の
+ *     コミットした更新を差分ファイルに書き出す。
+ *     これらはロックファイルを用いてアトミックに行われる。また、
+ *     基本ファイル、差分ファイルとも、ロックを取っている間しか
+ *     オープンしていてはいけない。
+ *  追加と削除:
+ *     追加はすでにメモリ上で更新された row をコミットによって
+ *     メモリに書き出すため、
+ *       1. コミット対象 row 以外を差分ファイルの情報で
+ *       2. コミット対象 row を差分ファイルに書き出し
+ *     とする。削除はまだメモリ上に row が残っている状態でコミット
+ *     が行われる(削除要求をコミットとして扱う)ため、
+ *       1. 削除の情報を差分ファイルに書き出し
+ *       2. 差分ファイルの読み込みにより削除要求も実行する
+ *     とする。
+ *  基本ファイルの更新:
+ *     差分ファイルがある程度肥大化すると、差分ファイルの情報を
+ *     基本ファイルに反映して差分ファイルを空にする。
+ *     更新するプロセス:
+ *       差分ファイルに書き出しを行った後、差分ファイルの大きさを調べ、
+ *       肥大化していれば、そのときのメモリ上のデータベース(これには
+ *       全ての差分ファイルの更新が適用されている)を基本ファイルに
+ *       書き出す。
+ *     それ以外のプロセス:
+ *       差分ファイルを読む前に、基本ファイルが更新されているかを
+ *       ファイルのタイムスタンプで調べ、更新されていれば、コミット
+ *       された更新情報を直ちに更新ファイルに追加し、メモリ上の
+ *       データベースを flush した後基本ファイル、差分ファイルを
+ *       読み込み直す。
+ *       データベースの flush により、 
+ *           ・cur_row が無効になる (NULL になる)
+ *           ・cur_section の有効性は保存される(sectionは解放しない)
+ *           ・xstr は intern していれば保存される
+ *                              (すべての xstr は intern されているはず)
+ *   結局、次の様になる:
+ *     if (基本ファイルが更新されている) {
+ *             差分ファイルへコミットされた更新を書き出す;
+ *             データベースのフラッシュ;
+ *             基本ファイルの読込と差分ファイルの最終読込位置クリア;
+ *             差分ファイルの読込と差分ファイルの最終読込位置更新;
  *     } else {
- *             if (ɲ) {
- *                     ʬեɹȺʬեκǽɹֹ;
- *                     ʬեؤν񤭽Ф;
+ *             if (追加) {
+ *                     差分ファイルの読込と差分ファイルの最終読込位置更新;
+ *                     差分ファイルへの書き出し;
  *             } else {
- *                     ʬեؤν񤭽Ф;
- *                     ʬեɹȺʬեκǽɹֹ;
+ *                     差分ファイルへの書き出し;
+ *                     差分ファイルの読込と差分ファイルの最終読込位置更新;
  *             }
  *     }
- *     if (ʬե뤬礭) {
- *             ܥեؤν񤭽Ф;
- *             ʬեΥꥢ;
+ *     if (差分ファイルが大きい) {
+ *             基本ファイルへの書き出し;
+ *             差分ファイルのクリア;
  *     }
  */
 
 static allocator record_ator;
+/* クライアントがanthy_idleを呼んで基本ファイルを更新している */
+static int idle_compaction;
 
-/* trie */
+/* trie操作用 */
 static void init_trie_root(struct trie_root *n);
-static int trie_key_nth_bit(xstr* key, int n);
-static int trie_key_first_diff_bit_1byte(xchar c1, xchar c2);
-static int trie_key_first_diff_bit(xstr *k1, xstr *k2);
-static int trie_key_cmp(xstr *k1, xstr *k2);
 static void trie_key_dup(xstr *dst, xstr *src);
 static void trie_row_init(struct record_row *rc);
 static void trie_row_free(struct record_row *rc);
@@ -268,51 +328,27 @@ static void trie_mark_used(struct trie_root *root, struct trie_node *n,
 
 
 /* 
- * ȥ饤μ
- * struct trie_nodeΤrowʳʬrow.key
- * λtrie_row_freeȤärowƤ
+ * 索引の実装
+ * 以前はxcharのビットで分岐するPATRICIA trieだったが、ノードを
+ * たどるたびにキャッシュミスが起きるので、hash表と整列した配列にした。
+ * 関数名などはtrieのままにしてある
+ * struct trie_nodeのうちrow以外の部分とrow.keyを使用
+ * 削除の時はtrie_row_freeを使ってrowの内容を解放
  */
 
-#define PUTNODE(x) ((x) == &root->root ? printf("root\n") : anthy_putxstrln(&(x)->row.key))
 static int
-debug_trie_dump(FILE* fp, struct trie_node* n, int encoding)
+debug_trie_dump(FILE* fp, struct trie_root* root, int encoding)
 {
-  int cnt = 0;
+  int i;
   char buf[1024];
 
-  if (n->l->bit > n->bit) {
-    cnt = debug_trie_dump(fp, n->l, encoding);
-  } else {
-    if (n->l->row.key.len == -1) {
-      if (fp) {
-	fprintf(fp, "root\n");
-      }
-    } else {
-      if (fp) {
-	anthy_sputxstr(buf, &n->l->row.key, encoding);
-	fprintf(fp, "%s\n", buf);
-      }
-      cnt = 1;
-    }
-  }
-
-  if (n->r->bit > n->bit) {
-    return cnt + debug_trie_dump(fp, n->r, encoding);
-  } else {
-    if (n->r->row.key.len == -1) {
-      if(fp) {
-	fprintf(fp, "root\n");
-      }
-    } else {
-      if(fp) {
-	anthy_sputxstr(buf, &n->r->row.key, encoding);
-	fprintf(fp, "%s\n", buf);
-      }
-      return cnt + 1;
+  for (i = 0; i < root->nr_ents; i++) {
+    if (fp && !(root->ents[i]->dirty & REMOVED)) {
+      anthy_sputxstr(buf, &root->ents[i]->row.key, encoding);
+      fprintf(fp, "%s%s\n", i < root->nr_sorted ? "" : "+", buf);
     }
   }
-
-  return cnt;
+  return root->nr_ents - root->nr_removed;
 }
 
 static void
@@ -321,195 +357,243 @@ init_trie_root(struct trie_root *root)
   struct trie_node* n;
   root->node_ator = anthy_create_allocator(sizeof(struct trie_node), NULL);
   n = &root->root;
-  n->l = n;
-  n->r = n;
-  n->bit = 0;
   n->lru_next = n;
   n->lru_prev = n;
   n->dirty = 0;
+  n->pending = 0;
+  root->lru_used_last = n;
+  root->ents = NULL;
+  root->nr_ents = 0;
+  root->nr_sorted = 0;
+  root->nr_removed = 0;
+  root->ents_size = 0;
+  root->hash = NULL;
+  root->hash_size = 0;
+  root->max_key_len = 0;
   trie_row_init(&n->row);
   n->row.key.len = -1;
 }
 
-/*
- * bit0: 0
- * bit1: headΥ0
- * bit2: ʸΥӥå0
- * bit3: ʸΥӥå1
- *   ...
- * ʸĹۤ0
- */
-static int
-trie_key_nth_bit(xstr* key, int n)
+static unsigned int
+trie_key_hash(xstr *key)
 {
-  switch (n) {
-  case 0:
-    return 0;
-  case 1:
-    return key->len + 1; /* key->len == -1 ? 0 : non-zero */
-  default:
-    {
-      int pos;
-      n -= 2;
-      pos = n / (sizeof(xchar) << 3);
-      if (pos >= key->len) {
-	return 0;
-      }
-      return key->str[pos] & (1 << (n % (sizeof(xchar) << 3)));
+  unsigned int dummy;
+  return anthy_xstr_hash_pair(key, &dummy);
+}
+
+/* key をもつノードの入っている、または入るべき表の位置 */
+static struct trie_node **
+trie_hash_slot(struct trie_root *root, xstr *key, unsigned int hash)
+{
+  unsigned int mask = root->hash_size - 1;
+  unsigned int i = hash & mask;
+  struct trie_node *n;
+  while ((n = root->hash[i])) {
+    if (n->hash == hash && !anthy_xstrcmp(&n->row.key, key)) {
+      break;
     }
+    i = (i + 1) & mask;
   }
+  return &root->hash[i];
 }
 
-/* c1 == c2 ǤϸƤǤϤʤ */
-static int
-trie_key_first_diff_bit_1byte(xchar c1, xchar c2)
+static void
+trie_hash_grow(struct trie_root *root)
 {
   int i;
-  int ptn;
-  for (i = 0, ptn = c1 ^ c2; !(ptn & 1); i++, ptn >>= 1 )
-    ;
-  return i;
+  free(root->hash);
+  root->hash_size = root->hash_size ? root->hash_size * 2 : 16;
+  root->hash = calloc(root->hash_size, sizeof(struct trie_node *));
+  for (i = 0; i < root->nr_ents; i++) {
+    struct trie_node *n = root->ents[i];
+    if (!(n->dirty & REMOVED)) {
+      *trie_hash_slot(root, &n->row.key, n->hash) = n;
+    }
+  }
 }
 
-/*
- * k1 == k2 ǤϸƤǤϤʤ
- * ki->str[0 .. (ki->len - 1)]0ϤʤȲ
- */
-#define MIN(a,b) ((a)<(b)?(a):(b))
-static int
-trie_key_first_diff_bit(xstr *k1, xstr *k2)
+/* 後ろの要素を詰めて、開番地法の探索列が途切れないようにする */
+static void
+trie_hash_remove(struct trie_root *root, struct trie_node *p)
 {
-  int len;
-  int i;
+  unsigned int mask = root->hash_size - 1;
+  unsigned int i = p->hash & mask;
+  unsigned int j, k;
 
-  len = MIN(k1->len, k2->len);
-  if (len == -1) {
-    return 1;
+  while (root->hash[i] != p) {
+    i = (i + 1) & mask;
   }
-  for ( i = 0 ; i < len ; i++ ){
-    if (k1->str[i] != k2->str[i]) {
-      return (2 + (i * (sizeof(xchar) << 3)) + 
-	      trie_key_first_diff_bit_1byte(k1->str[i], k2->str[i]));
+  for (j = (i + 1) & mask; root->hash[j]; j = (j + 1) & mask) {
+    k = root->hash[j]->hash & mask;
+    /* 本来の位置が (i, j] にあるものは動かさない */
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) {
+      continue;
     }
+    root->hash[i] = root->hash[j];
+    i = j;
   }
-  if (k1->len < k2->len) {
-    return (2 + (i * (sizeof(xchar) << 3)) +
-	    trie_key_first_diff_bit_1byte(0, k2->str[i]));
-  } else {
-    return (2 + (i * (sizeof(xchar) << 3)) +
-	    trie_key_first_diff_bit_1byte(k1->str[i], 0));
-  }
+  root->hash[i] = NULL;
+}
+
+static int
+trie_ent_cmp(const void *p1, const void *p2)
+{
+  struct trie_node *n1 = *(struct trie_node **)p1;
+  struct trie_node *n2 = *(struct trie_node **)p2;
+  return anthy_xstrcmp(&n1->row.key, &n2->row.key);
 }
-#undef MIN
 
+/* ents[0 .. hi - 1] で key 以上になる最初の位置を返す */
 static int
-trie_key_cmp(xstr *k1, xstr *k2)
+trie_lower_bound_n(struct trie_root *root, xstr *key, int hi)
 {
-  if (k1->len == -1 || k2->len == -1) {
-    return k1->len - k2->len;
+  int lo = 0;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (anthy_xstrcmp(key, &root->ents[mid]->row.key) > 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
   }
-  return anthy_xstrcmp(k1, k2);
+  return lo;
+}
+
+/* 整列済みの部分で key 以上になる最初の位置を返す */
+static int
+trie_lower_bound(struct trie_root *root, xstr *key)
+{
+  return trie_lower_bound_n(root, key, root->nr_sorted);
 }
 
+/* REMOVEDの付いたノードをentsから一度に外して解放する */
 static void
-trie_key_dup(xstr *dst, xstr *src)
+trie_compact_ents(struct trie_root *root)
 {
-  dst->str = anthy_xstr_dup_str(src);
-  dst->len = src->len;
+  int i, j, nr_sorted = root->nr_sorted;
+
+  for (i = 0, j = 0; i < root->nr_ents; i++) {
+    struct trie_node *p = root->ents[i];
+    if (p->dirty & REMOVED) {
+      if (i < root->nr_sorted) {
+	nr_sorted --;
+      }
+      trie_row_free(&p->row);
+      anthy_sfree(root->node_ator, p);
+      continue;
+    }
+    root->ents[j] = p;
+    j ++;
+  }
+  root->nr_ents = j;
+  root->nr_sorted = nr_sorted;
+  root->nr_removed = 0;
 }
 
 /*
- * Ĥʤ 0 
+ * 未整列の追加分を整列して、整列済みの部分に後ろから併合する
+ * 挿入位置は二分探索で求めて、間の要素はまとめて動かす
+ * どちらにしても全体を動かすので、削除したノードもここで外す
  */
-static struct trie_node *
-trie_find(struct trie_root *root, xstr *key)
+static void
+trie_merge_delta(struct trie_root *root)
 {
-  struct trie_node *p;
-  struct trie_node *q;
+  struct trie_node *delta[TRIE_DELTA_MAX];
+  int nr, hi, j, pos;
+
+  if (root->nr_removed) {
+    trie_compact_ents(root);
+  }
+  nr = root->nr_ents - root->nr_sorted;
+  hi = root->nr_sorted;
+  memcpy(delta, &root->ents[root->nr_sorted], sizeof(delta[0]) * nr);
+  qsort(delta, nr, sizeof(delta[0]), trie_ent_cmp);
+  for (j = nr - 1; j >= 0; j--) {
+    pos = trie_lower_bound_n(root, &delta[j]->row.key, hi);
+    memmove(&root->ents[pos + j + 1], &root->ents[pos],
+	    sizeof(delta[0]) * (hi - pos));
+    root->ents[pos + j] = delta[j];
+    hi = pos;
+  }
+  root->nr_sorted = root->nr_ents;
+}
 
-  p = &root->root;
-  q = p->l;
-  while (p->bit < q->bit) {
-    p = q;
-    q = trie_key_nth_bit(key, p->bit) ? p->r : p->l;
+static void
+trie_add_ent(struct trie_root *root, struct trie_node *n)
+{
+  if (root->nr_ents == root->ents_size) {
+    root->ents_size = root->ents_size ? root->ents_size * 2 : 16;
+    root->ents = realloc(root->ents,
+			 sizeof(struct trie_node *) * root->ents_size);
+  }
+  root->ents[root->nr_ents] = n;
+  root->nr_ents ++;
+  if (root->nr_ents * 2 > root->hash_size) {
+    trie_hash_grow(root);
+  } else {
+    *trie_hash_slot(root, &n->row.key, n->hash) = n;
   }
-  return trie_key_cmp(&q->row.key,key) ? NULL : q; 
+  if (n->row.key.len > root->max_key_len) {
+    root->max_key_len = n->row.key.len;
+  }
+  if (root->nr_ents - root->nr_sorted == TRIE_DELTA_MAX) {
+    trie_merge_delta(root);
+  }
+}
+
+static void
+trie_key_dup(xstr *dst, xstr *src)
+{
+  dst->str = anthy_xstr_dup_str(src);
+  dst->len = src->len;
 }
 
 /*
- * ĹޥåΤؿ
- *  key õơϤưפʤʤäΡɤ֤
+ * 見つからなければ 0 
  */
 static struct trie_node *
-trie_find_longest (struct trie_root* root, xstr *key)
+trie_find(struct trie_root *root, xstr *key)
 {
-  struct trie_node *p;
-  struct trie_node *q;
-
-  p = &root->root;
-  q = p->l;
-  while (p->bit < q->bit) {
-    p = q;
-    q = trie_key_nth_bit(key, p->bit) ? p->r : p->l;
+  if (!root->hash || key->len > root->max_key_len) {
+    return NULL;
   }
-
-  return q;
+  return *trie_hash_slot(root, key, trie_key_hash(key));
 }
 
 /* 
- * ɲäΡɤ֤
- * ǤƱĥΡɤȤϡɲä0֤
+ * 追加したノードを返す
+ * すでに同じキーをもつノードがあるときは、追加せずに0を返す
  */
 static struct trie_node *
 trie_insert(struct trie_root *root, xstr *key,
 	    int dirty, int *nr_used, int *nr_sused)
 {
   struct trie_node *n;
-  struct trie_node *p;
   struct trie_node *q;
-  int i;
 
-  p = &root->root;
-  q = p->l;
-  while (p->bit < q->bit) {
-    p = q;
-    q = trie_key_nth_bit(key, p->bit) ? p->r : p->l;
-  }
-  if (trie_key_cmp(&q->row.key,key) == 0) {
-    /* USED > SUSED > 0 ǶĤ */
+  q = trie_find(root, key);
+  if (q) {
+    /* USED > SUSED > 0 で強い方を残す */
     if (dirty == LRU_USED) {
       trie_mark_used(root, q, nr_used, nr_sused);
-    } else if (q->dirty == 0) {
-      q->dirty = dirty;
+    } else if ((q->dirty & LRU_MASK) == 0) {
+      q->dirty |= dirty;
     }
     return 0;
   }
-  i = trie_key_first_diff_bit(&q->row.key, key);
-  p = &root->root;
-  q = p->l;
-  while (p->bit < q->bit && i > q->bit) {
-    p = q;
-    q = trie_key_nth_bit(key, p->bit) ? p->r : p->l;
-  }
   n = anthy_smalloc(root->node_ator);
   trie_row_init(&n->row);
   trie_key_dup(&n->row.key, key);
-  n->bit = i;
-  if (trie_key_nth_bit(key, i)) {
-    n->l = q;
-    n->r = n;
-  } else {
-    n->l = n;
-    n->r = q;
-  }
-  if (p->l == q) {
-    p->l = n;
-  } else {
-    p->r = n;
-  }
+  n->hash = trie_key_hash(key);
+  /* trie_add_entでREMOVEDのノードが外されるので、先にフラグを設定する */
+  n->dirty = dirty;
+  trie_add_ent(root, n);
 
-  /* LRU ν */
+  /* LRU の処理 */
   if (dirty == LRU_USED) {
+    if (root->lru_used_last == &root->root) {
+      root->lru_used_last = n;
+    }
     root->root.lru_next->lru_prev = n;
     n->lru_prev = &root->root;
     n->lru_next = root->root.lru_next;
@@ -524,78 +608,61 @@ trie_insert(struct trie_root *root, xstr *key,
       (*nr_sused)++;
     }
   }
-  n->dirty = dirty;
   return n;
 }
 
-/* 
- * Ρɤ򸫤ĤȺ
- * trie_row_freeƤӡޤǡʬfree
- *
- * ǡȥΡɤ롣
- * оݤΥǡϺоݤΥΡɤ˳ǼƤȤ
- * ¤ʤȤա
- * 1. оݤդĥΡɤ˺оݤդޤޤƤȤ
- *  оݤΥΡɤϡҤؤλޤΤΤޤƤϤƻ
- * 2. оݤդĥΡɤ˺оݤդޤޤƤȤ
- *  1. ˲äơоݤդĥΡɤ򻦤ơ˺
- *  оݤΥΡɤоݤդĥΡɤΰ֤˰ư
- */
+/* ノードをhash表とLRUリストから外す、entsからは外さない */
 static void
-trie_remove(struct trie_root *root, xstr *key, 
+trie_detach(struct trie_root *root, struct trie_node *p,
 	    int *nr_used, int *nr_sused)
 {
-  struct trie_node *p;
-  struct trie_node *q;
-  struct trie_node **pp = NULL; /* gcc  warning  */
-  struct trie_node **qq;
-  p = &root->root;
-  qq = &p->l;
-  q = *qq;
-  while (p->bit < q->bit) {
-    pp = qq;
-    p = q;
-    qq = trie_key_nth_bit(key,p->bit) ? &p->r : &p->l;
-    q = *qq;
-  }
-  if (trie_key_cmp(&q->row.key, key) != 0) {
-    return ;
-  }
-  if (p != q) {
-    /* case 2. */
-    struct trie_node *r;
-    struct trie_node *s;
-    r = &root->root;
-    s = r->l;
-    while (s != q) {
-      r = s;
-      s = trie_key_nth_bit(key, r->bit) ? r->r : r->l;
-    }
-    *pp = (p->r == q) ? p->l : p->r;
-    p->l = q->l;
-    p->r = q->r;
-    p->bit = q->bit;
-    if (trie_key_nth_bit(key, r->bit)) {
-      r->r = p;
-    } else {
-      r->l = p;
-    }
-    p = q;
-  } else {
-    *pp = (p->r == q) ? p->l : p->r;
+  trie_hash_remove(root, p);
+  if (root->lru_used_last == p) {
+    root->lru_used_last = p->lru_prev;
   }
   p->lru_prev->lru_next = p->lru_next;
   p->lru_next->lru_prev = p->lru_prev;
-  if (p->dirty == LRU_USED) {
+  if ((p->dirty & LRU_MASK) == LRU_USED) {
     (*nr_used)--;
-  } else if (p->dirty == LRU_SUSED) {
+  } else if ((p->dirty & LRU_MASK) == LRU_SUSED) {
     (*nr_sused)--;
   }
-  trie_row_free(&p->row);
-  anthy_sfree(root->node_ator, p);
 }
 
-/* headʳΥΡɤʤ 0 ֤ */
+/*
+ * ノードをhash表とLRUリストから外し、entsからは後でまとめて外す
+ * 消したノードがentsの半分を越えたら、ここで外して解放する
+ */
+static void
+trie_remove_later(struct trie_root *root, struct trie_node *p,
+		  int *nr_used, int *nr_sused)
+{
+  trie_detach(root, p, nr_used, nr_sused);
+  p->dirty |= REMOVED;
+  root->nr_removed ++;
+  if (root->nr_removed * 2 > root->nr_ents) {
+    trie_compact_ents(root);
+  }
+}
+
+/* 
+ * ノードを見つけると削除する
+ * キーを含むデータ部分はentsから外す時にtrie_row_freeで解放する
+ */
+static void
+trie_remove(struct trie_root *root, xstr *key, 
+	    int *nr_used, int *nr_sused)
+{
+  struct trie_node *p;
+
+  p = trie_find(root, key);
+  if (!p) {
+    return ;
+  }
+  trie_remove_later(root, p, nr_used, nr_sused);
+}
+
+/* head以外のノードがなければ 0 を返す */
 static struct trie_node *
 trie_first (struct trie_root *root)
 {
@@ -603,7 +670,7 @@ trie_first (struct trie_root *root)
     NULL : root->root.lru_next;
 }
 
-/* ΥΡɤʤ 0 ֤ */
+/* 次のノードがなければ 0 を返す */
 static struct trie_node *
 trie_next (struct trie_root *root,
 	   struct trie_node *cur)
@@ -612,25 +679,34 @@ trie_next (struct trie_root *root,
 }
 
 /*
- * headʳƤΥΡɤ
- * trie_row_freeƤӡޤǡʬfree
+ * head以外全てのノードを削除する
+ * 内部でtrie_row_freeを呼び、キーを含むデータ部分をfreeする
  */
 static void 
 trie_remove_all (struct trie_root *root,
 		 int *nr_used, int *nr_sused)
 {
   struct trie_node* p;
+  int i;
   for (p = root->root.lru_next; p != &root->root; p = p->lru_next) {
     trie_row_free(&p->row);
   }
+  for (i = 0; i < root->nr_ents; i++) {
+    if (root->ents[i]->dirty & REMOVED) {
+      trie_row_free(&root->ents[i]->row);
+    }
+  }
   anthy_free_allocator(root->node_ator);
+  free(root->ents);
+  free(root->hash);
   init_trie_root(root);
   *nr_used = 0;
   *nr_sused = 0;
 }
 
 /*
- * LRU ꥹȤƬ count ܤޤǤĤƻĤ
+ * LRU リストの先頭から count 番目までを残して残りを解放する
+ * 消したノードはtrie_remove_laterでまとめてentsから外す
  */
 static void
 trie_remove_old (struct trie_root *root, int count, 
@@ -640,26 +716,25 @@ trie_remove_old (struct trie_root *root, int count,
   struct trie_node *q;
 
   if (*nr_used > count) {
-    for (p = root->root.lru_next; count; count--, p = p->lru_next)
-      ;
-    /* p  head ޤǤä */
-    for ( ; p != &root->root; p = q) {
-      q = p->lru_next;
-      trie_remove(root, &p->row.key, nr_used, nr_sused);
+    /* 末尾から消していき、先頭から count 個のUSEDだけを残す */
+    for (p = root->root.lru_prev;
+	 p != &root->root &&
+	   ((p->dirty & LRU_MASK) != LRU_USED || *nr_used > count);
+	 p = q) {
+      q = p->lru_prev;
+      trie_remove_later(root, p, nr_used, nr_sused);
     }
   } else if (*nr_used + *nr_sused > count) {
-    for (p = root->root.lru_next; p->dirty == LRU_USED; p = p->lru_next)
-      ; 
     /*
-     * p  root ޤ  sused    -> dirty := 0
-     *                   ʳ -> ä
+     * USED の次から root まで  sused    -> dirty := 0
+     *                          それ以外 -> 消す
      */
-    for ( ; p != &root->root; p = q) {
+    for (p = root->lru_used_last->lru_next; p != &root->root; p = q) {
       q = p->lru_next;
-      if (p->dirty == LRU_SUSED) {
-	p->dirty = 0;
+      if ((p->dirty & LRU_MASK) == LRU_SUSED) {
+	p->dirty &= ~LRU_MASK;
       } else {
-	trie_remove(root, &p->row.key, nr_used, nr_sused);
+	trie_remove_later(root, p, nr_used, nr_sused);
       }
     }
     *nr_sused = 0;
@@ -670,15 +745,26 @@ static void
 trie_mark_used (struct trie_root *root, struct trie_node *n,
 		int *nr_used, int *nr_sused)
 {
-  switch(n->dirty) {
+  if (root->root.lru_next == n && (n->dirty & LRU_MASK) == LRU_USED) {
+    /* すでに先頭にある */
+    return ;
+  }
+  switch(n->dirty & LRU_MASK) {
   case LRU_USED:
+    if (root->lru_used_last == n) {
+      root->lru_used_last = n->lru_prev;
+    }
     break;
   case LRU_SUSED:
     (*nr_sused)--;
     /* fall through */
   default:
-    n->dirty = LRU_USED;
+    /* PROTECTは残す */
+    n->dirty = (n->dirty & ~LRU_MASK) | LRU_USED;
     (*nr_used)++;
+    if (root->lru_used_last == &root->root) {
+      root->lru_used_last = n;
+    }
     break;
   }
   n->lru_prev->lru_next = n->lru_next;
@@ -690,7 +776,7 @@ trie_mark_used (struct trie_root *root, struct trie_node *n,
 }
 
 /*
- * ȥ饤μϤޤ
+ * 索引の実装はここまで
  */
 
 static xstr *
@@ -730,16 +816,17 @@ do_select_section(struct record_stat *rst, const char *name, int flag)
 static struct trie_node* 
 do_select_longest_row(struct record_section *rsc, xstr *name)
 {
-  struct trie_node *mark, *found;
+  struct trie_node *found;
   xstr xs;
   int i;
 
-  mark = trie_find_longest(&rsc->cols, name);
   xs.str = name->str;
-  for (i = mark->row.key.len; i > 1; i--) {
-    /* 롼ȥΡɤ i == 1 ǥޥåΤǽ
-     * trie_key_nth_bit 
-     */
+  i = name->len;
+  if (i > rsc->cols.max_key_len) {
+    i = rsc->cols.max_key_len;
+  }
+  /* 一文字のキーは対象にしない */
+  for (; i > 1; i--) {
     xs.len = i;
     found = trie_find(&rsc->cols, &xs);
     if (found) {
@@ -936,13 +1023,24 @@ do_get_nth_xstr(struct trie_node *node, int n)
   return 0;
 }
 
-static void
+/* 書き込めないときは-1を返す、そのときはunlock_recordを呼ばない */
+static int
 lock_record (struct record_stat* rs)
+{
+  if (rs->is_anon) {
+    return 0;
+  }
+  return anthy_priv_dic_lock();
+}
+
+/* 読むだけのときは他のプロセスと同時に読めるようにする */
+static void
+lock_record_shared (struct record_stat* rs)
 {
   if (rs->is_anon) {
     return ;
   }
-  anthy_priv_dic_lock();
+  anthy_priv_dic_lock_shared();
 }
 
 static void
@@ -954,8 +1052,8 @@ unlock_record (struct record_stat* rs)
   anthy_priv_dic_unlock();
 }
 
-/* ɤ߹ߤɬפ뤫å
- * ɬפ֤ͤ1ˤʤ */
+/* 再読み込みの必要があるかをチェックする
+ * 必要があれば返り値が1になる */
 static int
 check_base_record_uptodate(struct record_stat *rst)
 {
@@ -966,7 +1064,8 @@ check_base_record_uptodate(struct record_stat *rst)
   anthy_check_user_dir();
   if (stat(rst->base_fn, &st) < 0) {
     return 0;
-  } else if (st.st_mtime != rst->base_timestamp) {
+  } else if (st.st_mtime != rst->base_timestamp ||
+	     st.st_ino != rst->base_ino) {
     return 0;
   }
   return 1;
@@ -976,15 +1075,15 @@ check_base_record_uptodate(struct record_stat *rst)
 /*
  * row format:
  *  ROW := OPERATION SECTION KEY VALUE*
- *  OPERATION := "ADD"    (ɲäޤLRU)
- *               "DEL"    ()
- *  SECTION := (ʸ)
+ *  OPERATION := "ADD"    (追加またはLRU更新)
+ *               "DEL"    (削除)
+ *  SECTION := (文字列)
  *  KEY     := TD
  *  VALUE   := TD
- *  TD      := TYPE DATA  (򤢤˽)
+ *  TD      := TYPE DATA  (空白をあけずに書く)
  *  TYPE    := "S"        (xstr)
  *             "N"        (number)
- *  DATA    := (Ȥ˥ꥢ饤)
+ *  DATA    := (型ごとにシリアライズしたもの)
  */
 
 static char*
@@ -1036,7 +1135,7 @@ out:
   return s;
 }
 
-/* journalADDιԤɤ */
+/* journalからADDの行を読む */
 static void
 read_add_row(FILE *fp, struct record_stat* rst,
 	     struct record_section* rsc)
@@ -1052,7 +1151,7 @@ read_add_row(FILE *fp, struct record_stat* rst,
     return ;
   }
 
-  xs = anthy_cstr_to_xstr(/* xstr ɽ S ɤ߼ΤƤ */
+  xs = anthy_cstr_to_xstr(/* xstr 型を表す S を読み捨てる */
 			  token + 1,
 			  ANTHY_UTF8_ENCODING);
   node = do_select_row(rsc, xs, 1, LRU_USED);
@@ -1060,7 +1159,7 @@ read_add_row(FILE *fp, struct record_stat* rst,
   free(token);
 
   if (node->dirty & PROTECT) {
-    /* ¸٤ row ʤΤǡʬեɤ߼ΤƤ */
+    /* 保存すべき row なので、差分ファイルを読み捨てる */
     while (!eol) {
       free(read_1_token(fp, &eol));
     }
@@ -1072,7 +1171,7 @@ read_add_row(FILE *fp, struct record_stat* rst,
     token = read_1_token(fp, &eol);
     if (token) {
       switch(*token) {
-	/* String ʸ */
+	/* String 文字列 */
       case 'S':
 	{
 	  xstr* xs;
@@ -1081,7 +1180,7 @@ read_add_row(FILE *fp, struct record_stat* rst,
 	  anthy_free_xstr(xs);
 	}
 	break;
-	/* Number  */
+	/* Number 数値 */
       case 'N':
 	do_set_nth_value(node, n, atoi(token + 1));
 	break;
@@ -1093,7 +1192,7 @@ read_add_row(FILE *fp, struct record_stat* rst,
   do_truncate_row(node, n);
 }
 
-/* journalDELιԤɤ */
+/* journalからDELの行を読む */
 static void
 read_del_row(FILE *fp, struct record_section* rsc)
 {
@@ -1107,7 +1206,7 @@ read_del_row(FILE *fp, struct record_section* rsc)
     return ;
   }
 
-  xs = anthy_cstr_to_xstr(/* xstr ɽ S ɤФ */
+  xs = anthy_cstr_to_xstr(/* xstr 型を表す S を読み飛ばす */
 			  token + 1,
 			  ANTHY_UTF8_ENCODING);
   if ((node = do_select_row(rsc, xs, 0, 0)) != NULL) {
@@ -1117,7 +1216,7 @@ read_del_row(FILE *fp, struct record_section* rsc)
   free(token);
 }
 
-/** ʬե뤫1ɤ߹ */
+/** 差分ファイルから1行読み込む */
 static void
 read_1_row(struct record_stat* rst, FILE* fp, char *op)
 {
@@ -1144,7 +1243,7 @@ read_1_row(struct record_stat* rst, FILE* fp, char *op)
 }
 
 /*
- * journal(ʬ)եɤ
+ * journal(差分)ファイルを読む
  */
 static void
 read_journal_record(struct record_stat* rs)
@@ -1164,8 +1263,8 @@ read_journal_record(struct record_stat* rs)
     return ;
   }
   if (st.st_size < rs->last_update) {
-    /* ե륵ʤäƤΤǡ
-     * ǽ餫ɤ߹ */
+    /* ファイルサイズが小さくなっているので、
+     * 最初から読み込む */
     fseek(fp, 0, SEEK_SET);
   } else {
     fseek(fp, rs->last_update, SEEK_SET);
@@ -1190,7 +1289,7 @@ write_string(FILE* fp, const char* str)
   fprintf(fp, "%s", str);
 }
 
-/* ֥륯Ȥ⤷ϥХåå˥Хååդ */
+/* ダブルクオートもしくはバックスラッシュにバックスラッシュを付ける */
 static void
 write_quote_string(FILE* fp, const char* str)
 {
@@ -1220,19 +1319,11 @@ write_number(FILE* fp, int x)
   fprintf(fp, "%d", x);
 }
 
-/* journal1ɵ */
 static void
-commit_add_row(struct record_stat* rst,
-	       const char* sname, struct trie_node* node)
+write_add_row(FILE *fp, const char* sname, struct trie_node* node)
 {
-  FILE* fp;
   int i;
 
-  fp = fopen(rst->journal_fn, "a");
-  if (fp == NULL) {
-    return;
-  }
-
   write_string(fp, "ADD \"");
   write_quote_string(fp, sname);
   write_string(fp, "\" S\"");
@@ -1261,11 +1352,145 @@ commit_add_row(struct record_stat* rst,
     }
   }
   write_string(fp, "\n");
-  rst->last_update = ftell(fp);
-  fclose(fp);
 }
 
-/* Ƥ row  */
+static void
+write_del_row(FILE *fp, const char* sname, xstr *key)
+{
+  write_string(fp, "DEL \"");
+  write_quote_string(fp, sname);
+  write_string(fp, "\" S\"");
+  write_quote_xstr(fp, key);
+  write_string(fp, "\"");
+  write_string(fp, "\n");
+}
+
+static void
+close_journal(struct record_stat* rst)
+{
+  if (rst->journal_fp) {
+    fclose(rst->journal_fp);
+    rst->journal_fp = NULL;
+  }
+  free(rst->journal_buf);
+  rst->journal_buf = NULL;
+}
+
+/*
+ * 追記用に差分ファイルを開く、ロックを取った状態で呼ぶ
+ * 前回開いたものがまだ有効ならばそれを使い続ける
+ * 基本ファイルの更新で消されていたら開き直す
+ */
+static FILE *
+open_journal(struct record_stat* rst)
+{
+  struct stat st;
+
+  if (rst->journal_fp) {
+    if (stat(rst->journal_fn, &st) == 0 &&
+	st.st_dev == rst->journal_dev && st.st_ino == rst->journal_ino) {
+      return rst->journal_fp;
+    }
+    close_journal(rst);
+  }
+  rst->journal_fp = fopen(rst->journal_fn, "a");
+  if (!rst->journal_fp) {
+    return NULL;
+  }
+  rst->journal_buf = malloc(JOURNAL_BUF_SIZE);
+  if (rst->journal_buf) {
+    setvbuf(rst->journal_fp, rst->journal_buf, _IOFBF, JOURNAL_BUF_SIZE);
+  }
+  if (fstat(fileno(rst->journal_fp), &st) == 0) {
+    rst->journal_dev = st.st_dev;
+    rst->journal_ino = st.st_ino;
+  }
+  return rst->journal_fp;
+}
+
+/* 書き出し待ちの行を全て差分ファイルに書き出す */
+static void
+write_pending(struct record_stat* rst)
+{
+  FILE *fp;
+  int i;
+
+  if (!rst->nr_pending) {
+    return ;
+  }
+  fp = open_journal(rst);
+  if (!fp) {
+    return ;
+  }
+  for (i = 0; i < rst->nr_pending; i++) {
+    struct pending_row *pr = &rst->pending[i];
+    if (pr->op == PENDING_DEL) {
+      write_del_row(fp, pr->rsc->name, pr->key);
+    } else {
+      struct trie_node *node = trie_find(&pr->rsc->cols, pr->key);
+      /* 削除されていたら書かない */
+      if (node) {
+	write_add_row(fp, pr->rsc->name, node);
+      }
+    }
+  }
+  fflush(fp);
+}
+
+/*
+ * 差分ファイルの読み込みで復活した行を消し直す
+ * 後ろから見ていき、削除の後で追加された行にはREADDEDを付けて残す
+ */
+static void
+remove_deleted_rows(struct record_stat* rst)
+{
+  int i;
+  for (i = rst->nr_pending - 1; i >= 0; i--) {
+    struct pending_row *pr = &rst->pending[i];
+    struct trie_node *node = trie_find(&pr->rsc->cols, pr->key);
+    if (!node) {
+      continue;
+    }
+    if (pr->op != PENDING_DEL) {
+      node->dirty |= READDED;
+    } else if (!(node->dirty & READDED)) {
+      do_remove_row(pr->rsc, node);
+    }
+  }
+  for (i = 0; i < rst->nr_pending; i++) {
+    struct pending_row *pr = &rst->pending[i];
+    struct trie_node *node;
+    if (pr->op != PENDING_DEL &&
+	(node = trie_find(&pr->rsc->cols, pr->key))) {
+      node->dirty &= ~READDED;
+    }
+  }
+}
+
+/* 内容を更新した行が journal の読み込みで上書きされないようにする */
+static void
+protect_pending(struct record_stat* rst, int on)
+{
+  int i;
+  for (i = 0; i < rst->nr_pending; i++) {
+    struct pending_row *pr = &rst->pending[i];
+    struct trie_node *node;
+    if (pr->op != PENDING_ADD) {
+      continue;
+    }
+    node = trie_find(&pr->rsc->cols, pr->key);
+    if (!node) {
+      continue;
+    }
+    if (on) {
+      node->dirty |= PROTECT;
+    } else {
+      node->dirty &= ~PROTECT;
+    }
+  }
+}
+
+/* 全ての row を解放する */
 static void
 clear_record(struct record_stat* rst)
 {
@@ -1276,7 +1501,7 @@ clear_record(struct record_stat* rst)
   rst->cur_row = NULL;
 }
 
-/* ܥեɤ */
+/* 基本ファイルを読む */
 static void
 read_session(struct record_stat *rst)
 {
@@ -1290,22 +1515,22 @@ read_session(struct record_stat *rst)
     struct trie_node* node;
 
     if (!strcmp(tokens[0], "---") && nr > 1) {
-      /* ڤ */
+      /* セクションの切れ目 */
       in_section = 1;
       rst->cur_section = do_select_section(rst, tokens[1], 1);
       goto end;
     }
     if (!in_section || nr < 2) {
-      /* 󤬻ϤޤäƤʤ or ԤԴ */
+      /* セクションが始まってない or 行が不完全 */
       goto end;
     }
-    /* ƬLRUΥޡɤ */
+    /* 行頭のLRUのマークを読む */
     if (tokens[0][0] == '-') {
       dirty = 0;
     } else if (tokens[0][0] == '+') {
       dirty = LRU_SUSED;
     }
-    /* index */
+    /* 次にindex */
     xs = anthy_cstr_to_xstr(&tokens[0][1], ANTHY_UTF8_ENCODING);
     node = do_select_row(rst->cur_section, xs, 1, dirty);
     anthy_free_xstr(xs);
@@ -1335,7 +1560,7 @@ read_session(struct record_stat *rst)
   }
 }
 
-/* ޤΥǡ١˥ե뤫ɤ߹ */
+/* いまのデータベースを解放した後にファイルから読み込む */
 static void
 read_base_record(struct record_stat *rst)
 {
@@ -1355,6 +1580,7 @@ read_base_record(struct record_stat *rst)
   anthy_close_file();
   if (stat(rst->base_fn, &st) == 0) {
     rst->base_timestamp = st.st_mtime;
+    rst->base_ino = st.st_ino;
   }
   rst->last_update = 0;
 }
@@ -1372,8 +1598,21 @@ open_tmp_in_recorddir(void)
   return fopen(pn, "w");
 }
 
+static void
+remove_tmp_in_recorddir(void)
+{
+  char *pn;
+  const char *hd;
+  const char *sid;
+  sid = anthy_conf_get_str("SESSION-ID");
+  hd = anthy_conf_get_str("HOME");
+  pn = alloca(strlen(hd)+strlen(sid) + 10);
+  sprintf(pn, "%s/.anthy/%s", hd, sid);
+  unlink(pn);
+}
+
 /*
- * ե뤫baseեrename 
+ * 一時ファイルからbaseファイルへrenameする 
  */
 static void
 update_file(const char *fn)
@@ -1391,21 +1630,21 @@ update_file(const char *fn)
   }
 }
 
-/* ¸ */
+/* カラムを保存する */
 static void
 save_a_row(FILE *fp, struct record_row *c,
 	   int dirty)
 {
   int i;
   char *buf = alloca(c->key.len * 6 + 2);
-  /* LRUΥޡ */
+  /* LRUのマークを出力 */
   if (dirty == 0) {
     fputc('-', fp);
   } else {
     fputc('+', fp);
   }
   anthy_sputxstr(buf, &c->key, ANTHY_UTF8_ENCODING);
-  /* index  */
+  /* index を出力 */
   fprintf(fp, "%s ", buf);
   /**/
   for (i = 0; i < c->nr_vals; i++) {
@@ -1437,119 +1676,364 @@ save_a_row(FILE *fp, struct record_row *c,
   fprintf(fp, "\n");
 }
 
+/* 全てのセクションを基本ファイルの形式で書き出す */
 static void
-update_base_record(struct record_stat* rst)
+write_base_sections(struct record_stat* rst, FILE *fp)
 {
   struct record_section *sec;
   struct trie_node *col;
-  FILE *fp;
-  struct stat st;
 
-  /* եärecord񤭽Ф */
-  anthy_check_user_dir();
-  fp = open_tmp_in_recorddir();
-  if (!fp) {
-    anthy_log(0, "Failed to open temporaly session file.\n");
-    return ;
-  }
-  /* ƥФ */
+  /* 各セクションに対して */
   for (sec = rst->section_list.next;
        sec; sec = sec->next) {
     if (!trie_first(&sec->cols)) {
-      /*Υ϶*/
+      /*このセクションは空*/
       continue;
     }
-    /* 󶭳ʸ */
+    /* セクション境界の文字列 */
     fprintf(fp, "--- %s\n", sec->name);
-    /* ƥ¸ */
+    /* 各カラムを保存する */
     for (col = trie_first(&sec->cols); col; 
 	 col = trie_next(&sec->cols, col)) {
       save_a_row(fp, &col->row, col->dirty);
     }
   }
+}
+
+static void
+update_base_record(struct record_stat* rst)
+{
+  FILE *fp;
+  struct stat st;
+
+  /* 一時ファイルを作ってrecordを書き出す */
+  anthy_check_user_dir();
+  fp = open_tmp_in_recorddir();
+  if (!fp) {
+    anthy_log(0, "Failed to open temporaly session file.\n");
+    return ;
+  }
+  write_base_sections(rst, fp);
   fclose(fp);
 
-  /* ̾rename */
+  /* 本来の名前にrenameする */
   update_file(rst->base_fn);
 
   if (stat(rst->base_fn, &st) == 0) {
     rst->base_timestamp = st.st_mtime;
+    rst->base_ino = st.st_ino;
   }
-  /* journalեä */
+  /* journalファイルを消す */
+  close_journal(rst);
   unlink(rst->journal_fn);
   rst->last_update = 0;
 }
 
+/* 経過時間をマイクロ秒で返す */
+static long
+elapsed_usec(struct timeval *from)
+{
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (now.tv_sec - from->tv_sec) * 1000000L +
+    (now.tv_usec - from->tv_usec);
+}
+
+/* 基本ファイルを更新した回数と時間を数えて記録する */
 static void
-commit_del_row(struct record_stat* rst,
-	       const char* sname, struct trie_node* node)
+count_compaction(struct record_stat* rst, int is_idle, int len,
+		 struct timeval *start)
 {
-  FILE* fp;
+  long usec = elapsed_usec(start);
 
-  fp = fopen(rst->journal_fn, "a");
-  if (fp == NULL) {
-    return;
+  if (is_idle) {
+    rst->nr_idle_compactions ++;
+  } else {
+    rst->nr_sync_compactions ++;
   }
-  write_string(fp, "DEL \"");
-  write_quote_string(fp, sname);
-  write_string(fp, "\" S\"");
-  write_quote_xstr(fp, &node->row.key);
-  write_string(fp, "\"");
-  write_string(fp, "\n");
-  fclose(fp);
+  rst->compaction_usec += usec;
+  if (usec > rst->max_compaction_usec) {
+    rst->max_compaction_usec = usec;
+  }
+  anthy_log(2, "compacted %s (%d bytes of journal%s) in %ld usec.\n",
+	    rst->base_fn, len, is_idle ? ", idle" : "", usec);
+  anthy_log(2, "compactions: %d in sync, %d idle, "
+	    "%ld usec in total, %ld usec at most.\n",
+	    rst->nr_sync_compactions, rst->nr_idle_compactions,
+	    rst->compaction_usec, rst->max_compaction_usec);
 }
 
 /*
- * sync_add: ADD ν񤭹
- * sync_del_and_del: DEL ν񤭹ߤȺ
- *   ɤ񤭹ߤˡ¾Υץˤäƥǥ¸줿
- *   ɤ߹ࡣ
- *   ΤȤǡ١եå夹ǽ⤢롣ǡ١
- *   եå夬ȡ cur_row Ƥ xstr ̵ˤʤ롣
- *    cur_section ͭ¸롣
+ * 差分ファイルを基本ファイルにまとめる
+ * ロックを取って、メモリ上のデータベースを最新にした状態で呼ぶ
  */
 static void
-sync_add(struct record_stat* rst, struct record_section* rsc, 
-	 struct trie_node* node)
+compact_record(struct record_stat* rst)
+{
+  struct timeval start;
+  int len = rst->last_update;
+
+  gettimeofday(&start, NULL);
+  update_base_record(rst);
+  count_compaction(rst, 0, len, &start);
+}
+
+/*
+ * 差分ファイルのoffset以降を新しい差分ファイルとする
+ * 残りが無ければ差分ファイルを消す、ロックを取った状態で呼ぶ
+ */
+static int
+cut_journal(struct record_stat* rst, int offset)
+{
+  char buf[4096];
+  char *tmp_fn;
+  int in, out, n;
+  struct stat st;
+
+  in = open(rst->journal_fn, O_RDONLY);
+  if (in == -1) {
+    return offset == 0 ? 0 : -1;
+  }
+  if (fstat(in, &st) == -1 || st.st_size < offset) {
+    /* 他のプロセスが差分ファイルを消した */
+    close(in);
+    return -1;
+  }
+  if (st.st_size == offset) {
+    close(in);
+    unlink(rst->journal_fn);
+    return 0;
+  }
+  tmp_fn = alloca(strlen(rst->journal_fn) + 10);
+  sprintf(tmp_fn, "%s.tmp", rst->journal_fn);
+  out = open(tmp_fn, O_WRONLY|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR);
+  if (out == -1) {
+    close(in);
+    return -1;
+  }
+  lseek(in, offset, SEEK_SET);
+  while ((n = read(in, buf, sizeof(buf))) > 0) {
+    if (write(out, buf, n) != n) {
+      n = -1;
+      break;
+    }
+  }
+  close(in);
+  close(out);
+  if (n < 0 || rename(tmp_fn, rst->journal_fn)) {
+    unlink(tmp_fn);
+    return -1;
+  }
+  return 0;
+}
+
+/* 基本ファイルがbase_timestampとbase_inoの時から変わっていないか */
+static int
+base_record_unchanged(struct record_stat* rst)
+{
+  struct stat st;
+  if (stat(rst->base_fn, &st) < 0) {
+    return rst->base_ino == 0;
+  }
+  return st.st_mtime == rst->base_timestamp && st.st_ino == rst->base_ino;
+}
+
+/* ロックを取った状態で、メモリ上のデータベースとファイルを同期する */
+static void
+sync_record_locked(struct record_stat* rst)
 {
-  lock_record(rst);
   if (check_base_record_uptodate(rst)) {
-    node->dirty |= PROTECT;
-    /* ʬեɤ */
+    /* 差分ファイルだけ読む */
+    protect_pending(rst, 1);
     read_journal_record(rst);
-    node->dirty &= ~PROTECT;
-    commit_add_row(rst, rsc->name, node);
+    protect_pending(rst, 0);
+    write_pending(rst);
+    if (rst->journal_fp) {
+      rst->last_update = ftell(rst->journal_fp);
+    }
+    /* 読み込んだ更新で復活した行を消し直す */
+    remove_deleted_rows(rst);
   } else {
-    /* ɤ߹ */
-    commit_add_row(rst, rsc->name, node);
+    /* 再読み込み */
+    write_pending(rst);
     read_base_record(rst);
     read_journal_record(rst);
   }
-  if (rst->last_update > FILE2_LIMIT) {
-    update_base_record(rst);
+  rst->nr_pending = 0;
+}
+
+/*
+ * sync_record: 書き出し待ちの行をまとめて書き出す
+ *   差分ファイルがlimitを越えたら基本ファイルにまとめる。
+ *   書き込みの前に、他のプロセスによってディスク上に保存された
+ *   更新をメモリ上に読み込む。
+ *   このとき、データベースをフラッシュする可能性もある。データベースの
+ *   フラッシュがあると、 cur_row と全ての xstr は無効になる。
+ *   ただし、 cur_section の有効性は保存される。
+ *   全ての行は一回のロックの間に、一回の write で書き出される。
+ */
+static void
+sync_record(struct record_stat* rst, int limit)
+{
+  if (lock_record(rst)) {
+    /* 書き出し待ちの行は次の同期まで残しておく */
+    return ;
+  }
+  sync_record_locked(rst);
+  if (rst->last_update > limit) {
+    compact_record(rst);
   }
   unlock_record(rst);
 }
 
+/*
+ * 入力待ちの間に差分ファイルを基本ファイルにまとめる
+ * 最新にしたメモリ上のデータベースをスナップショットとしてロックの外で
+ * 書き出すので、その間も他のプロセスは差分ファイルに追記できる。
+ * 追記された分は新しい差分ファイルに残す
+ */
 static void
-sync_del_and_del(struct record_stat* rst, struct record_section* rsc, 
-		 struct trie_node* node)
+compact_record_in_idle(struct record_stat* rst)
 {
-  lock_record(rst);
-  commit_del_row(rst, rsc->name, node);
-  if (!check_base_record_uptodate(rst)) {
-    read_base_record(rst);
+  struct timeval start;
+  FILE *fp;
+  int offset, ok;
+
+  /* 入力待ちのたびに呼ばれるので、まず読んだ所までの長さで判断する */
+  if (rst->is_anon || rst->last_update <= FILE2_LIMIT ||
+      lock_record(rst)) {
+    return ;
   }
-  read_journal_record(rst);
-  if (rst->last_update > FILE2_LIMIT) {
-    update_base_record(rst);
+  sync_record_locked(rst);
+  offset = rst->last_update;
+  unlock_record(rst);
+  if (offset <= FILE2_LIMIT) {
+    return ;
+  }
+
+  gettimeofday(&start, NULL);
+  anthy_check_user_dir();
+  fp = open_tmp_in_recorddir();
+  if (!fp) {
+    anthy_log(0, "Failed to open temporaly session file.\n");
+    return ;
+  }
+  write_base_sections(rst, fp);
+  ok = !fflush(fp) && !ferror(fp);
+  fclose(fp);
+
+  if (lock_record(rst)) {
+    remove_tmp_in_recorddir();
+    return ;
+  }
+  /* 書き出している間に他のプロセスが基本ファイルを更新していたら諦める */
+  if (ok && base_record_unchanged(rst)) {
+    struct stat st;
+    update_file(rst->base_fn);
+    if (stat(rst->base_fn, &st) == 0) {
+      rst->base_timestamp = st.st_mtime;
+      rst->base_ino = st.st_ino;
+    }
+    if (cut_journal(rst, offset)) {
+      anthy_log(0, "Failed to cut journal file %s.\n", rst->journal_fn);
+    }
+    /* スナップショットの後に追記された分は次の同期で読む */
+    close_journal(rst);
+    rst->last_update = 0;
+    count_compaction(rst, 1, offset, &start);
+  } else {
+    remove_tmp_in_recorddir();
   }
   unlock_record(rst);
 }
 
+static void
+sync_pending(struct record_stat* rst)
+{
+  if (!rst->nr_pending) {
+    return ;
+  }
+  /* anthy_idleが呼ばれるなら、基本ファイルの更新はコミットを
+   * 待たせないように普段はanthy_compact_recordに任せる */
+  sync_record(rst, idle_compaction ? FILE2_HARD_LIMIT : FILE2_LIMIT);
+}
+
+/*
+ * 行の操作を書き出し待ちに加える
+ * 削除した行のノードは消えるので、ノードに覚えた番号の操作は
+ * 最後の削除より後の追加になっている
+ */
+static void
+add_pending(struct record_stat* rst, struct record_section* rsc,
+	    struct trie_node *node, enum pending_op op)
+{
+  xstr *key = intern_xstr(&rst->xstrs, &node->row.key);
+  int i = node->pending - 1;
+
+  if (op != PENDING_DEL && i >= 0 && i < rst->nr_pending &&
+      rst->pending[i].rsc == rsc && rst->pending[i].key == key &&
+      rst->pending[i].op != PENDING_DEL) {
+    /* 同じ行への追加にまとめる */
+    if (op == PENDING_ADD) {
+      rst->pending[i].op = PENDING_ADD;
+    }
+    return ;
+  }
+  if (rst->nr_pending == rst->pending_size) {
+    rst->pending_size = rst->pending_size ? rst->pending_size * 2 : 16;
+    rst->pending = realloc(rst->pending,
+			   sizeof(struct pending_row) * rst->pending_size);
+  }
+  rst->pending[rst->nr_pending].op = op;
+  rst->pending[rst->nr_pending].rsc = rsc;
+  rst->pending[rst->nr_pending].key = key;
+  rst->nr_pending++;
+  node->pending = rst->nr_pending;
+}
+
+/* セクションを解放する前に、そのセクションへの操作を捨てる */
+static void
+drop_pending(struct record_stat* rst, struct record_section* rsc)
+{
+  int i, j;
+  for (i = 0, j = 0; i < rst->nr_pending; i++) {
+    if (rst->pending[i].rsc != rsc) {
+      rst->pending[j++] = rst->pending[i];
+    }
+  }
+  rst->nr_pending = j;
+}
+
+/*
+ * sync_add: ADD の書き込み
+ * sync_del_and_del: DEL の書き込みと削除
+ *   anthy_begin_record_batch の後では書き出し待ちに加えるだけで、
+ *   anthy_sync_record でまとめて書き出す
+ */
+static void
+sync_add(struct record_stat* rst, struct record_section* rsc, 
+	 struct trie_node* node)
+{
+  add_pending(rst, rsc, node, PENDING_ADD);
+  if (!rst->in_batch) {
+    sync_pending(rst);
+  }
+}
+
+static void
+sync_del_and_del(struct record_stat* rst, struct record_section* rsc, 
+		 struct trie_node* node)
+{
+  add_pending(rst, rsc, node, PENDING_DEL);
+  do_remove_row(rsc, node);
+  if (!rst->in_batch) {
+    sync_pending(rst);
+  }
+}
+
 
 /*
- * predictionط
+ * prediction関係
  */
 
 static int
@@ -1576,58 +2060,34 @@ read_prediction_node(struct trie_node *n,
 
 
 /*
- * trie򤿤ɤꡢprefixޥåread_prediction_node
- * Ƥpredictions˷̤ɲä롣
+ * 索引の中で key をprefixに持つ行を探し、read_prediction_nodeを
+ * 呼んでpredictionsの配列に結果を追加する。
+ * 整列済みの部分ではそのような行は連続して並んでいる
  */
 static int
-traverse_record_for_prediction(xstr* key, struct trie_node *n,
-			       struct prediction_t* predictions, int index)
+traverse_record_for_prediction(xstr* key, struct trie_root *root,
+			       struct prediction_t* predictions)
 {
-  if (n->l->bit > n->bit) {
-    index = traverse_record_for_prediction(key, n->l, predictions, index);
-  } else {
-    if (n->l->row.key.len != -1) {
-      if (anthy_xstrncmp(&n->l->row.key, key, key->len) == 0) {
-	index = read_prediction_node(n->l, predictions, index);
-      }
+  int index = 0;
+  int i;
+
+  for (i = trie_lower_bound(root, key); i < root->nr_sorted; i++) {
+    struct trie_node *n = root->ents[i];
+    if (anthy_xstrncmp(&n->row.key, key, key->len) != 0) {
+      break;
     }
-  }
-  if (n->r->bit > n->bit) {
-    index = traverse_record_for_prediction(key, n->r, predictions, index);
-  } else {
-    if (n->r->row.key.len != -1) {
-      if (anthy_xstrncmp(&n->r->row.key, key, key->len) == 0) {
-	index = read_prediction_node(n->r, predictions, index);
-      }
+    if (!(n->dirty & REMOVED)) {
+      index = read_prediction_node(n, predictions, index);
     }
   }
-  return index;
-}
-
-/*
- * key õ
- * key ʸĹۤ뤫Ρɤ̵ʤäõǤڤ
- * triekeyǼƤȤǤʤʤդ֤
- */
-static struct trie_node *
-trie_find_for_prediction (struct trie_root* root, xstr *key)
-{
-  struct trie_node *p;
-  struct trie_node *q;
-
-  p = &root->root;
-  q = p->l;
-
-  while (p->bit < q->bit) {
-    if (q->bit >= 2) {
-      if ((q->bit - 2) / (int)(sizeof(xchar) << 3) >= key->len) {
-	break;
-      }
+  for (i = root->nr_sorted; i < root->nr_ents; i++) {
+    struct trie_node *n = root->ents[i];
+    if (!(n->dirty & REMOVED) &&
+	anthy_xstrncmp(&n->row.key, key, key->len) == 0) {
+      index = read_prediction_node(n, predictions, index);
     }
-    p = q;
-    q = trie_key_nth_bit(key, p->bit) ? p->r : p->l;
   }
-  return p;
+  return index;
 }
 
 static int
@@ -1641,20 +2101,17 @@ prediction_cmp(const void* lhs, const void* rhs)
 int
 anthy_traverse_record_for_prediction(xstr* key, struct prediction_t* predictions)
 {
-  struct trie_node* mark;
   int nr_predictions;
   if (anthy_select_section("PREDICTION", 0)) {
     return 0;
   }
 
-  /* ꤵ줿ʸprefix˻nodeõ */
-  mark = trie_find_for_prediction(&anthy_current_record->cur_section->cols, key);
-  if (!mark) {
-    return 0;
-  }
-  nr_predictions = traverse_record_for_prediction(key, mark, predictions, 0);
+  /* 指定された文字列をprefixに持つ行を探す */
+  nr_predictions =
+    traverse_record_for_prediction(key, &anthy_current_record->cur_section->cols,
+				   predictions);
   if (predictions) {
-    /* ॹפͽ¬򥽡Ȥ */
+    /* タイムスタンプで予測候補をソートする */
     qsort(predictions, nr_predictions, sizeof(struct prediction_t), prediction_cmp);
   }
   return nr_predictions;
@@ -1754,11 +2211,35 @@ anthy_mark_row_used(void)
   }
 
   do_mark_row_used(rst->cur_section, rst->cur_row);
-  sync_add(rst, rst->cur_section, rst->cur_row);
+  if (rst->row_dirty) {
+    sync_add(rst, rst->cur_section, rst->cur_row);
+  } else {
+    /* 変換中の参照による更新はコミット時などにまとめて書き出す */
+    add_pending(rst, rst->cur_section, rst->cur_row, PENDING_TOUCH);
+    rst->row_dirty = 0;
+    if (rst->nr_pending >= MAX_PENDING_ROWS && !rst->in_batch) {
+      /* コミットせずに変換を続けてもたまり続けないようにする */
+      sync_pending(rst);
+    }
+    return 0;
+  }
   rst->row_dirty = 0;
   return 0;
 }
 
+void
+anthy_begin_record_batch(void)
+{
+  anthy_current_record->in_batch = 1;
+}
+
+void
+anthy_sync_record(void)
+{
+  anthy_current_record->in_batch = 0;
+  sync_pending(anthy_current_record);
+}
+
 void
 anthy_set_nth_value(int nth, int val)
 {
@@ -1834,8 +2315,8 @@ anthy_select_next_row(void)
   if (!rst->cur_section || !rst->cur_row)
     return -1;
   
-  /* sync_add()  cur_row ̵ˤʤ뤳ȤΤǡ
-   * Ȥ row_dirty Ǥ sync_add() ʤ
+  /* sync_add() で cur_row が無効になることがあるので、
+   * たとえ row_dirty でも sync_add() しない
    */
   rst->row_dirty = 0;
   node = do_select_next_row(rst->cur_section, rst->cur_row);
@@ -1854,7 +2335,7 @@ anthy_get_index_xstr(void)
 /*..Wrappers end*/
 
 /*
- * trie_row_init ϲǤ⤤
+ * trie_row_init は何回よんでもいい
  */
 static void
 trie_row_init(struct record_row* rc)
@@ -1873,11 +2354,12 @@ trie_row_free(struct record_row *rc)
   free(rc->key.str);
 }  
 
-/* 륻ΥǡƲ */
+/* あるセクションのデータを全て解放する */
 static void
 free_section(struct record_stat *r, struct record_section *rs)
 {
   struct record_section *s;
+  drop_pending(r, rs);
   trie_remove_all(&rs->cols, &rs->lru_nr_used, &rs->lru_nr_sused);
   if (r->cur_section == rs) {
     r->cur_row = 0;
@@ -1894,7 +2376,7 @@ free_section(struct record_stat *r, struct record_section *rs)
   free(rs);
 }
 
-/* ٤ƤΥǡ */
+/* すべてのデータを解放する */
 static void
 free_record(struct record_stat *rst)
 {
@@ -1932,7 +2414,7 @@ anthy_release_row(void)
   }
 
   rst->row_dirty = 0;
-  /* sync_del_and_del Ǻ⤹ */
+  /* sync_del_and_del で削除もする */
   sync_del_and_del(rst, rst->cur_section, rst->cur_row);
   rst->cur_row = NULL;
 }
@@ -1942,6 +2424,12 @@ record_dtor(void *p)
 {
   int dummy;
   struct record_stat *rst = (struct record_stat*) p;
+  if (rst->nr_pending || rst->last_update > FILE2_LIMIT) {
+    /* 終了時には基本ファイルにもまとめておく */
+    sync_record(rst, FILE2_LIMIT);
+  }
+  free(rst->pending);
+  close_journal(rst);
   free_record(rst);
   if (rst->id) {
     free(rst->base_fn);
@@ -1961,12 +2449,40 @@ anthy_reload_record(void)
     return ;
   }
 
-  lock_record(rst);
-  read_base_record(rst);
-  read_journal_record(rst);
+  if (rst->nr_pending) {
+    /* 書き出し待ちの行があれば、書き出しと一緒に読み直す */
+    sync_pending(rst);
+    return ;
+  }
+  /* 読むだけなので他のプロセスと同時に読める */
+  lock_record_shared(rst);
+  if (check_base_record_uptodate(rst)) {
+    /* 差分ファイルだけ読む */
+    read_journal_record(rst);
+  } else {
+    read_base_record(rst);
+    read_journal_record(rst);
+  }
   unlock_record(rst);
 }
 
+/*
+ * 差分ファイルが大きくなっていたら基本ファイルにまとめる
+ * 変換やコミットを待たせないように入力待ちの間に呼ぶ
+ */
+void
+anthy_compact_record(void)
+{
+  struct record_stat *rst = anthy_current_record;
+
+  /* 以後は同期の時にはなるべくまとめない */
+  idle_compaction = 1;
+  if (!rst) {
+    return ;
+  }
+  compact_record_in_idle(rst);
+}
+
 void
 anthy_init_record(void)
 {
@@ -1980,12 +2496,12 @@ setup_filenames(const char *id, struct record_stat *rst)
   const char *home = anthy_conf_get_str("HOME");
   int base_len = strlen(home) + strlen(id) + 10;
 
-  /* ܥե */
+  /* 基本ファイル */
   rst->base_fn = (char*) malloc(base_len +
 				strlen("/.anthy/last-record1_"));
   sprintf(rst->base_fn, "%s/.anthy/last-record1_%s.utf8",
 	  home, id);
-  /* ʬե */
+  /* 差分ファイル */
   rst->journal_fn = (char*) malloc(base_len +
 				   strlen("/.anthy/last-record2_"));
   sprintf(rst->journal_fn, "%s/.anthy/last-record2_%s.utf8",
@@ -2008,8 +2524,20 @@ anthy_create_record(const char *id)
   rst->cur_section = 0;
   rst->cur_row = 0;
   rst->row_dirty = 0;
-
-  /* ե̾ʸ */
+  rst->pending = NULL;
+  rst->nr_pending = 0;
+  rst->pending_size = 0;
+  rst->in_batch = 0;
+  rst->journal_fp = NULL;
+  rst->journal_buf = NULL;
+  rst->base_timestamp = 0;
+  rst->base_ino = 0;
+  rst->nr_sync_compactions = 0;
+  rst->nr_idle_compactions = 0;
+  rst->compaction_usec = 0;
+  rst->max_compaction_usec = 0;
+
+  /* ファイル名の文字列を作る */
   setup_filenames(id, rst);
 
   rst->last_update = 0;
@@ -2021,8 +2549,8 @@ anthy_create_record(const char *id)
     anthy_check_user_dir();
   }
 
-  /* ե뤫ɤ߹ */
-  lock_record(rst);
+  /* ファイルから読み込む */
+  lock_record_shared(rst);
 
   read_base_record(rst);
   read_journal_record(rst);
@@ -1,5 +1,5 @@
 /*
- * Ȥ줿ƥȤ鸡Ԥ
+ * ソートされたテキストから検索を行う
  */
 /*
   This library is free software; you can redistribute it and/or
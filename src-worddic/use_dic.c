@@ -1,5 +1,5 @@
 /*
- * 㼭򰷤 
+ * 用例辞書を扱う 
  * Copyright (C) 2003 TABATA Yusuke
  */
 #include <string.h>
@@ -16,6 +16,6 @@
 int anthy_word_dic_check_word_relation(struct word_dic *wdic,
 				       int from, int to)
 {
-  /* ͭ */
+  /* 共有辞書 */
   return anthy_matrix_image_peek((int *)wdic->uc_section, from, to);
 }
@@ -1,7 +1,7 @@
 /*
- * Anthyμ饤֥濴
+ * Anthyの辞書ライブラリの中心
  *
- * anthy_get_seq_ent_from_xstr()ǼҤ
+ * anthy_get_seq_ent_from_xstr()で辞書をひく
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  * Copyright (C) 2005-2006 YOSHIDA Yuichi
@@ -36,20 +36,28 @@
 #include <anthy/textdict.h>
 
 #include <anthy/diclib.h>
+#include <anthy/word_dic.h>
 
 #include "dic_ent.h"
 #include "dic_personality.h"
 #include "dic_main.h"
+#include "mem_dic.h"
 
 /**/
 static int dic_init_count;
 
-/*  */
-/* personalityǶͭե뼭 */
+/* 辞書 */
+/* 全personalityで共有されるファイル辞書 */
 static struct word_dic *master_dic_file;
-
-/* ƥѡʥƥȤμ */
-struct mem_dic *anthy_current_personal_dic_cache;/* å */
+/* 設定で追加された辞書、優先度の高い順 */
+#define MAX_DIC_LAYERS 16
+static struct word_dic *dic_layers[MAX_DIC_LAYERS];
+static int nr_dic_layers;
+/* gang lookupの作業用、ページを使い回すために変換をまたいで残す */
+static allocator gang_elm_ator;
+
+/* 各パーソナリティごとの辞書 */
+struct mem_dic *anthy_current_personal_dic_cache;/* キャッシュ */
 /**/
 struct record_stat *anthy_current_record;
 
@@ -60,7 +68,7 @@ anthy_validate_seq_ent(struct seq_ent *seq, xstr *xs, int is_reverse)
     return NULL;
   }
   if (seq->nr_dic_ents == 0 && seq->nr_compound_ents == 0) {
-    /* ̵ʥȥΤcache */
+    /* 無効なエントリを作成したのでcacheから削除 */
     anthy_mem_dic_release_seq_ent(anthy_current_personal_dic_cache,
 				  xs, is_reverse);
     return NULL;
@@ -74,33 +82,46 @@ anthy_cache_get_seq_ent(xstr *xs, int is_reverse)
 {
   struct seq_ent *seq;
 
-  /* å˴ˤФ֤ */
+  /* キャッシュ中に既にあればそれを返す */
   seq = anthy_mem_dic_find_seq_ent_by_xstr(anthy_current_personal_dic_cache,
 					   xs, is_reverse);
   if (seq) {
     return seq;
   }
 
-  /* å̵Τǳ */
+  /* キャッシュ中に無いので確保 */
   return anthy_mem_dic_alloc_seq_ent_by_xstr(anthy_current_personal_dic_cache,
 					     xs, is_reverse);
 }
 
+/* 現在のセッションが使う単語辞書
+ * 辞書が再読み込みされても、セッションは開始時の辞書を使い続ける */
+static struct word_dic *
+get_session_word_dic(void)
+{
+  if (anthy_current_personal_dic_cache &&
+      anthy_current_personal_dic_cache->word_dic) {
+    return anthy_current_personal_dic_cache->word_dic;
+  }
+  return master_dic_file;
+}
+
 int
 anthy_dic_check_word_relation(int from, int to)
 {
-  return anthy_word_dic_check_word_relation(master_dic_file, from, to);
+  return anthy_word_dic_check_word_relation(get_session_word_dic(),
+					    from, to);
 }
 
 static seq_ent_t
 do_get_seq_ent_from_xstr(xstr *xs, int is_reverse)
 {
   struct seq_ent *seq;
-  /* å夫Ф */
+  /* キャッシュから取り出す */
   seq = anthy_cache_get_seq_ent(xs, is_reverse);
   seq = anthy_validate_seq_ent(seq, xs, is_reverse);
   if (!seq) {
-    /* ʤɤμ̵ʸ򸡺 */
+    /* 数字などの辞書に無い文字列を検索する */
     return anthy_get_ext_seq_ent_from_xstr(xs, is_reverse);
   }
   return seq;
@@ -112,7 +133,7 @@ convert_vu(xstr *xs)
   int i, v = 0;
   int j;
 
-    /* ֥פνи */
+    /* 「ヴ」の出現を数える */
   for (i = 0; i < xs->len; i++) {
     if (xs->str[i] == KK_VU) {
       v++;
@@ -123,7 +144,7 @@ convert_vu(xstr *xs)
     nx->len = xs->len + v;
     nx->str = malloc(sizeof(xchar)*nx->len);
     j = 0;
-    /* ֥פ֤פѴĤĥԡ */
+    /* 「ヴ」を「う゛」に変換しつつコピーする */
     for (i = 0; i < xs->len; i++) {
       if (xs->str[i] == KK_VU) {
 	nx->str[j] = HK_U;
@@ -150,9 +171,9 @@ anthy_get_seq_ent_from_xstr(xstr *xs, int is_reverse)
   }
   if (!is_reverse) {
     xstr *nx = convert_vu(xs);
-    /* ֥פκäѴξ硢֤פľƸ
-     *   ̤Υ쥤䡼Ǥϥ桼Ϳʸ򤽤Τޤݻ뤳Ȥ
-     *   ԤΤǡѴϤǹԤʤ
+    /* 「ヴ」の混ざった順変換の場合、「う゛」に直して検索する
+     *   上位のレイヤーではユーザの与えた文字列をそのまま保持することが
+     *   期待されるので、変換はここで行なう。
      */
     if (nx) {
       se = do_get_seq_ent_from_xstr(nx, 0);
@@ -160,7 +181,7 @@ anthy_get_seq_ent_from_xstr(xstr *xs, int is_reverse)
       return se;
     }
   }
-  /* ֥פиʤ⤷ϵѴξ */
+  /* 「ヴ」が出現しない、もしくは逆変換の場合 */
   return do_get_seq_ent_from_xstr(xs, is_reverse);
 }
 
@@ -223,7 +244,7 @@ scan_misc_dic(struct gang_elm **array, int nr, int is_reverse)
     xstr *xs = &array[i]->xs;
     struct seq_ent *seq;
     seq = anthy_cache_get_seq_ent(xs, is_reverse);
-    /* Ŀͼ񤫤μ(̤θ켭) */
+    /* 個人辞書からの取得(未知語辞書) */
     if (seq) {
       anthy_copy_words_from_private_dic(seq, xs, is_reverse);
       anthy_validate_seq_ent(seq, xs, is_reverse);
@@ -308,14 +329,18 @@ request_scan(struct textdict *td, void *arg)
 static void
 do_gang_load_dic(xstr *sentence, int is_reverse)
 {
-  allocator ator = anthy_create_allocator(sizeof(struct gang_elm),
-					  gang_elm_dtor);
+  allocator ator;
   int from, len;
   xstr xs;
   int i, nr;
   struct gang_elm head;
   struct gang_elm **array, *cur;
   struct scan_arg sarg;
+  if (!gang_elm_ator) {
+    gang_elm_ator = anthy_create_allocator(sizeof(struct gang_elm),
+					   gang_elm_dtor);
+  }
+  ator = gang_elm_ator;
   head.tmp.next = NULL;
   nr = 0;
   for (from = 0; from < sentence->len ; from ++) {
@@ -332,17 +357,20 @@ do_gang_load_dic(xstr *sentence, int is_reverse)
     cur = cur->tmp.next;
   }
   qsort(array, nr, sizeof(struct gang_elm *), gang_elm_compare_func);
-  /**/
-  anthy_gang_fill_seq_ent(master_dic_file, array, nr, is_reverse);
+  /* 追加された辞書、anthy.dicの順に引いて同じseq_entに加える */
+  for (i = 0; i < nr_dic_layers; i++) {
+    anthy_gang_fill_seq_ent(dic_layers[i], array, nr, is_reverse);
+  }
+  anthy_gang_fill_seq_ent(get_session_word_dic(), array, nr, is_reverse);
   /**/
   scan_misc_dic(array, nr, is_reverse);
-  /* Ŀͼ񤫤ɤ */
+  /* 個人辞書から読む */
   sarg.nr = nr;
   sarg.array = array;
   anthy_ask_scan(request_scan, (void *)&sarg);
   /**/
   free(array);
-  anthy_free_allocator(ator);
+  anthy_reset_allocator(ator);
 }
 
 void
@@ -358,9 +386,9 @@ anthy_gang_load_dic(xstr *sentence, int is_reverse)
 }
 
 /*
- * seq_entμ
+ * seq_entの取得
  ************************
- * seq_entγƼμ
+ * seq_entの各種情報の取得
  */
 int
 anthy_get_nr_dic_ents(seq_ent_t se, xstr *xs)
@@ -486,7 +514,7 @@ anthy_get_seq_ent_ct(seq_ent_t se, int pos, int ct)
 }
 
 /*
- * wtʻñǺ٤ĤΤ֤
+ * wtの品詞を持つ単語の中で最大の頻度を持つものを返す
  */
 int
 anthy_get_seq_ent_wtype_freq(seq_ent_t seq, wtype_t wt)
@@ -502,7 +530,7 @@ anthy_get_seq_ent_wtype_freq(seq_ent_t seq, wtype_t wt)
   }
 
   f = 0;
-  /* ñ */
+  /* 単語 */
   for (i = 0; i < seq->nr_dic_ents; i++) {
     if (seq->dic_ents[i]->order == 0 &&
 	anthy_wtype_include(wt, seq->dic_ents[i]->type)) {
@@ -515,7 +543,7 @@ anthy_get_seq_ent_wtype_freq(seq_ent_t seq, wtype_t wt)
 }
 
 /*
- * wtʻʣǺ٤ĤΤ֤
+ * wtの品詞を持つ複合語の中で最大の頻度を持つものを返す
  */
 int
 anthy_get_seq_ent_wtype_compound_freq(seq_ent_t se, wtype_t wt)
@@ -568,7 +596,7 @@ anthy_has_compound_ents(seq_ent_t se)
   return se->nr_compound_ents;
 }
 
-/* compundǤʤäƤ뤫 */
+/* compundでない候補を持っているか */
 int
 anthy_has_non_compound_ents(seq_ent_t se)
 {
@@ -598,7 +626,7 @@ struct elm_compound {
   xstr str;
 };
 
-/* ǤбɤߤĹ֤ */
+/* 要素に対応する読みの長さを返す */
 static int
 get_element_len(xchar xc)
 {
@@ -617,7 +645,7 @@ get_nth_elm_compound(compound_ent_t ce, struct elm_compound *elm, int nth)
   int off = 0;
   int i, j;
   for (i = 0; i <= nth; i++) {
-    /* nthܤǤƬذư */
+    /* nth番目の要素の先頭へ移動する */
     while (!(ce->str.str[off] == '_' &&
 	     get_element_len(ce->str.str[off+1]) > 0)) {
       off ++;
@@ -625,7 +653,7 @@ get_nth_elm_compound(compound_ent_t ce, struct elm_compound *elm, int nth)
 	return NULL;
       }
     }
-    /* ¤Τؾ */
+    /* 構造体へ情報を取り込む */
     elm->len = get_element_len(ce->str.str[off+1]);
     elm->str.str = &ce->str.str[off+2];
     elm->str.len = ce->str.len - off - 2;
@@ -688,14 +716,21 @@ anthy_compound_get_freq(compound_ent_t ce)
   return ce->freq;
 }
 
-/* եȥɤƤФ */
+/* フロントエンドから呼ばれる */
 void
 anthy_lock_dic(void)
 {
   anthy_priv_dic_lock();
 }
 
-/* եȥɤƤФ */
+/* 辞書を引くだけのときに呼ばれる */
+void
+anthy_lock_dic_shared(void)
+{
+  anthy_priv_dic_lock_shared();
+}
+
+/* フロントエンドから呼ばれる */
 void
 anthy_unlock_dic(void)
 {
@@ -706,7 +741,11 @@ anthy_unlock_dic(void)
 dic_session_t
 anthy_dic_create_session(void)
 {
-  return anthy_create_mem_dic();
+  struct mem_dic *md = anthy_create_mem_dic();
+  /* セッションの間は今の単語辞書を使う */
+  md->word_dic = master_dic_file;
+  master_dic_file->nr_users ++;
+  return md;
 }
 
 void
@@ -718,7 +757,63 @@ anthy_dic_activate_session(dic_session_t d)
 void
 anthy_dic_release_session(dic_session_t d)
 {
+  struct word_dic *wdic = d->word_dic;
   anthy_release_mem_dic(d);
+  if (!wdic) {
+    return ;
+  }
+  wdic->nr_users --;
+  /* 入れ替えられた古い辞書を最後の利用者が解放する */
+  if (wdic->nr_users == 0 && wdic != master_dic_file) {
+    anthy_release_word_dic(wdic);
+  }
+}
+
+/** セッションのキャッシュを空にして、今の単語辞書のセッションとして使い回す
+ */
+void
+anthy_dic_reset_session(dic_session_t d)
+{
+  struct word_dic *wdic = d->word_dic;
+  anthy_reset_mem_dic(d);
+  if (wdic == master_dic_file) {
+    return ;
+  }
+  d->word_dic = master_dic_file;
+  master_dic_file->nr_users ++;
+  if (!wdic) {
+    return ;
+  }
+  wdic->nr_users --;
+  if (wdic->nr_users == 0) {
+    anthy_release_word_dic(wdic);
+  }
+}
+
+/** 単語辞書をfnの辞書ファイル(anthy.dicの形式)のものに入れ替える
+ * 以後に開始するセッションから新しい辞書を使う
+ */
+int
+anthy_dic_reload(const char *fn)
+{
+  struct word_dic *wdic, *old;
+  if (!fn) {
+    fn = anthy_conf_get_str("DIC_FILE");
+  }
+  if (!fn) {
+    return -1;
+  }
+  wdic = anthy_create_word_dic_from_dic_file(fn);
+  if (!wdic) {
+    anthy_log(0, "Failed to reload dictionary (%s).\n", fn);
+    return -1;
+  }
+  old = master_dic_file;
+  master_dic_file = wdic;
+  if (old->nr_users == 0) {
+    anthy_release_word_dic(old);
+  }
+  return 0;
 }
 
 void
@@ -730,7 +825,54 @@ anthy_dic_set_personality(const char *id)
 }
 
 
-/** 񥵥֥ƥ
+/** DIC_LAYERSに':'区切りで指定された辞書ファイルをmapする
+ */
+static void
+init_dic_layers(void)
+{
+  const char *val = anthy_conf_get_str("DIC_LAYERS");
+  char *buf, *fn, *next;
+  nr_dic_layers = 0;
+  if (!val || !val[0]) {
+    return ;
+  }
+  buf = strdup(val);
+  for (fn = buf; fn; fn = next) {
+    struct word_dic *wdic;
+    next = strchr(fn, ':');
+    if (next) {
+      *next = 0;
+      next ++;
+    }
+    if (!fn[0]) {
+      continue;
+    }
+    if (nr_dic_layers == MAX_DIC_LAYERS) {
+      anthy_log(0, "Too many dictionaries in DIC_LAYERS.\n");
+      break;
+    }
+    wdic = anthy_create_word_dic_from_file(fn);
+    if (!wdic) {
+      anthy_log(0, "Failed to load dictionary (%s).\n", fn);
+      continue;
+    }
+    dic_layers[nr_dic_layers] = wdic;
+    nr_dic_layers ++;
+  }
+  free(buf);
+}
+
+static void
+release_dic_layers(void)
+{
+  int i;
+  for (i = 0; i < nr_dic_layers; i++) {
+    anthy_release_word_dic(dic_layers[i]);
+  }
+  nr_dic_layers = 0;
+}
+
+/** 辞書サブシステムを初期化
  */
 int
 anthy_init_dic(void)
@@ -755,11 +897,12 @@ anthy_init_dic(void)
     anthy_log(0, "Failed to create file dic.\n");
     return -1;
   }
+  init_dic_layers();
   dic_init_count ++;
   return 0;
 }
 
-/** 񥵥֥ƥ򤹤٤Ʋ
+/** 辞書サブシステムをすべて解放
  */
 void
 anthy_quit_dic(void)
@@ -772,7 +915,14 @@ anthy_quit_dic(void)
     anthy_release_record(anthy_current_record);
   }
   anthy_release_private_dic();
+  release_dic_layers();
+  anthy_release_word_dic(master_dic_file);
+  master_dic_file = NULL;
   anthy_current_record = NULL;
+  if (gang_elm_ator) {
+    anthy_free_allocator(gang_elm_ator);
+    gang_elm_ator = NULL;
+  }
   anthy_quit_mem_dic();
   anthy_quit_diclib();
 }
@@ -1,15 +1,15 @@
 /*
  * Word Dictionary
- * եμΥ󥿡ե¸ߤǡ
- * å夵ΤǤǤ¸ߤʤñ
- * ®ˤɬפ롣
+ * ファイルの辞書のインターフェース、存在するデータは
+ * キャッシュされるのでここでは存在しない単語の
+ * サーチを高速にする必要がある。
  *
- * anthy_gang_fill_seq_ent()濴ȤʤؿǤ
- *  ꤷword_dicꤷʸ򥤥ǥåȤƤĥȥ
- *  ղäseq_entɲä
+ * anthy_gang_fill_seq_ent()が中心となる関数である
+ *  指定したword_dicから指定した文字列をインデックスとしてもつエントリに
+ *  語尾を付加してseq_entに追加する
  *
- * a)ηb)񥢥ι®c)եΥ󥳡ǥ
- *  ΥǰäƤΤǤʤʣƤޤ
+ * a)辞書の形式とb)辞書アクセスの高速化c)辞書ファイルのエンコーディング
+ *  このソース中で扱ってるのでかなり複雑化してます．
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  * Copyright (C) 2005-2006 YOSHIDA Yuichi
@@ -45,11 +45,14 @@
 #include <anthy/logger.h>
 #include <anthy/xstr.h>
 #include <anthy/diclib.h>
+#include <anthy/filemap.h>
 
 #include "dic_main.h"
 #include "dic_ent.h"
 
 #define NO_WORD -1
+/* 読みのfilterの統計を記録する間隔(検索した読みの数) */
+#define FILTER_STATS_INTERVAL 100000
 
 static allocator word_dic_ator;
 
@@ -60,7 +63,7 @@ struct lookup_context {
   int is_reverse;
 };
 
-/* 1Хܤ򸫤ơʸХȤ뤫֤ */
+/* 1バイト目を見て、文字が何バイトあるかを返す */
 static int
 mb_fragment_len(const char *str)
 {
@@ -96,7 +99,7 @@ is_printable(char *str)
   return 0;
 }
 
-/* Υ󥳡ǥ󥰤xchar */
+/* 辞書のエンコーディングからxcharを作る */
 static xchar
 form_mb_char(const char *str)
 {
@@ -115,9 +118,26 @@ hash(xstr *x)
 static int
 check_hash_ent(struct word_dic *wdic, xstr *xs)
 {
-  int val = hash(xs);
-  int idx = (val>>YOMI_HASH_ARRAY_SHIFT)&(YOMI_HASH_ARRAY_SIZE-1);
-  int bit = val & ((1<<YOMI_HASH_ARRAY_SHIFT)-1);
+  int val, idx, bit;
+  if (wdic->bloom_hashes > 0) {
+    /* Bloom filter */
+    unsigned int h2;
+    unsigned int h1 = anthy_xstr_hash_pair(xs, &h2);
+    const unsigned char *block;
+    int i;
+    idx = h1 & (wdic->bloom_blocks - 1);
+    block = &wdic->hash_ent[idx * (WORD_DIC_BLOOM_BLOCK_BITS / 8)];
+    for (i = 0; i < wdic->bloom_hashes; i++) {
+      int b = WORD_DIC_BLOOM_BIT(h2, i);
+      if (!(block[b >> 3] & (1 << (b & 7)))) {
+	return 0;
+      }
+    }
+    return 1;
+  }
+  val = hash(xs);
+  idx = (val>>YOMI_HASH_ARRAY_SHIFT)&(YOMI_HASH_ARRAY_SIZE-1);
+  bit = val & ((1<<YOMI_HASH_ARRAY_SHIFT)-1);
   return wdic->hash_ent[idx] & (1<<bit);
 }
 
@@ -129,19 +149,19 @@ wtype_str_len(const char *str)
   return i;
 }
 
-/* ι򥹥󤹤뤿ξݻ */
+/* 辞書の行中をスキャンするための状態保持 */
 struct wt_stat {
   wtype_t wt;
   const char *wt_name;
   int feature;
   int freq;
-  int order_bonus;/* νˤ٤Υܡʥ */
-  int offset;/* ʸΥեå */
+  int order_bonus;/* 辞書中の順序による頻度のボーナス */
+  int offset;/* 文字列中のオフセット */
   const char *line;
   int encoding;
 };
 /*
- * #XX*123 ȤCannadicηѡ
+ * #XX*123 というCannadicの形式をパーズする
  *  #XX
  *  #XX*123
  *  #XX,x*123
@@ -155,13 +175,13 @@ parse_wtype_str(struct wt_stat *ws)
   char *feature_part;
   const char *wt_name;
   const unsigned char *p;
-  /* Хåեإԡ */
+  /* バッファへコピーする */
   len = wtype_str_len(&ws->line[ws->offset]);
   buf = alloca(len + 1);
   strncpy(buf, &ws->line[ws->offset], len);
   buf[len] = 0;
 
-  /* (̤) */
+  /* 素性(未使用) */
   feature_part = strchr(buf, ',');
   if (feature_part) {
     ws->feature = 1;
@@ -169,7 +189,7 @@ parse_wtype_str(struct wt_stat *ws)
     ws->feature = 0;
   }
 
-  /* ٤parse */
+  /* 頻度をparseする */
   freq_part = strchr(&buf[2], '*');
   if (freq_part) {
     *freq_part = 0;
@@ -199,7 +219,7 @@ normalize_freq(struct wt_stat* ws)
   return ws->freq + ws->order_bonus;
 }
 
-/* '\\'ˤ륨פбԡ */
+/* '\\'によるエスケープに対応したコピー */
 static void
 copy_to_buf(char *buf, const char *src, int char_count)
 {
@@ -220,13 +240,13 @@ copy_to_buf(char *buf, const char *src, int char_count)
   buf[pos] = 0;
 }
 
-/** seq_entdic_entɲä */
+/** seq_entにdic_entを追加する */
 static int
 add_dic_ent(struct seq_ent *seq, struct wt_stat *ws,
 	    xstr* yomi, int is_reverse)
 {
   int i;
-  /* եΥХȿ */
+  /* 辞書ファイル中のバイト数 */
   int char_count;
   char *buf;
   xstr *xs;
@@ -234,7 +254,7 @@ add_dic_ent(struct seq_ent *seq, struct wt_stat *ws,
   wtype_t w = ws->wt;
   const char *s = &ws->line[ws->offset];
 
-  /* ñʸ׻ */
+  /* 単語の文字数を計算 */
   for (i = 0, char_count = 0;
        s[i] && (s[i] != ' ') && (s[i] != '#'); i++) {
     char_count ++;
@@ -244,26 +264,26 @@ add_dic_ent(struct seq_ent *seq, struct wt_stat *ws,
     }
   }
 
-  /* ʻ줬ƤʤΤ̵ */
+  /* 品詞が定義されていないので無視 */
   if (!ws->wt_name) {
     return char_count;
   }
 
-  /* freqʤΤϵѴ */
+  /* freqが負なのは逆変換用 */
   if (!is_reverse && ws->freq < 0) {
     return char_count;
   }
 
-  /* bufñ򥳥ԡ */
+  /* bufに単語をコピー */
   buf = alloca(char_count+1);
   copy_to_buf(buf, s, char_count);
 
   xs = anthy_cstr_to_xstr(buf, ws->encoding);
 
-  /* freqʤΤϽѴ */
+  /* freqが正なのは順変換用 */
   if (is_reverse && ws->freq > 0) {
-    /* ѴκݤˡѴѤߤʬ̤ѴʬäƤб٤ˡ
-       ʿ̾ΤߤʤʬϽ缭ˤɤߤñ줬dic_ent롣
+    /* 再変換の際に、変換済みの部分と未変換の部分が混じっていた場合に対応する為に、
+       平仮名のみからなる部分は順辞書にその読みを持つ単語があればdic_entを生成する。
     */
     if (anthy_get_xstr_type(yomi) & XCT_HIRA) {
       freq = normalize_freq(ws);
@@ -278,7 +298,7 @@ add_dic_ent(struct seq_ent *seq, struct wt_stat *ws,
 
   anthy_mem_dic_push_back_dic_ent(seq, 0, xs, w, ws->wt_name, freq, 0);
   if (anthy_wtype_get_meisi(w)) {
-    /* Ϣѷ̾첽Ĥ̾첽Τɲ */
+    /* 連用形が名詞化するやつは名詞化したものも追加 */
     w = anthy_get_wtype_with_ct(w, CT_MEISIKA);
     anthy_mem_dic_push_back_dic_ent(seq, 0, xs, w, ws->wt_name, freq, 0);
   }
@@ -298,20 +318,20 @@ add_compound_ent(struct seq_ent *seq, struct wt_stat *ws,
 
   (void)yomi;
 
-  /* freqʤΤϵѴ */
+  /* freqが負なのは逆変換用 */
   if (!is_reverse && ws->freq < 0) {
-    /* ʤѴǤפʤ */
+    /* 普段の変換では要らない */
     return len;
   }
 
-  /* freqʤΤϽѴ */
+  /* freqが正なのは順変換用 */
   if (is_reverse && ws->freq > 0) {
 
-    /* ѴκݤˡѴѤߤʬ̤ѴʬäƤб٤ˡ
-       ʿ̾ΤߤʤʬϽ缭ˤɤߤñ줬dic_ent롣
+    /* 再変換の際に、変換済みの部分と未変換の部分が混じっていた場合に対応する為に、
+       平仮名のみからなる部分は順辞書にその読みを持つ単語があればdic_entを生成する。
     */
     /*
-      yomi#_ղäʸɬפ
+      yomiに#_等を付加した文字列を作る必要がある
     if (anthy_get_xstr_type(yomi) & (XCT_HIRA | XCT_KATA)) {
       freq = normalize_freq(ws);
       anthy_mem_dic_push_back_compound_ent(seq, xs, ws->wt, freq);
@@ -345,7 +365,7 @@ init_wt_stat(struct wt_stat *ws, char *line)
   ws->encoding = ANTHY_UTF8_ENCODING;
 }
 
-/** Υȥξ򸵤seq_ent򤦤 */
+/** 辞書のエントリの情報を元にseq_entをうめる */
 static void
 fill_dic_ent(char *line, struct seq_ent *seq, 
 	     xstr* yomi, int is_reverse)
@@ -357,18 +377,18 @@ fill_dic_ent(char *line, struct seq_ent *seq,
     if (ws.line[ws.offset] == '#') {
       const unsigned char *c = (const unsigned char *)&ws.line[ws.offset + 1];
       if (*c == WT_COMPOUND) {
-	/* ʣ */
+	/* 複合語候補 */
 	ws.offset += add_compound_ent(seq, &ws,
 				      yomi,
 				      is_reverse);
       } else if (*c) {
-	/* ʻ* */
+	/* 品詞*頻度 */
 	ws.wt_name = parse_wtype_str(&ws);
 	/**/
 	ws.order_bonus = 0;
       }
     } else {
-      /* ñ */
+      /* 単語 */
       ws.offset += add_dic_ent(seq, &ws, yomi,
 			       is_reverse);
       if (ws.order_bonus > 0) {
@@ -381,25 +401,126 @@ fill_dic_ent(char *line, struct seq_ent *seq,
   }
 }
 
+/* 可変長整数を読む */
+static const unsigned char *
+read_varint(const unsigned char *p, unsigned int *v)
+{
+  unsigned int r = 0;
+  int shift = 0;
+  while (*p & 0x80) {
+    r |= (unsigned int)(*p & 0x7f) << shift;
+    shift += 7;
+    p ++;
+  }
+  *v = r | ((unsigned int)*p << shift);
+  return p + 1;
+}
+
+/* 長さlenのUTF-8の文字列をxcharに展開してseq_entに追加する */
+static void
+add_binary_ent(struct seq_ent *seq, int tag,
+	       const unsigned char *p, unsigned int len,
+	       wtype_t wt, const char *wt_name, int freq)
+{
+  const unsigned char *end = p + len;
+  xstr xs;
+
+  xs.str = alloca(sizeof(xchar) * len);
+  xs.len = 0;
+  while (p < end) {
+    p = (const unsigned char *)
+      anthy_utf8_to_ucs4_xchar((const char *)p, &xs.str[xs.len]);
+    xs.len ++;
+  }
+
+  if (tag & WORD_ENTRY_COMPOUND) {
+    anthy_mem_dic_push_back_dic_ent(seq, 1, &xs, wt, wt_name, freq, 0);
+    return ;
+  }
+  anthy_mem_dic_push_back_dic_ent(seq, 0, &xs, wt, wt_name, freq, 0);
+  if (anthy_wtype_get_meisi(wt)) {
+    /* 連用形が名詞化するやつは名詞化したものも追加 */
+    wt = anthy_get_wtype_with_ct(wt, CT_MEISIKA);
+    anthy_mem_dic_push_back_dic_ent(seq, 0, &xs, wt, wt_name, freq, 0);
+  }
+}
+
+/** バイナリ形式の辞書のエントリの情報を元にseq_entをうめる
+ * 文字列はUTF-8のまま格納されているので、そのままxcharに展開する
+ */
+static void
+fill_dic_ent_binary(const unsigned char *p, struct seq_ent *seq,
+		    xstr *yomi, int is_reverse)
+{
+  wtype_t wt = anthy_wt_none;
+  const char *wt_name = NULL;
+  int freq = 0;
+
+  while (*p & WORD_ENTRY_TAG) {
+    int tag = *p;
+    unsigned int len;
+    const unsigned char *end;
+    p ++;
+    if (tag & WORD_ENTRY_HEADER) {
+      /* 品詞*頻度 */
+      unsigned int u;
+      wt_name = anthy_id_to_wtype(*p, &wt);
+      if (!wt_name) {
+	wt = anthy_wt_none;
+      }
+      p = read_varint(p + 1, &u);
+      freq = (int)(u >> 1) ^ -(int)(u & 1);
+      if (freq == 1) {
+	freq = FREQ_RATIO - 2;
+      } else {
+	freq *= FREQ_RATIO;
+      }
+    }
+    p = read_varint(p, &len);
+    end = p + len;
+
+    /* 品詞が定義されていない、もしくは
+     * 順変換で逆変換用(freqが負)の単語なので無視 */
+    if (!wt_name || (!is_reverse && freq < 0)) {
+      p = end;
+      continue;
+    }
+    /* 逆変換で順変換用(freqが正)の単語 */
+    if (is_reverse && freq > 0) {
+      /* 平仮名のみからなる部分は順辞書にその読みを持つ単語があれば
+	 dic_entを生成する(add_dic_ent参照)。複合語は対象外 */
+      if (!(tag & WORD_ENTRY_COMPOUND) &&
+	  (anthy_get_xstr_type(yomi) & XCT_HIRA)) {
+	anthy_mem_dic_push_back_dic_ent(seq, 0, yomi, wt, wt_name, freq, 0);
+      }
+      p = end;
+      continue;
+    }
+
+    add_binary_ent(seq, tag, p, len, wt, wt_name, abs(freq));
+    p = end;
+  }
+}
+
 /*
- * s˽񤫤줿ʸˤäxѹ
- * ֤ͤɤ߿ʤ᤿Хȿ
+ * sに書かれた文字列によってxを変更する
+ * 返り値は読み進めたバイト数
  */
 static int
 mkxstr(char *s, xstr *x)
 {
   int i, len;
-  /* s[0]ˤϴᤷʸ */
+  /* s[0]には巻き戻しの文字数 */
   x->len -= (s[0] - 1);
   for (i = 1; is_printable(&s[i]); i ++) {
     len = mb_fragment_len(&s[i]);
     if (len > 1) {
-      /* ޥХ */
+      /* マルチバイト */
       x->str[x->len] = form_mb_char(&s[i]);
       x->len ++;
       i += (len - 1);
     } else {
-      /* 1Хʸ */
+      /* 1バイト文字 */
       x->str[x->len] = s[i];
       x->len ++;
     }
@@ -420,7 +541,7 @@ set_next_idx(struct lookup_context *lc)
   return 0;
 }
 
-/** ڡñξĴ٤ */
+/** ページ中の単語の場所を調べる */
 static void
 search_words_in_page(struct lookup_context *lc, int page, char *s)
 {
@@ -428,7 +549,7 @@ search_words_in_page(struct lookup_context *lc, int page, char *s)
   xchar *buf;
   xstr xs;
   int nr = 0;
-  /* ΥڡˤäȤĹñǼĹ */
+  /* このページ中にあるもっとも長い単語を格納しうる長さ */
   buf = alloca(sizeof(xchar)*strlen(s)/2);
   xs.str = buf;
   xs.len = 0;
@@ -443,16 +564,16 @@ search_words_in_page(struct lookup_context *lc, int page, char *s)
       if (!set_next_idx(lc)) {
 	return ;
       }
-      /* ƱڡǼñõ */
+      /* 同じページ内で次の単語を探す */
     }
     o ++;
   }
   if (nr == 0) {
-    /* Υڡ1⸫Ĥʤä顢ñ̵ */
+    /* このページで1語も見つからなかったら、この単語は無い */
     lc->array[lc->nth]->tmp.idx = NO_WORD;
     set_next_idx(lc);
   }
-  /* ߤñϼθƤӽФõ */
+  /* 現在の単語は次の呼び出しで探す */
 }
 
 /**/
@@ -474,11 +595,11 @@ compare_page_index(struct word_dic *wdic, const char *key, int page)
   return strcmp(key ,buf);
 }
 
-/* ƵŪ˥Хʥꥵ򤹤 */
+/* 再帰的にバイナリサーチをする */
 static int
 get_page_index_search(struct word_dic *wdic, const char *key, int f, int t)
 {
-  /* anthy_xstrcmp-1̵ʤäȤõ */
+  /* anthy_xstrcmpが-1で無くなったところを探す */
   int c,p;
   c = (f+t)/2;
   if (f+1==t) {
@@ -494,23 +615,23 @@ get_page_index_search(struct word_dic *wdic, const char *key, int f, int t)
   } 
 }
 
-/** keyޤǽΤڡֹ롢
- * ϰϥå򤷤ƥХʥꥵԤget_page_index_searchƤ
+/** keyを含む可能性のあるページの番号を得る、
+ * 範囲チェックをしてバイナリサーチを行うget_page_index_searchを呼ぶ
  */
 static int
 get_page_index(struct word_dic *wdic, struct lookup_context *lc)
 {
   int page;
   const char *key = lc->array[lc->nth]->key;
-  /* ǽΥڡɤߤ⾮ */
+  /* 最初のページの読みよりも小さい */
   if (compare_page_index(wdic, key, 0) < 0) {
     return -1;
   }
-  /* ǸΥڡɤߤ礭ΤǡǸΥڡ˴ޤޤǽ */
+  /* 最後のページの読みよりも大きいので、最後のページに含まれる可能性がある */
   if (compare_page_index(wdic, key, wdic->nr_pages-1) >= 0) {
     return wdic->nr_pages-1;
   }
-  /*  */
+  /* 検索する */
   page = get_page_index_search(wdic, key, 0, wdic->nr_pages);
   return page;
 }
@@ -531,7 +652,7 @@ get_section(struct word_dic *wdic, int section)
   return &wdic->dic_file[offset];
 }
 
-/** եmmapơword_dicγƥΥݥ󥿤 */
+/** 辞書ファイルをmmapして、word_dic中の各セクションのポインタを取得する */
 static int
 get_word_dic_sections(struct word_dic *wdic)
 {
@@ -541,18 +662,30 @@ get_word_dic_sections(struct word_dic *wdic)
   wdic->page_index = (int *)get_section(wdic, 5);
   wdic->uc_section = (char *)get_section(wdic, 6);
   wdic->hash_ent = (unsigned char *)get_section(wdic, 7);
+  /* ヘッダの2番目の値は単語エントリの形式 */
+  wdic->entry_format = anthy_dic_ntohl(((int *)wdic->dic_file)[1]);
+  wdic->bloom_hashes =
+    anthy_dic_ntohl(((int *)wdic->dic_file)[WORD_DIC_BLOOM_HASHES_INDEX]);
+  wdic->bloom_blocks =
+    anthy_dic_ntohl(((int *)wdic->dic_file)[WORD_DIC_BLOOM_BLOCKS_INDEX]);
+  if (wdic->bloom_hashes > WORD_DIC_BLOOM_MAX_HASHES ||
+      wdic->bloom_blocks <= 0 ||
+      (wdic->bloom_blocks & (wdic->bloom_blocks - 1))) {
+    /* 旧形式のbitmap */
+    wdic->bloom_hashes = 0;
+  }
 
   return 0;
 }
 
-/** ꤵ줿ñμΥǥåĴ٤ */
+/** 指定された単語の辞書中のインデックスを調べる */
 static void
 search_yomi_index(struct word_dic *wdic, struct lookup_context *lc)
 {
   int p;
   int page_number;
 
-  /* Ǥ̵ȤʬäƤ */
+  /* すでに無いことが分かっている */
   if (lc->array[lc->nth]->tmp.idx == NO_WORD) {
     set_next_idx(lc);
     return ;
@@ -573,21 +706,24 @@ static void
 find_words(struct word_dic *wdic, struct lookup_context *lc)
 {
   int i;
-  /* ˽ */
+  /* 検索前に除去 */
   for (i = 0; i < lc->nr; i++) {
     lc->array[i]->tmp.idx = NO_WORD;
     if (lc->array[i]->xs.len > 31) {
-      /* 32ʸʾñˤ̤б */
+      /* 32文字以上単語には未対応 */
       continue;
     }
-    /* hashˤʤʤ */
+    /* hashにないなら除去 */
+    wdic->nr_probes ++;
     if (!check_hash_ent(wdic, &lc->array[i]->xs)) {
+      wdic->nr_rejected ++;
       continue;
     }
-    /* NO_WORDǤʤͤꤹ뤳ȤǸоݤȤ */
+    wdic->nr_false_positives ++;
+    /* NO_WORDでない値を設定することで検索対象とする */
     lc->array[i]->tmp.idx = 0;
   }
-  /*  */
+  /* 検索する */
   lc->nth = 0;
   while (lc->nth < lc->nr) {
     search_yomi_index(wdic, lc);
@@ -604,21 +740,42 @@ load_words(struct word_dic *wdic, struct lookup_context *lc)
     if (yomi_index != NO_WORD) {
       int entry_index;
       struct seq_ent *seq;
+      /* find_wordsで数えた分から見つかったものを引く */
+      wdic->nr_false_positives --;
       seq = anthy_cache_get_seq_ent(&lc->array[i]->xs,
 				    lc->is_reverse);
       entry_index = anthy_dic_ntohl(wdic->entry_index[yomi_index]);
-      fill_dic_ent(&wdic->entry[entry_index],
-		   seq,
-		   &lc->array[i]->xs,
-		   lc->is_reverse);
+      if (wdic->entry_format == WORD_ENTRY_BINARY) {
+	fill_dic_ent_binary((unsigned char *)&wdic->entry[entry_index],
+			    seq,
+			    &lc->array[i]->xs,
+			    lc->is_reverse);
+      } else {
+	fill_dic_ent(&wdic->entry[entry_index],
+		     seq,
+		     &lc->array[i]->xs,
+		     lc->is_reverse);
+      }
       anthy_validate_seq_ent(seq, &lc->array[i]->xs, lc->is_reverse);
     }
   }
 }
 
-/** word_dicñ򸡺
- * 񥭥å夫ƤФ
- * (gang lookupˤ뤳ȤƤ)
+/* 読みのfilterの統計を記録する */
+static void
+log_filter_stats(struct word_dic *wdic)
+{
+  anthy_log(2, "yomi filter: %ld probes, %ld rejected (%.1f%%), "
+	    "%ld false positives.\n",
+	    wdic->nr_probes, wdic->nr_rejected,
+	    (double)wdic->nr_rejected * 100 / wdic->nr_probes,
+	    wdic->nr_false_positives);
+  wdic->nr_logged_probes = wdic->nr_probes;
+}
+
+/** word_dicから単語を検索する
+ * 辞書キャッシュから呼ばれる
+ * (gang lookupにすることを検討する)
  */
 void
 anthy_gang_fill_seq_ent(struct word_dic *wdic,
@@ -629,40 +786,185 @@ anthy_gang_fill_seq_ent(struct word_dic *wdic,
   lc.array = array;
   lc.nr = nr;
   lc.is_reverse = is_reverse;
+  if (is_reverse && wdic->reverse) {
+    /* 逆変換用の辞書を引く */
+    wdic = wdic->reverse;
+  }
 
-  /* ñξõ */
+  /* 各単語の場所を探す */
   find_words(wdic, &lc);
-  /* ñξɤ߹ */
+  /* 単語の情報を読み込む */
   load_words(wdic, &lc);
+  /* 解放されずに動き続けるプロセスのために時々記録する */
+  if (wdic->nr_probes - wdic->nr_logged_probes >= FILTER_STATS_INTERVAL) {
+    log_filter_stats(wdic);
+  }
 }
 
-struct word_dic *
-anthy_create_word_dic(void)
+/** dic_fileの指す辞書のイメージからword_dicを作る
+ * mappingはイメージを含むファイル、NULLならanthy.dic
+ */
+static struct word_dic *
+create_word_dic(char *dic_file, struct filemapping *mapping)
 {
   struct word_dic *wdic;
-  char *p;
+  int hot_size, reverse_offset;
 
   wdic = anthy_smalloc(word_dic_ator);
   memset(wdic, 0, sizeof(*wdic));
+  wdic->dic_file = dic_file;
 
-  /* եޥåפ */
-  wdic->dic_file = anthy_file_dic_get_section("word_dic");
-
-  /* ƥΥݥ󥿤 */
+  /* 各セクションのポインタを取得する */
   if (get_word_dic_sections(wdic) == -1) {
     anthy_sfree(word_dic_ator, wdic);
     return 0;
   }
   wdic->nr_pages = get_nr_page(wdic);
 
-  /* 㼭ޥåפ */
-  p = wdic->uc_section;
+  /* 頻度の高い単語のエントリは先頭にまとめてあるので先読みする */
+  hot_size = anthy_dic_ntohl(((int *)dic_file)[WORD_DIC_HOT_SIZE_INDEX]);
+  if (hot_size > 0) {
+    if (mapping) {
+      anthy_file_dic_image_prefetch(mapping, wdic->entry, hot_size);
+    } else {
+      anthy_file_dic_prefetch(wdic->entry, hot_size);
+    }
+  }
+
+  /* 逆変換用の辞書は同じイメージの中にある */
+  reverse_offset =
+    anthy_dic_ntohl(((int *)dic_file)[WORD_DIC_REVERSE_INDEX]);
+  if (reverse_offset > 0) {
+    wdic->reverse = create_word_dic(&dic_file[reverse_offset], mapping);
+  }
+  return wdic;
+}
+
+/** anthy.dic中の辞書からword_dicを作る */
+struct word_dic *
+anthy_create_word_dic(void)
+{
+  /* 辞書ファイルをマップする */
+  return create_word_dic(anthy_file_dic_get_section("word_dic"), NULL);
+}
+
+/* ヘッダの各セクションのオフセットがsizeバイトの中に収まっているか */
+static int
+check_word_dic_image(const char *fn, char *image, int size)
+{
+  int *header = (int *)image;
+  int i, reverse_offset;
+  if (!image || size <= (int)sizeof(int) * (WORD_DIC_REVERSE_INDEX + 1)) {
+    anthy_log(0, "Broken word dictionary (%s).\n", fn);
+    return -1;
+  }
+  for (i = 2; i < WORD_DIC_HOT_SIZE_INDEX; i++) {
+    int offset = anthy_dic_ntohl(header[i]);
+    if (offset < 0 || offset >= size) {
+      anthy_log(0, "Broken word dictionary (%s).\n", fn);
+      return -1;
+    }
+  }
+  if (anthy_dic_ntohl(header[1]) > WORD_ENTRY_BINARY) {
+    anthy_log(0, "Unknown word dictionary format (%s).\n", fn);
+    return -1;
+  }
+  if (anthy_dic_ntohl(header[WORD_DIC_BLOOM_HASHES_INDEX]) > 0) {
+    /* Bloom filterは最後のセクション */
+    int blocks = anthy_dic_ntohl(header[WORD_DIC_BLOOM_BLOCKS_INDEX]);
+    int offset = anthy_dic_ntohl(header[7]);
+    if (blocks <= 0 ||
+	blocks > (size - offset) / (WORD_DIC_BLOOM_BLOCK_BITS / 8)) {
+      anthy_log(0, "Broken word dictionary (%s).\n", fn);
+      return -1;
+    }
+  }
+  reverse_offset = anthy_dic_ntohl(header[WORD_DIC_REVERSE_INDEX]);
+  if (reverse_offset < 0 || reverse_offset >= size) {
+    anthy_log(0, "Broken word dictionary (%s).\n", fn);
+    return -1;
+  }
+  if (reverse_offset > 0) {
+    return check_word_dic_image(fn, &image[reverse_offset],
+				size - reverse_offset);
+  }
+  return 0;
+}
+
+/* mapしたファイル中のimageからword_dicを作る、失敗したらunmapする */
+static struct word_dic *
+create_word_dic_from_mapping(const char *fn, struct filemapping *mapping,
+			     char *image)
+{
+  struct word_dic *wdic = NULL;
+  char *head = anthy_mmap_address(mapping);
+  int size = anthy_mmap_size(mapping);
+
+  if (image &&
+      !check_word_dic_image(fn, image, size - (image - head))) {
+    wdic = create_word_dic(image, mapping);
+  }
+  if (!wdic) {
+    anthy_munmap(mapping);
+    return NULL;
+  }
+  /* 解放する時にunmapする */
+  wdic->mapping = mapping;
   return wdic;
 }
 
+/** mkworddicの出力した単独の辞書ファイルをmapしてword_dicを作る */
+struct word_dic *
+anthy_create_word_dic_from_file(const char *fn)
+{
+  struct filemapping *mapping;
+
+  mapping = anthy_file_dic_mmap(fn);
+  if (!mapping) {
+    return NULL;
+  }
+  return create_word_dic_from_mapping(fn, mapping,
+				      anthy_mmap_address(mapping));
+}
+
+/** anthy.dicと同じ形式の辞書ファイルをmapして、
+ * その中の単語辞書からword_dicを作る
+ * 入れ替えるのは単語辞書だけなので、他のセクションが
+ * 使用中のanthy.dicと異なる辞書ファイルは受け付けない */
+struct word_dic *
+anthy_create_word_dic_from_dic_file(const char *fn)
+{
+  struct filemapping *mapping;
+  char *image;
+
+  mapping = anthy_file_dic_mmap(fn);
+  if (!mapping) {
+    return NULL;
+  }
+  if (anthy_file_dic_image_check_sections(mapping, "word_dic")) {
+    anthy_log(0, "Sections other than word_dic differ in (%s).\n", fn);
+    anthy_munmap(mapping);
+    return NULL;
+  }
+  image = anthy_file_dic_image_get_section(mapping, "word_dic");
+  if (!image) {
+    anthy_log(0, "No word dictionary in (%s).\n", fn);
+  }
+  return create_word_dic_from_mapping(fn, mapping, image);
+}
+
 void
 anthy_release_word_dic(struct word_dic *wdic)
 {
+  if (wdic->nr_probes > 0) {
+    log_filter_stats(wdic);
+  }
+  if (wdic->reverse) {
+    anthy_release_word_dic(wdic->reverse);
+  }
+  if (wdic->mapping) {
+    anthy_munmap(wdic->mapping);
+  }
   anthy_sfree(word_dic_ator, wdic);
 }
 
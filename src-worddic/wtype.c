@@ -1,6 +1,6 @@
 /*
- * ʻ췿
- * Ȥwtype_tΥ쥤Ȥ˶¸롣
+ * 品詞型を管理する
+ * 中身はwtype_tの内部のレイアウトに強く依存する。
  *
  * Copyright (C) 2000-2007 TABATA Yusuke
  */
@@ -34,16 +34,16 @@ struct wttable {
   int cos;
   int scos;
   int cc;
-  int ct;/*Ѥʤ*/
+  int ct;/*カ変など*/
   int flags;
 };
 
-/* ʻܸ̾ʻѴơ֥ */
+/* 品詞の日本語の名前を品詞に変換するテーブル */
 static struct wttable pos_name_tab[]= {
 #include "ptab.h"
 };
 
-/* ʻ̾ʻѴơ֥ */
+/* 辞書中の品詞の名前を品詞に変換するテーブル */
 static struct wttable wt_name_tab[]= {
 #include "wtab.h"
 };
@@ -77,8 +77,8 @@ anthy_init_wtypes(void)
 }
 
 /*
- * ֤ͤˤʻ̾
- * tˤʻ줬֤
+ * 返り値には品詞の名前
+ * tには品詞が返される
  */
 const char *
 anthy_type_to_wtype(const char *s, wtype_t *t)
@@ -139,7 +139,7 @@ anthy_init_wtype_by_name(const char *name)
   return anthy_wt_all;
 }
 
-/* Ĥʻ줬˰פƤ뤫ɤ */
+/* 二つの品詞が完全に一致しているかどうか */
 int
 anthy_wtype_equal(wtype_t lhs, wtype_t rhs)
 {
@@ -156,7 +156,7 @@ anthy_wtype_equal(wtype_t lhs, wtype_t rhs)
 }
 
 
-/* n  hs ΰɤ */
+/* n は hs の一部かどうか？ */
 int
 anthy_wtype_include(wtype_t hs, wtype_t n)
 {
@@ -1,14 +1,34 @@
 /* リリース前のチェックを行う */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <anthy/anthy.h>
 #include <anthy/xstr.h>
 
+/* ビルド時のカレントディレクトリ (ここに .anthy を作る) */
+#ifndef TEST_HOME
+# define TEST_HOME "."
+#endif
+
+/* プールに取っておくコンテキストの数 */
+#define TEST_CONTEXT_POOL "2"
+
+static void
+set_conf(void)
+{
+  /* 既にインストールされているファイルの影響を受けないようにする */
+  anthy_conf_override("CONFFILE", "../anthy-conf");
+  anthy_conf_override("HOME", TEST_HOME);
+  anthy_conf_override("DIC_FILE", "../mkanthydic/anthy.dic");
+  anthy_conf_override("CONTEXT_POOL", TEST_CONTEXT_POOL);
+}
+
 static int
 init(void)
 {
   int res;
 
+  set_conf();
   res = anthy_init_utf8();
   if (res) {
     printf("failed to init\n");
@@ -16,6 +36,7 @@ init(void)
   }
   anthy_quit();
   /* init again */
+  set_conf();
   res = anthy_init_utf8();
   if (res) {
     printf("failed to init\n");
@@ -92,25 +113,199 @@ shake_test(const char *str)
   return 0;
 }
 
+/* 各文節の最初の候補をつないだ変換結果をbufに入れる */
+static int
+convert(anthy_context_t ac, const char *str, char *buf, int len)
+{
+  struct anthy_conv_stat cs;
+  int i, n, pos = 0;
+
+  anthy_reset_context(ac);
+  if (anthy_set_string(ac, str) || anthy_get_stat(ac, &cs)) {
+    return -1;
+  }
+  for (i = 0; i < cs.nr_segment; i++) {
+    n = anthy_get_segment(ac, i, 0, &buf[pos], len - pos);
+    if (n < 0) {
+      return -1;
+    }
+    pos += n;
+  }
+  return 0;
+}
+
+/* 再変換した各文節の読みが、逆変換の候補の順で決まっているか */
+static int
+reconvert_test(const char *str, const char *expect)
+{
+  anthy_context_t ac;
+  struct anthy_conv_stat cs;
+  char buf[256];
+  int i, n, pos = 0;
+
+  ac = anthy_create_context();
+  if (!ac) {
+    printf("failed to create context\n");
+    return 1;
+  }
+  if (anthy_set_string(ac, str) || anthy_get_stat(ac, &cs)) {
+    anthy_release_context(ac);
+    return 1;
+  }
+  /* 文節の読みを|で区切ってつなぐ */
+  for (i = 0; i < cs.nr_segment; i++) {
+    if (i > 0) {
+      buf[pos++] = '|';
+    }
+    n = anthy_get_segment(ac, i, NTH_UNCONVERTED_CANDIDATE,
+			  &buf[pos], 256 - pos);
+    if (n < 0) {
+      anthy_release_context(ac);
+      return 1;
+    }
+    pos += n;
+  }
+  anthy_release_context(ac);
+  if (strcmp(buf, expect)) {
+    printf("(%s) -> (%s), expected (%s)\n", str, buf, expect);
+    return 1;
+  }
+  return 0;
+}
+
+/* 辞書を読み込み直しても、前後で同じ変換ができるか */
+static int
+reload_test(const char *str)
+{
+  anthy_context_t ac, ac2;
+  char before[256], after[256];
+
+  ac = anthy_create_context();
+  if (!ac) {
+    printf("failed to create context\n");
+    return 1;
+  }
+  if (convert(ac, str, before, 256)) {
+    anthy_release_context(ac);
+    return 1;
+  }
+  /* 同じ辞書ファイル */
+  if (anthy_reload_dic(NULL)) {
+    printf("failed to reload dictionary\n");
+    anthy_release_context(ac);
+    return 1;
+  }
+  /* 読み込み前に作ったコンテキスト */
+  if (convert(ac, str, after, 256) || strcmp(before, after)) {
+    printf("(%s) -> (%s) after reload\n", before, after);
+    anthy_release_context(ac);
+    return 1;
+  }
+  /* 読めない辞書は拒否して、今の辞書を使い続ける */
+  if (!anthy_reload_dic("no-such-file.dic")) {
+    printf("reloaded a missing dictionary\n");
+    anthy_release_context(ac);
+    return 1;
+  }
+  /* 単語辞書以外のセクションが違う辞書も拒否する */
+  if (!anthy_reload_dic("../mkworddic/anthy.wdic")) {
+    printf("reloaded a dictionary with different sections\n");
+    anthy_release_context(ac);
+    return 1;
+  }
+  anthy_release_context(ac);
+  ac2 = anthy_create_context();
+  if (!ac2) {
+    printf("failed to create context\n");
+    return 1;
+  }
+  if (convert(ac2, str, after, 256) || strcmp(before, after)) {
+    printf("(%s) -> (%s) after failed reload\n", before, after);
+    anthy_release_context(ac2);
+    return 1;
+  }
+  anthy_release_context(ac2);
+  return 0;
+}
+
+/* プールに戻ったコンテキストを使い回しても同じ変換ができるか */
+static int
+pool_test(const char *str, const char *long_str)
+{
+  anthy_context_t ac[3];
+  char expect[256], res[256];
+  int i, j;
+
+  for (i = 0; i < 2; i++) {
+    /* プールの大きさより多く作って、全部返す */
+    for (j = 0; j < 3; j++) {
+      ac[j] = anthy_create_context();
+      if (!ac[j]) {
+	printf("failed to create context\n");
+	return 1;
+      }
+    }
+    for (j = 0; j < 3; j++) {
+      /* 作業領域を予約した長さより長い文字列も変換する */
+      if (convert(ac[j], long_str, res, 256) ||
+	  convert(ac[j], str, res, 256)) {
+	return 1;
+      }
+      if (i == 0 && j == 0) {
+	strcpy(expect, res);
+      } else if (strcmp(expect, res)) {
+	printf("(%s) -> (%s) in context %d\n", expect, res, j);
+	return 1;
+      }
+    }
+    for (j = 0; j < 3; j++) {
+      anthy_release_context(ac[j]);
+    }
+  }
+  return 0;
+}
+
 int
 main(int argc, char **argv)
 {
+  int fail = 0;
   (void)argc;
   (void)argv;
   printf("checking\n");
   if (init()) {
     printf("fail (init)\n");
-    return 0;
+    return 1;
   }
   if (test0()) {
     printf("fail (test0)\n");
+    fail = 1;
   }
   if (test1()) {
     printf("fail (test1)\n");
+    fail = 1;
   }
   if (shake_test("あいうえおかきくけこ")) {
     printf("fail (shake_test)\n");
+    fail = 1;
+  }
+  if (reconvert_test("方法はINSTALLを", "かた|ほっ|は|INSTALLを") ||
+      reconvert_test("あれ(及び)これ", "あ|れ|（|きゅうび|）|これ") ||
+      reconvert_test("おくってきます送って来ます",
+		     "おくっ|てき|ます|そうって|らい|ます")) {
+    printf("fail (reconvert_test)\n");
+    fail = 1;
   }
+  if (reload_test("かんじをへんかんする")) {
+    printf("fail (reload_test)\n");
+    fail = 1;
+  }
+  if (pool_test("かんじをへんかんする",
+		"きょうはいいてんきなのでこうえんまでさんぽにいってから"
+		"としょかんでほんをかりてかえりました")) {
+    printf("fail (pool_test)\n");
+    fail = 1;
+  }
+  anthy_quit();
   printf("done\n");
-  return 0;
+  return fail;
 }